@@ -1,57 +1,107 @@
 #include "DES.h"
 #include "DESConstants.h"
+#include "DESTables.h"
+#include "libdes.h"
+#include "pool.h"
+#include "jit.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 // DES块大小 - 现在1个BYTE即为一个块(64位)
 #define BLOCK_SIZE 1
 
+// 按PC1/移位/PC2生成加密顺序的16个子密钥
+static void expandKey(BYTE key, BYTE subkeys[16]);
+
+const DES_KeySchedule *DES_scheduleCreate(BYTE key)
+{
+    // 池分配的缓冲区按缓存行对齐
+    DES_KeySchedule *ks = (DES_KeySchedule *)poolAlloc(sizeof(DES_KeySchedule));
+    if (!ks)
+        return NULL;
+    expandKey(key, ks->encKeys);
+    for (int i = 0; i < 16; i++)
+    {
+        ks->decKeys[i] = ks->encKeys[15 - i];
+    }
+    ks->key = key;
+    // 启用代码生成时取得该密钥的专用代码, 否则使用通用实现
+    if (!jitAcquire(key, &ks->jitEncrypt, &ks->jitDecrypt))
+    {
+        ks->jitEncrypt = NULL;
+        ks->jitDecrypt = NULL;
+    }
+    return ks;
+}
+
+void DES_scheduleFree(const DES_KeySchedule *schedule)
+{
+    if (schedule && schedule->jitEncrypt)
+        jitRelease(schedule->key);
+    poolFree((void *)schedule);
+}
+
+void DES_bind(DES *des, const DES_KeySchedule *schedule, BYTE iv)
+{
+    des->schedule = schedule;
+    des->iv = iv;
+}
+
 // 创建DES实例
 DES *DES_create()
 {
-    DES *des = (DES *)malloc(sizeof(DES));
+    DES *des = (DES *)poolAlloc(sizeof(DES));
     if (des)
     {
-        des->key = 0;
-        des->subKeys = NULL;
+        des->schedule = NULL;
+        des->iv = 0;
     }
     return des;
 }
 
+// 释放实例独占的密钥编排 (DES_bind 绑定的上下文不经过这里, 共享的编排由创建者释放)
+static void releaseSchedule(DES *des)
+{
+    DES_scheduleFree(des->schedule);
+    des->schedule = NULL;
+}
+
 // 销毁DES实例
 void DES_destroy(DES *des)
 {
     if (des)
     {
-        if (des->subKeys)
-        {
-            free(des->subKeys);
-        }
-        free(des);
+        releaseSchedule(des);
+        poolFree(des);
     }
 }
 
-void DES_init(DES *des, BYTE key)
+const char *DES_libraryVersion(void)
 {
-    des->key = key;
-    des->subKeys = generate_subkeys(key);
-    if (!des->subKeys)
-    {
-        printf("Failed to generate subkeys.\n");
-        return;
-    }
+    return LIBDES_VERSION;
+}
+
+int DES_init(DES *des, BYTE key)
+{
+    // 先创建新编排, 失败时实例保持原状
+    const DES_KeySchedule *schedule = DES_scheduleCreate(key);
+    if (!schedule)
+        return 0;
+    releaseSchedule(des);
+    des->schedule = schedule;
+    return 1;
 }
 
 // 设置密钥
-void DES_setKey(DES *des, BYTE *key, size_t keySize)
+int DES_setKey(DES *des, BYTE *key, size_t keySize)
 {
     if (des && key && keySize == 1)
     { // 期望密钥大小为1个BYTE (64位)
-        des->key = *key;
-        // 生成子密钥
-        des->subKeys = generate_subkeys(des->key);
+        return DES_init(des, *key);
     }
+    return 0;
 }
 
 // 设置初始化向量
@@ -63,91 +113,209 @@ void DES_setIV(DES *des, BYTE *iv, size_t ivSize)
     }
 }
 
-BYTE DES_encryptBlock(DES *des, BYTE block)
+const char *DES_tableVariant(size_t *footprint)
 {
-    // 初始置换
-    block = IP_transform(block);
+#if DES_TABLES == DES_TABLES_COMPACT
+    if (footprint)
+        *footprint = sizeof(DES_SBOX_TABLE) + sizeof(DES_P4_TABLE);
+    return "compact";
+#elif DES_TABLES == DES_TABLES_MEDIUM
+    if (footprint)
+        *footprint = sizeof(DES_SP_TABLE);
+    return "medium";
+#else
+    if (footprint)
+        *footprint = sizeof(DES_SP_TABLE) + sizeof(DES_E_TABLE) + sizeof(DES_IP_TABLE) + sizeof(DES_IP_INV_TABLE);
+    return "large";
+#endif
+}
 
-    // 分为左右两部分
-    BYTE left = (block >> 32) & 0xFFFFFFFF;
-    BYTE right = block & 0xFFFFFFFF;
+// 位交换: 把 a 中移位 n 后与 b 在 mask 处对应的位互换
+#define DELTA_SWAP(a, b, n, mask)                        \
+    do                                                   \
+    {                                                    \
+        uint32_t t_ = (((a) >> (n)) ^ (b)) & (mask);     \
+        (b) ^= t_;                                       \
+        (a) ^= t_ << (n);                                \
+    } while (0)
+
+// 初始置换按 MSB→LSB. large 按字节查表, 其余规模用5次位交换完成, 不占缓存
+static inline BYTE initialPermutation(BYTE block)
+{
+#if DES_TABLES == DES_TABLES_LARGE
+    return DES_IP_TABLE[0][block >> 56] | DES_IP_TABLE[1][(block >> 48) & 0xFF] |
+           DES_IP_TABLE[2][(block >> 40) & 0xFF] | DES_IP_TABLE[3][(block >> 32) & 0xFF] |
+           DES_IP_TABLE[4][(block >> 24) & 0xFF] | DES_IP_TABLE[5][(block >> 16) & 0xFF] |
+           DES_IP_TABLE[6][(block >> 8) & 0xFF] | DES_IP_TABLE[7][block & 0xFF];
+#else
+    uint32_t l = (uint32_t)(block >> 32), r = (uint32_t)block;
+    DELTA_SWAP(l, r, 4, 0x0F0F0F0FU);
+    DELTA_SWAP(l, r, 16, 0x0000FFFFU);
+    DELTA_SWAP(r, l, 2, 0x33333333U);
+    DELTA_SWAP(r, l, 8, 0x00FF00FFU);
+    DELTA_SWAP(l, r, 1, 0x55555555U);
+    return ((BYTE)l << 32) | r;
+#endif
+}
 
-    // 16轮迭代
-    for (int i = 0; i < 16; i++)
-    {
-        // 扩展右半部分
-        BYTE expandedRight = E_expansion(right);
-        // 与子密钥异或
-        expandedRight ^= des->subKeys[i];
-        // S-盒变换
-        BYTE sboxOutput = S_box(expandedRight);
-        // P-置换
-        BYTE pOutput = P_permutation(sboxOutput);
-        // 左右交换并异或
-        BYTE temp = left;
-        left = right;
-        right = temp ^ pOutput;
-    }
+// 逆初始置换，MSB→LSB, 与初始置换相同的两种实现
+static inline BYTE finalPermutation(BYTE block)
+{
+#if DES_TABLES == DES_TABLES_LARGE
+    return DES_IP_INV_TABLE[0][block >> 56] | DES_IP_INV_TABLE[1][(block >> 48) & 0xFF] |
+           DES_IP_INV_TABLE[2][(block >> 40) & 0xFF] | DES_IP_INV_TABLE[3][(block >> 32) & 0xFF] |
+           DES_IP_INV_TABLE[4][(block >> 24) & 0xFF] | DES_IP_INV_TABLE[5][(block >> 16) & 0xFF] |
+           DES_IP_INV_TABLE[6][(block >> 8) & 0xFF] | DES_IP_INV_TABLE[7][block & 0xFF];
+#else
+    uint32_t l = (uint32_t)(block >> 32), r = (uint32_t)block;
+    DELTA_SWAP(l, r, 1, 0x55555555U);
+    DELTA_SWAP(r, l, 8, 0x00FF00FFU);
+    DELTA_SWAP(r, l, 2, 0x33333333U);
+    DELTA_SWAP(l, r, 16, 0x0000FFFFU);
+    DELTA_SWAP(l, r, 4, 0x0F0F0F0FU);
+    return ((BYTE)l << 32) | r;
+#endif
+}
 
-    // 合并左右部分 - 注意最后一轮后需要交换左右顺序
-    block = ((BYTE)right << 32) | left;
+#if DES_TABLES != DES_TABLES_LARGE
+// E扩展后与子密钥异或结果的第i组6位: E的第i组恰为输入的第4i-1到4i+4位(循环), 循环移位后直接取出
+// 移位量均为常量, 编译为一条循环移位
+#define ROUND_INDEX(r, k, i) \
+    (((((r) << ((4 * (i) + 31) & 31)) | ((r) >> (32 - ((4 * (i) + 31) & 31)))) >> 26 ^ (unsigned)((k) >> (42 - 6 * (i)))) & 0x3F)
+#endif
+
+#if DES_TABLES == DES_TABLES_COMPACT
+#define ROUND_LOOKUP(r, k, i) DES_P4_TABLE[i][DES_SBOX_TABLE[i][ROUND_INDEX(r, k, i)]]
+#elif DES_TABLES == DES_TABLES_MEDIUM
+#define ROUND_LOOKUP(r, k, i) DES_SP_TABLE[i][ROUND_INDEX(r, k, i)]
+#endif
+
+// 单轮F函数: 扩展、与子密钥异或、S-盒、P-置换, 按编译时选择的查表规模实现
+static inline BYTE feistel(BYTE right, BYTE subKey)
+{
+#if DES_TABLES == DES_TABLES_LARGE
+    // S-盒与P-置换合并为8次查表
+    BYTE x = E_expansion(right) ^ subKey;
+    return DES_SP_TABLE[0][(x >> 42) & 0x3F] | DES_SP_TABLE[1][(x >> 36) & 0x3F] |
+           DES_SP_TABLE[2][(x >> 30) & 0x3F] | DES_SP_TABLE[3][(x >> 24) & 0x3F] |
+           DES_SP_TABLE[4][(x >> 18) & 0x3F] | DES_SP_TABLE[5][(x >> 12) & 0x3F] |
+           DES_SP_TABLE[6][(x >> 6) & 0x3F] | DES_SP_TABLE[7][x & 0x3F];
+#else
+    uint32_t r = (uint32_t)right;
+    return ROUND_LOOKUP(r, subKey, 0) | ROUND_LOOKUP(r, subKey, 1) | ROUND_LOOKUP(r, subKey, 2) |
+           ROUND_LOOKUP(r, subKey, 3) | ROUND_LOOKUP(r, subKey, 4) | ROUND_LOOKUP(r, subKey, 5) |
+           ROUND_LOOKUP(r, subKey, 6) | ROUND_LOOKUP(r, subKey, 7);
+#endif
+}
 
-    // 逆初始置换
-    block = IP_inv_transform(block);
+// 单个块: 初始置换、16轮迭代、最后一轮后交换左右顺序、逆初始置换
+static inline BYTE processBlock(const BYTE ks[16], BYTE block)
+{
+    block = initialPermutation(block);
+    BYTE l = block >> 32, r = block & 0xFFFFFFFF;
+    for (int k = 0; k < 16; k++)
+    {
+        BYTE t = l ^ feistel(r, ks[k]);
+        l = r;
+        r = t;
+    }
+    return finalPermutation((r << 32) | l);
+}
 
-    return block;
+BYTE DES_encryptBlock(DES *des, BYTE block)
+{
+    return processBlock(des->schedule->encKeys, block);
 }
 
+// 解密使用编排中逆序的子密钥
 BYTE DES_decryptBlock(DES *des, BYTE block)
 {
-    // 初始置换
-    block = IP_transform(block);
-
-    // 分为左右两部分
-    BYTE left = (block >> 32) & 0xFFFFFFFF;
-    BYTE right = block & 0xFFFFFFFF;
+    return processBlock(des->schedule->decKeys, block);
+}
 
-    // 16轮迭代（子密钥顺序反转）
-    for (int i = 15; i >= 0; i--)
+// 批量处理的核心: ks为已按加/解密顺序排好的16个子密钥(位于栈上, 编译器可放入寄存器)
+// 每次交错处理4个块, 让相互独立的轮运算填满流水线
+static void DES_processBlocks(const BYTE ks[16], const BYTE *in, BYTE *out, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
     {
-        // 扩展右半部分
-        BYTE expandedRight = E_expansion(right);
-        // 与子密钥异或
-        expandedRight ^= des->subKeys[i];
-        // S-盒变换
-        BYTE sboxOutput = S_box(expandedRight);
-        // P-置换
-        BYTE pOutput = P_permutation(sboxOutput);
-        // 左右交换并异或
-        BYTE temp = left;
-        left = right;
-        right = temp ^ pOutput;
+#if defined(__GNUC__)
+        __builtin_prefetch(in + i + 32, 0, 0);
+#endif
+        BYTE b0 = initialPermutation(in[i]);
+        BYTE b1 = initialPermutation(in[i + 1]);
+        BYTE b2 = initialPermutation(in[i + 2]);
+        BYTE b3 = initialPermutation(in[i + 3]);
+        BYTE l0 = b0 >> 32, r0 = b0 & 0xFFFFFFFF;
+        BYTE l1 = b1 >> 32, r1 = b1 & 0xFFFFFFFF;
+        BYTE l2 = b2 >> 32, r2 = b2 & 0xFFFFFFFF;
+        BYTE l3 = b3 >> 32, r3 = b3 & 0xFFFFFFFF;
+        for (int r = 0; r < 16; r++)
+        {
+            BYTE t0 = l0 ^ feistel(r0, ks[r]);
+            BYTE t1 = l1 ^ feistel(r1, ks[r]);
+            BYTE t2 = l2 ^ feistel(r2, ks[r]);
+            BYTE t3 = l3 ^ feistel(r3, ks[r]);
+            l0 = r0, r0 = t0;
+            l1 = r1, r1 = t1;
+            l2 = r2, r2 = t2;
+            l3 = r3, r3 = t3;
+        }
+        // 最后一轮后交换左右顺序
+        out[i] = finalPermutation((r0 << 32) | l0);
+        out[i + 1] = finalPermutation((r1 << 32) | l1);
+        out[i + 2] = finalPermutation((r2 << 32) | l2);
+        out[i + 3] = finalPermutation((r3 << 32) | l3);
     }
+    // 剩余不足4个的块逐个处理
+    for (; i < n; i++)
+    {
+        out[i] = processBlock(ks, in[i]);
+    }
+}
 
-    // 合并左右部分
-    block = ((BYTE)right << 32) | left;
-
-    // 逆初始置换
-    block = IP_inv_transform(block);
-
-    return block;
+// 批量加密n个块, in与out可以指向同一数组(原地加密)
+void DES_encryptBlocks(DES *des, const BYTE *in, BYTE *out, size_t n)
+{
+    if (des->schedule->jitEncrypt)
+    {
+        des->schedule->jitEncrypt(in, out, n);
+        return;
+    }
+    BYTE ks[16];
+    memcpy(ks, des->schedule->encKeys, sizeof(ks));
+    DES_processBlocks(ks, in, out, n);
 }
 
-BYTE *generate_subkeys(BYTE key)
+// 批量解密n个块, 逆序子密钥已在编排中备好, 复用同一核心
+void DES_decryptBlocks(DES *des, const BYTE *in, BYTE *out, size_t n)
 {
-    BYTE *subkeys = (BYTE *)malloc(16 * sizeof(BYTE));
-    if (!subkeys)
+    if (des->schedule->jitDecrypt)
     {
-        return NULL;
+        des->schedule->jitDecrypt(in, out, n);
+        return;
     }
+    BYTE ks[16];
+    memcpy(ks, des->schedule->decKeys, sizeof(ks));
+    DES_processBlocks(ks, in, out, n);
+}
+
+BYTE *generate_subkeys(BYTE key)
+{
+    BYTE *subkeys = (BYTE *)poolAlloc(16 * sizeof(BYTE));
+    if (subkeys)
+        expandKey(key, subkeys);
+    return subkeys;
+}
 
-    // PC1 置换：按 MSB→LSB 提取到 key_, MSB-first 存储
+static void expandKey(BYTE key, BYTE subkeys[16])
+{
+    // PC1 置换：按字节查表, 结果 MSB-first 存储在低56位
     BYTE key_ = 0;
-    for (int i = 0; i < 56; i++)
+    for (int b = 0; b < 8; b++)
     {
-        int src = PC1[i] - 1; // MSB-based index
-        int bit = (key >> (63 - src)) & 1;
-        key_ |= (BYTE)bit << (55 - i); // MSB-first 存储, bit pos = 55 - i
+        key_ |= DES_PC1_TABLE[b][(key >> (56 - 8 * b)) & 0xFF];
     }
 
     // 分割 C0 和 D0，key_ MSB-first 存储, 高28位是 C0, 低28位是 D0
@@ -161,58 +329,33 @@ BYTE *generate_subkeys(BYTE key)
         C0 = ((C0 << shift) | (C0 >> (28 - shift))) & 0x0FFFFFFF;
         D0 = ((D0 << shift) | (D0 >> (28 - shift))) & 0x0FFFFFFF;
 
-        // PC2 置换：按 MSB→LSB 提取，MSB-first 存储
+        // PC2 置换：56位CD按字节查表，MSB-first 存储
         unsigned long long CD = ((unsigned long long)C0 << 28) | D0; // 合并时 C0 为高28位, D0 为低28位
         BYTE subkey = 0;
-        for (int j = 0; j < 48; j++)
+        for (int b = 0; b < 7; b++)
         {
-            int src2 = PC2[j] - 1;
-            int bit2 = (CD >> (55 - src2)) & 1;
-            subkey |= (BYTE)bit2 << (47 - j);
+            subkey |= DES_PC2_TABLE[b][(CD >> (48 - 8 * b)) & 0xFF];
         }
         subkeys[i] = subkey;
     }
-
-    return subkeys;
 }
 
-// 初始置换按 MSB→LSB
+// 对外的IP/IP^-1置换, 与加解密热路径同一实现
 BYTE IP_transform(const BYTE block)
 {
-    BYTE output = 0;
-    for (int i = 0; i < 64; i++)
-    {
-        int src = IP[i] - 1;
-        int bit = (block >> (63 - src)) & 1;
-        output |= (BYTE)bit << (63 - i);
-    }
-    return output;
+    return initialPermutation(block);
 }
 
-// 逆初始置换，MSB→LSB
 BYTE IP_inv_transform(const BYTE block)
 {
-    BYTE output = 0;
-    for (int i = 0; i < 64; i++)
-    {
-        int src = IP_INV[i] - 1;
-        int bit = (block >> (63 - src)) & 1;
-        output |= (BYTE)bit << (63 - i);
-    }
-    return output;
+    return finalPermutation(block);
 }
 
-// 扩展置换，MSB→LSB 输入, MSB-first 输出
+// 扩展置换，MSB→LSB 输入, MSB-first 输出, 按字节查表
 BYTE E_expansion(const BYTE block)
 {
-    BYTE output = 0;
-    for (int i = 0; i < 48; i++)
-    {
-        int src = E[i] - 1; // 0..31
-        int bit = (block >> (31 - src)) & 1;
-        output |= (BYTE)bit << (47 - i);
-    }
-    return output;
+    return DES_E_TABLE[0][(block >> 24) & 0xFF] | DES_E_TABLE[1][(block >> 16) & 0xFF] |
+           DES_E_TABLE[2][(block >> 8) & 0xFF] | DES_E_TABLE[3][block & 0xFF];
 }
 
 // P 置换，MSB→LSB 输入, MSB-first 输出
@@ -295,9 +438,9 @@ BYTE DES_encryptBlock_debug(DES *des, BYTE block)
 
         // 与子密钥异或
         printf("使用子密钥:\n");
-        print_bits(des->subKeys[i], "子密钥");
+        print_bits(des->schedule->encKeys[i], "子密钥");
 
-        expandedRight ^= des->subKeys[i];
+        expandedRight ^= des->schedule->encKeys[i];
         printf("与子密钥异或后:\n");
         print_bits(expandedRight, "异或结果");
 
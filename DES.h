@@ -4,34 +4,86 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdbool.h>
 #include "enum.h"
 
 // 64位BYTE类型定义
 typedef unsigned long long BYTE;
 
-// DES结构体定义
+#if defined(__GNUC__)
+#define DES_CACHE_ALIGNED __attribute__((aligned(64)))
+#else
+#define DES_CACHE_ALIGNED
+#endif
+
+// 轮函数的查表规模, 编译时用 make DES_TABLES=compact|medium|large 选择 (默认 large)
+// compact: 原始S-盒字节表 + 按S-盒输出索引的P表, 共1KB; E扩展和IP用移位计算
+// medium:  S-盒与P合并的32位SP表, 共2KB; E扩展和IP用移位计算
+// large:   SP表 + 按字节索引的64位E/IP/IP^-1表, 共42KB, 每轮指令最少
+#define DES_TABLES_COMPACT 1
+#define DES_TABLES_MEDIUM 2
+#define DES_TABLES_LARGE 3
+#ifndef DES_TABLES
+#define DES_TABLES DES_TABLES_LARGE
+#endif
+#if DES_TABLES != DES_TABLES_COMPACT && DES_TABLES != DES_TABLES_MEDIUM && DES_TABLES != DES_TABLES_LARGE
+#error "DES_TABLES must be DES_TABLES_COMPACT, DES_TABLES_MEDIUM or DES_TABLES_LARGE"
+#endif
+
+// 批量加/解密n个块的函数 (in与out可相同), 用于密钥专用代码 (见 jit.h)
+typedef void (*DES_BlocksFn)(const BYTE *in, BYTE *out, size_t n);
+
+// 密钥编排: 创建后只读, 可由任意多个线程共享
+// 加密和解密顺序的子密钥各占一个缓存行, 解密时不必再逆序复制
+typedef struct DES_CACHE_ALIGNED
+{
+    BYTE encKeys[16];        // 加密顺序的子密钥
+    BYTE decKeys[16];        // 解密顺序(逆序)的子密钥
+    BYTE key;                // 原始密钥
+    DES_BlocksFn jitEncrypt; // 该密钥的专用加密代码, 未启用或不可用时为NULL
+    DES_BlocksFn jitDecrypt; // 该密钥的专用解密代码
+} DES_KeySchedule;
+
+// DES上下文: 指向密钥编排并携带IV, 只有两个字, 可放在栈上按操作创建
+// DES_create 创建的实例独占 DES_setKey/DES_init 设置的编排, DES_destroy 时释放;
+// DES_bind 绑定的上下文不取得所有权, 不能再调用 DES_setKey/DES_init/DES_destroy
 typedef struct
 {
-    BYTE key;      // 密钥
-    BYTE *subKeys; // 子密钥
-    BYTE iv;       // 初始化向量
+    const DES_KeySchedule *schedule; // 密钥编排, 原始密钥为 schedule->key
+    BYTE iv;                         // 初始化向量
 } DES;
 
+// 创建和释放密钥编排. 失败返回NULL
+const DES_KeySchedule *DES_scheduleCreate(BYTE key);
+void DES_scheduleFree(const DES_KeySchedule *schedule);
+
+// 用共享的密钥编排初始化上下文(不取得所有权, 不分配内存)
+void DES_bind(DES *des, const DES_KeySchedule *schedule, BYTE iv);
+
 // 创建和销毁DES实例
 DES *DES_create();
 void DES_destroy(DES *des);
 
-// 设置密钥和初始化向量
-void DES_setKey(DES *des, BYTE *key, size_t keySize);
+// 设置密钥和初始化向量. 设置密钥会为该实例创建独占的密钥编排,
+// 成功返回1; 参数无效或内存不足返回0, 此时实例保持原状
+int DES_setKey(DES *des, BYTE *key, size_t keySize);
 void DES_setIV(DES *des, BYTE *iv, size_t ivSize);
 
-void DES_init(DES *des, BYTE key);
+// 同 DES_setKey, 直接接受密钥值
+int DES_init(DES *des, BYTE key);
+
+// 编译时选择的查表规模名称, footprint 非空时写入加解密热路径使用的查表字节数
+const char *DES_tableVariant(size_t *footprint);
 
 // 加密和解密函数
 BYTE DES_encryptBlock(DES *des, BYTE block);
 BYTE DES_decryptBlock(DES *des, BYTE block);
 
-// 生成子密钥
+// 批量加密和解密函数, 一次处理n个块 (in与out可相同). 编排带有密钥专用代码时调用它
+void DES_encryptBlocks(DES *des, const BYTE *in, BYTE *out, size_t n);
+void DES_decryptBlocks(DES *des, const BYTE *in, BYTE *out, size_t n);
+
+// 生成子密钥, 用 poolFree 释放
 BYTE *generate_subkeys(const BYTE key);
 
 // IP置换函数
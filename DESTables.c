@@ -0,0 +1,2446 @@
+// 由 gentables.c 从 DESConstants.h 生成, 请勿手工修改. 重新生成: make tables
+#include "DESTables.h"
+
+// 初始置换IP, 按输入字节查表
+const BYTE DES_IP_TABLE[8][256] DES_CACHE_ALIGNED = {
+    {
+        0x0000000000000000ULL, 0x0000000100000000ULL, 0x0000000000000001ULL, 0x0000000100000001ULL,
+        0x0000010000000000ULL, 0x0000010100000000ULL, 0x0000010000000001ULL, 0x0000010100000001ULL,
+        0x0000000000000100ULL, 0x0000000100000100ULL, 0x0000000000000101ULL, 0x0000000100000101ULL,
+        0x0000010000000100ULL, 0x0000010100000100ULL, 0x0000010000000101ULL, 0x0000010100000101ULL,
+        0x0001000000000000ULL, 0x0001000100000000ULL, 0x0001000000000001ULL, 0x0001000100000001ULL,
+        0x0001010000000000ULL, 0x0001010100000000ULL, 0x0001010000000001ULL, 0x0001010100000001ULL,
+        0x0001000000000100ULL, 0x0001000100000100ULL, 0x0001000000000101ULL, 0x0001000100000101ULL,
+        0x0001010000000100ULL, 0x0001010100000100ULL, 0x0001010000000101ULL, 0x0001010100000101ULL,
+        0x0000000000010000ULL, 0x0000000100010000ULL, 0x0000000000010001ULL, 0x0000000100010001ULL,
+        0x0000010000010000ULL, 0x0000010100010000ULL, 0x0000010000010001ULL, 0x0000010100010001ULL,
+        0x0000000000010100ULL, 0x0000000100010100ULL, 0x0000000000010101ULL, 0x0000000100010101ULL,
+        0x0000010000010100ULL, 0x0000010100010100ULL, 0x0000010000010101ULL, 0x0000010100010101ULL,
+        0x0001000000010000ULL, 0x0001000100010000ULL, 0x0001000000010001ULL, 0x0001000100010001ULL,
+        0x0001010000010000ULL, 0x0001010100010000ULL, 0x0001010000010001ULL, 0x0001010100010001ULL,
+        0x0001000000010100ULL, 0x0001000100010100ULL, 0x0001000000010101ULL, 0x0001000100010101ULL,
+        0x0001010000010100ULL, 0x0001010100010100ULL, 0x0001010000010101ULL, 0x0001010100010101ULL,
+        0x0100000000000000ULL, 0x0100000100000000ULL, 0x0100000000000001ULL, 0x0100000100000001ULL,
+        0x0100010000000000ULL, 0x0100010100000000ULL, 0x0100010000000001ULL, 0x0100010100000001ULL,
+        0x0100000000000100ULL, 0x0100000100000100ULL, 0x0100000000000101ULL, 0x0100000100000101ULL,
+        0x0100010000000100ULL, 0x0100010100000100ULL, 0x0100010000000101ULL, 0x0100010100000101ULL,
+        0x0101000000000000ULL, 0x0101000100000000ULL, 0x0101000000000001ULL, 0x0101000100000001ULL,
+        0x0101010000000000ULL, 0x0101010100000000ULL, 0x0101010000000001ULL, 0x0101010100000001ULL,
+        0x0101000000000100ULL, 0x0101000100000100ULL, 0x0101000000000101ULL, 0x0101000100000101ULL,
+        0x0101010000000100ULL, 0x0101010100000100ULL, 0x0101010000000101ULL, 0x0101010100000101ULL,
+        0x0100000000010000ULL, 0x0100000100010000ULL, 0x0100000000010001ULL, 0x0100000100010001ULL,
+        0x0100010000010000ULL, 0x0100010100010000ULL, 0x0100010000010001ULL, 0x0100010100010001ULL,
+        0x0100000000010100ULL, 0x0100000100010100ULL, 0x0100000000010101ULL, 0x0100000100010101ULL,
+        0x0100010000010100ULL, 0x0100010100010100ULL, 0x0100010000010101ULL, 0x0100010100010101ULL,
+        0x0101000000010000ULL, 0x0101000100010000ULL, 0x0101000000010001ULL, 0x0101000100010001ULL,
+        0x0101010000010000ULL, 0x0101010100010000ULL, 0x0101010000010001ULL, 0x0101010100010001ULL,
+        0x0101000000010100ULL, 0x0101000100010100ULL, 0x0101000000010101ULL, 0x0101000100010101ULL,
+        0x0101010000010100ULL, 0x0101010100010100ULL, 0x0101010000010101ULL, 0x0101010100010101ULL,
+        0x0000000001000000ULL, 0x0000000101000000ULL, 0x0000000001000001ULL, 0x0000000101000001ULL,
+        0x0000010001000000ULL, 0x0000010101000000ULL, 0x0000010001000001ULL, 0x0000010101000001ULL,
+        0x0000000001000100ULL, 0x0000000101000100ULL, 0x0000000001000101ULL, 0x0000000101000101ULL,
+        0x0000010001000100ULL, 0x0000010101000100ULL, 0x0000010001000101ULL, 0x0000010101000101ULL,
+        0x0001000001000000ULL, 0x0001000101000000ULL, 0x0001000001000001ULL, 0x0001000101000001ULL,
+        0x0001010001000000ULL, 0x0001010101000000ULL, 0x0001010001000001ULL, 0x0001010101000001ULL,
+        0x0001000001000100ULL, 0x0001000101000100ULL, 0x0001000001000101ULL, 0x0001000101000101ULL,
+        0x0001010001000100ULL, 0x0001010101000100ULL, 0x0001010001000101ULL, 0x0001010101000101ULL,
+        0x0000000001010000ULL, 0x0000000101010000ULL, 0x0000000001010001ULL, 0x0000000101010001ULL,
+        0x0000010001010000ULL, 0x0000010101010000ULL, 0x0000010001010001ULL, 0x0000010101010001ULL,
+        0x0000000001010100ULL, 0x0000000101010100ULL, 0x0000000001010101ULL, 0x0000000101010101ULL,
+        0x0000010001010100ULL, 0x0000010101010100ULL, 0x0000010001010101ULL, 0x0000010101010101ULL,
+        0x0001000001010000ULL, 0x0001000101010000ULL, 0x0001000001010001ULL, 0x0001000101010001ULL,
+        0x0001010001010000ULL, 0x0001010101010000ULL, 0x0001010001010001ULL, 0x0001010101010001ULL,
+        0x0001000001010100ULL, 0x0001000101010100ULL, 0x0001000001010101ULL, 0x0001000101010101ULL,
+        0x0001010001010100ULL, 0x0001010101010100ULL, 0x0001010001010101ULL, 0x0001010101010101ULL,
+        0x0100000001000000ULL, 0x0100000101000000ULL, 0x0100000001000001ULL, 0x0100000101000001ULL,
+        0x0100010001000000ULL, 0x0100010101000000ULL, 0x0100010001000001ULL, 0x0100010101000001ULL,
+        0x0100000001000100ULL, 0x0100000101000100ULL, 0x0100000001000101ULL, 0x0100000101000101ULL,
+        0x0100010001000100ULL, 0x0100010101000100ULL, 0x0100010001000101ULL, 0x0100010101000101ULL,
+        0x0101000001000000ULL, 0x0101000101000000ULL, 0x0101000001000001ULL, 0x0101000101000001ULL,
+        0x0101010001000000ULL, 0x0101010101000000ULL, 0x0101010001000001ULL, 0x0101010101000001ULL,
+        0x0101000001000100ULL, 0x0101000101000100ULL, 0x0101000001000101ULL, 0x0101000101000101ULL,
+        0x0101010001000100ULL, 0x0101010101000100ULL, 0x0101010001000101ULL, 0x0101010101000101ULL,
+        0x0100000001010000ULL, 0x0100000101010000ULL, 0x0100000001010001ULL, 0x0100000101010001ULL,
+        0x0100010001010000ULL, 0x0100010101010000ULL, 0x0100010001010001ULL, 0x0100010101010001ULL,
+        0x0100000001010100ULL, 0x0100000101010100ULL, 0x0100000001010101ULL, 0x0100000101010101ULL,
+        0x0100010001010100ULL, 0x0100010101010100ULL, 0x0100010001010101ULL, 0x0100010101010101ULL,
+        0x0101000001010000ULL, 0x0101000101010000ULL, 0x0101000001010001ULL, 0x0101000101010001ULL,
+        0x0101010001010000ULL, 0x0101010101010000ULL, 0x0101010001010001ULL, 0x0101010101010001ULL,
+        0x0101000001010100ULL, 0x0101000101010100ULL, 0x0101000001010101ULL, 0x0101000101010101ULL,
+        0x0101010001010100ULL, 0x0101010101010100ULL, 0x0101010001010101ULL, 0x0101010101010101ULL},
+    {
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000002ULL, 0x0000000200000002ULL,
+        0x0000020000000000ULL, 0x0000020200000000ULL, 0x0000020000000002ULL, 0x0000020200000002ULL,
+        0x0000000000000200ULL, 0x0000000200000200ULL, 0x0000000000000202ULL, 0x0000000200000202ULL,
+        0x0000020000000200ULL, 0x0000020200000200ULL, 0x0000020000000202ULL, 0x0000020200000202ULL,
+        0x0002000000000000ULL, 0x0002000200000000ULL, 0x0002000000000002ULL, 0x0002000200000002ULL,
+        0x0002020000000000ULL, 0x0002020200000000ULL, 0x0002020000000002ULL, 0x0002020200000002ULL,
+        0x0002000000000200ULL, 0x0002000200000200ULL, 0x0002000000000202ULL, 0x0002000200000202ULL,
+        0x0002020000000200ULL, 0x0002020200000200ULL, 0x0002020000000202ULL, 0x0002020200000202ULL,
+        0x0000000000020000ULL, 0x0000000200020000ULL, 0x0000000000020002ULL, 0x0000000200020002ULL,
+        0x0000020000020000ULL, 0x0000020200020000ULL, 0x0000020000020002ULL, 0x0000020200020002ULL,
+        0x0000000000020200ULL, 0x0000000200020200ULL, 0x0000000000020202ULL, 0x0000000200020202ULL,
+        0x0000020000020200ULL, 0x0000020200020200ULL, 0x0000020000020202ULL, 0x0000020200020202ULL,
+        0x0002000000020000ULL, 0x0002000200020000ULL, 0x0002000000020002ULL, 0x0002000200020002ULL,
+        0x0002020000020000ULL, 0x0002020200020000ULL, 0x0002020000020002ULL, 0x0002020200020002ULL,
+        0x0002000000020200ULL, 0x0002000200020200ULL, 0x0002000000020202ULL, 0x0002000200020202ULL,
+        0x0002020000020200ULL, 0x0002020200020200ULL, 0x0002020000020202ULL, 0x0002020200020202ULL,
+        0x0200000000000000ULL, 0x0200000200000000ULL, 0x0200000000000002ULL, 0x0200000200000002ULL,
+        0x0200020000000000ULL, 0x0200020200000000ULL, 0x0200020000000002ULL, 0x0200020200000002ULL,
+        0x0200000000000200ULL, 0x0200000200000200ULL, 0x0200000000000202ULL, 0x0200000200000202ULL,
+        0x0200020000000200ULL, 0x0200020200000200ULL, 0x0200020000000202ULL, 0x0200020200000202ULL,
+        0x0202000000000000ULL, 0x0202000200000000ULL, 0x0202000000000002ULL, 0x0202000200000002ULL,
+        0x0202020000000000ULL, 0x0202020200000000ULL, 0x0202020000000002ULL, 0x0202020200000002ULL,
+        0x0202000000000200ULL, 0x0202000200000200ULL, 0x0202000000000202ULL, 0x0202000200000202ULL,
+        0x0202020000000200ULL, 0x0202020200000200ULL, 0x0202020000000202ULL, 0x0202020200000202ULL,
+        0x0200000000020000ULL, 0x0200000200020000ULL, 0x0200000000020002ULL, 0x0200000200020002ULL,
+        0x0200020000020000ULL, 0x0200020200020000ULL, 0x0200020000020002ULL, 0x0200020200020002ULL,
+        0x0200000000020200ULL, 0x0200000200020200ULL, 0x0200000000020202ULL, 0x0200000200020202ULL,
+        0x0200020000020200ULL, 0x0200020200020200ULL, 0x0200020000020202ULL, 0x0200020200020202ULL,
+        0x0202000000020000ULL, 0x0202000200020000ULL, 0x0202000000020002ULL, 0x0202000200020002ULL,
+        0x0202020000020000ULL, 0x0202020200020000ULL, 0x0202020000020002ULL, 0x0202020200020002ULL,
+        0x0202000000020200ULL, 0x0202000200020200ULL, 0x0202000000020202ULL, 0x0202000200020202ULL,
+        0x0202020000020200ULL, 0x0202020200020200ULL, 0x0202020000020202ULL, 0x0202020200020202ULL,
+        0x0000000002000000ULL, 0x0000000202000000ULL, 0x0000000002000002ULL, 0x0000000202000002ULL,
+        0x0000020002000000ULL, 0x0000020202000000ULL, 0x0000020002000002ULL, 0x0000020202000002ULL,
+        0x0000000002000200ULL, 0x0000000202000200ULL, 0x0000000002000202ULL, 0x0000000202000202ULL,
+        0x0000020002000200ULL, 0x0000020202000200ULL, 0x0000020002000202ULL, 0x0000020202000202ULL,
+        0x0002000002000000ULL, 0x0002000202000000ULL, 0x0002000002000002ULL, 0x0002000202000002ULL,
+        0x0002020002000000ULL, 0x0002020202000000ULL, 0x0002020002000002ULL, 0x0002020202000002ULL,
+        0x0002000002000200ULL, 0x0002000202000200ULL, 0x0002000002000202ULL, 0x0002000202000202ULL,
+        0x0002020002000200ULL, 0x0002020202000200ULL, 0x0002020002000202ULL, 0x0002020202000202ULL,
+        0x0000000002020000ULL, 0x0000000202020000ULL, 0x0000000002020002ULL, 0x0000000202020002ULL,
+        0x0000020002020000ULL, 0x0000020202020000ULL, 0x0000020002020002ULL, 0x0000020202020002ULL,
+        0x0000000002020200ULL, 0x0000000202020200ULL, 0x0000000002020202ULL, 0x0000000202020202ULL,
+        0x0000020002020200ULL, 0x0000020202020200ULL, 0x0000020002020202ULL, 0x0000020202020202ULL,
+        0x0002000002020000ULL, 0x0002000202020000ULL, 0x0002000002020002ULL, 0x0002000202020002ULL,
+        0x0002020002020000ULL, 0x0002020202020000ULL, 0x0002020002020002ULL, 0x0002020202020002ULL,
+        0x0002000002020200ULL, 0x0002000202020200ULL, 0x0002000002020202ULL, 0x0002000202020202ULL,
+        0x0002020002020200ULL, 0x0002020202020200ULL, 0x0002020002020202ULL, 0x0002020202020202ULL,
+        0x0200000002000000ULL, 0x0200000202000000ULL, 0x0200000002000002ULL, 0x0200000202000002ULL,
+        0x0200020002000000ULL, 0x0200020202000000ULL, 0x0200020002000002ULL, 0x0200020202000002ULL,
+        0x0200000002000200ULL, 0x0200000202000200ULL, 0x0200000002000202ULL, 0x0200000202000202ULL,
+        0x0200020002000200ULL, 0x0200020202000200ULL, 0x0200020002000202ULL, 0x0200020202000202ULL,
+        0x0202000002000000ULL, 0x0202000202000000ULL, 0x0202000002000002ULL, 0x0202000202000002ULL,
+        0x0202020002000000ULL, 0x0202020202000000ULL, 0x0202020002000002ULL, 0x0202020202000002ULL,
+        0x0202000002000200ULL, 0x0202000202000200ULL, 0x0202000002000202ULL, 0x0202000202000202ULL,
+        0x0202020002000200ULL, 0x0202020202000200ULL, 0x0202020002000202ULL, 0x0202020202000202ULL,
+        0x0200000002020000ULL, 0x0200000202020000ULL, 0x0200000002020002ULL, 0x0200000202020002ULL,
+        0x0200020002020000ULL, 0x0200020202020000ULL, 0x0200020002020002ULL, 0x0200020202020002ULL,
+        0x0200000002020200ULL, 0x0200000202020200ULL, 0x0200000002020202ULL, 0x0200000202020202ULL,
+        0x0200020002020200ULL, 0x0200020202020200ULL, 0x0200020002020202ULL, 0x0200020202020202ULL,
+        0x0202000002020000ULL, 0x0202000202020000ULL, 0x0202000002020002ULL, 0x0202000202020002ULL,
+        0x0202020002020000ULL, 0x0202020202020000ULL, 0x0202020002020002ULL, 0x0202020202020002ULL,
+        0x0202000002020200ULL, 0x0202000202020200ULL, 0x0202000002020202ULL, 0x0202000202020202ULL,
+        0x0202020002020200ULL, 0x0202020202020200ULL, 0x0202020002020202ULL, 0x0202020202020202ULL},
+    {
+        0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000004ULL, 0x0000000400000004ULL,
+        0x0000040000000000ULL, 0x0000040400000000ULL, 0x0000040000000004ULL, 0x0000040400000004ULL,
+        0x0000000000000400ULL, 0x0000000400000400ULL, 0x0000000000000404ULL, 0x0000000400000404ULL,
+        0x0000040000000400ULL, 0x0000040400000400ULL, 0x0000040000000404ULL, 0x0000040400000404ULL,
+        0x0004000000000000ULL, 0x0004000400000000ULL, 0x0004000000000004ULL, 0x0004000400000004ULL,
+        0x0004040000000000ULL, 0x0004040400000000ULL, 0x0004040000000004ULL, 0x0004040400000004ULL,
+        0x0004000000000400ULL, 0x0004000400000400ULL, 0x0004000000000404ULL, 0x0004000400000404ULL,
+        0x0004040000000400ULL, 0x0004040400000400ULL, 0x0004040000000404ULL, 0x0004040400000404ULL,
+        0x0000000000040000ULL, 0x0000000400040000ULL, 0x0000000000040004ULL, 0x0000000400040004ULL,
+        0x0000040000040000ULL, 0x0000040400040000ULL, 0x0000040000040004ULL, 0x0000040400040004ULL,
+        0x0000000000040400ULL, 0x0000000400040400ULL, 0x0000000000040404ULL, 0x0000000400040404ULL,
+        0x0000040000040400ULL, 0x0000040400040400ULL, 0x0000040000040404ULL, 0x0000040400040404ULL,
+        0x0004000000040000ULL, 0x0004000400040000ULL, 0x0004000000040004ULL, 0x0004000400040004ULL,
+        0x0004040000040000ULL, 0x0004040400040000ULL, 0x0004040000040004ULL, 0x0004040400040004ULL,
+        0x0004000000040400ULL, 0x0004000400040400ULL, 0x0004000000040404ULL, 0x0004000400040404ULL,
+        0x0004040000040400ULL, 0x0004040400040400ULL, 0x0004040000040404ULL, 0x0004040400040404ULL,
+        0x0400000000000000ULL, 0x0400000400000000ULL, 0x0400000000000004ULL, 0x0400000400000004ULL,
+        0x0400040000000000ULL, 0x0400040400000000ULL, 0x0400040000000004ULL, 0x0400040400000004ULL,
+        0x0400000000000400ULL, 0x0400000400000400ULL, 0x0400000000000404ULL, 0x0400000400000404ULL,
+        0x0400040000000400ULL, 0x0400040400000400ULL, 0x0400040000000404ULL, 0x0400040400000404ULL,
+        0x0404000000000000ULL, 0x0404000400000000ULL, 0x0404000000000004ULL, 0x0404000400000004ULL,
+        0x0404040000000000ULL, 0x0404040400000000ULL, 0x0404040000000004ULL, 0x0404040400000004ULL,
+        0x0404000000000400ULL, 0x0404000400000400ULL, 0x0404000000000404ULL, 0x0404000400000404ULL,
+        0x0404040000000400ULL, 0x0404040400000400ULL, 0x0404040000000404ULL, 0x0404040400000404ULL,
+        0x0400000000040000ULL, 0x0400000400040000ULL, 0x0400000000040004ULL, 0x0400000400040004ULL,
+        0x0400040000040000ULL, 0x0400040400040000ULL, 0x0400040000040004ULL, 0x0400040400040004ULL,
+        0x0400000000040400ULL, 0x0400000400040400ULL, 0x0400000000040404ULL, 0x0400000400040404ULL,
+        0x0400040000040400ULL, 0x0400040400040400ULL, 0x0400040000040404ULL, 0x0400040400040404ULL,
+        0x0404000000040000ULL, 0x0404000400040000ULL, 0x0404000000040004ULL, 0x0404000400040004ULL,
+        0x0404040000040000ULL, 0x0404040400040000ULL, 0x0404040000040004ULL, 0x0404040400040004ULL,
+        0x0404000000040400ULL, 0x0404000400040400ULL, 0x0404000000040404ULL, 0x0404000400040404ULL,
+        0x0404040000040400ULL, 0x0404040400040400ULL, 0x0404040000040404ULL, 0x0404040400040404ULL,
+        0x0000000004000000ULL, 0x0000000404000000ULL, 0x0000000004000004ULL, 0x0000000404000004ULL,
+        0x0000040004000000ULL, 0x0000040404000000ULL, 0x0000040004000004ULL, 0x0000040404000004ULL,
+        0x0000000004000400ULL, 0x0000000404000400ULL, 0x0000000004000404ULL, 0x0000000404000404ULL,
+        0x0000040004000400ULL, 0x0000040404000400ULL, 0x0000040004000404ULL, 0x0000040404000404ULL,
+        0x0004000004000000ULL, 0x0004000404000000ULL, 0x0004000004000004ULL, 0x0004000404000004ULL,
+        0x0004040004000000ULL, 0x0004040404000000ULL, 0x0004040004000004ULL, 0x0004040404000004ULL,
+        0x0004000004000400ULL, 0x0004000404000400ULL, 0x0004000004000404ULL, 0x0004000404000404ULL,
+        0x0004040004000400ULL, 0x0004040404000400ULL, 0x0004040004000404ULL, 0x0004040404000404ULL,
+        0x0000000004040000ULL, 0x0000000404040000ULL, 0x0000000004040004ULL, 0x0000000404040004ULL,
+        0x0000040004040000ULL, 0x0000040404040000ULL, 0x0000040004040004ULL, 0x0000040404040004ULL,
+        0x0000000004040400ULL, 0x0000000404040400ULL, 0x0000000004040404ULL, 0x0000000404040404ULL,
+        0x0000040004040400ULL, 0x0000040404040400ULL, 0x0000040004040404ULL, 0x0000040404040404ULL,
+        0x0004000004040000ULL, 0x0004000404040000ULL, 0x0004000004040004ULL, 0x0004000404040004ULL,
+        0x0004040004040000ULL, 0x0004040404040000ULL, 0x0004040004040004ULL, 0x0004040404040004ULL,
+        0x0004000004040400ULL, 0x0004000404040400ULL, 0x0004000004040404ULL, 0x0004000404040404ULL,
+        0x0004040004040400ULL, 0x0004040404040400ULL, 0x0004040004040404ULL, 0x0004040404040404ULL,
+        0x0400000004000000ULL, 0x0400000404000000ULL, 0x0400000004000004ULL, 0x0400000404000004ULL,
+        0x0400040004000000ULL, 0x0400040404000000ULL, 0x0400040004000004ULL, 0x0400040404000004ULL,
+        0x0400000004000400ULL, 0x0400000404000400ULL, 0x0400000004000404ULL, 0x0400000404000404ULL,
+        0x0400040004000400ULL, 0x0400040404000400ULL, 0x0400040004000404ULL, 0x0400040404000404ULL,
+        0x0404000004000000ULL, 0x0404000404000000ULL, 0x0404000004000004ULL, 0x0404000404000004ULL,
+        0x0404040004000000ULL, 0x0404040404000000ULL, 0x0404040004000004ULL, 0x0404040404000004ULL,
+        0x0404000004000400ULL, 0x0404000404000400ULL, 0x0404000004000404ULL, 0x0404000404000404ULL,
+        0x0404040004000400ULL, 0x0404040404000400ULL, 0x0404040004000404ULL, 0x0404040404000404ULL,
+        0x0400000004040000ULL, 0x0400000404040000ULL, 0x0400000004040004ULL, 0x0400000404040004ULL,
+        0x0400040004040000ULL, 0x0400040404040000ULL, 0x0400040004040004ULL, 0x0400040404040004ULL,
+        0x0400000004040400ULL, 0x0400000404040400ULL, 0x0400000004040404ULL, 0x0400000404040404ULL,
+        0x0400040004040400ULL, 0x0400040404040400ULL, 0x0400040004040404ULL, 0x0400040404040404ULL,
+        0x0404000004040000ULL, 0x0404000404040000ULL, 0x0404000004040004ULL, 0x0404000404040004ULL,
+        0x0404040004040000ULL, 0x0404040404040000ULL, 0x0404040004040004ULL, 0x0404040404040004ULL,
+        0x0404000004040400ULL, 0x0404000404040400ULL, 0x0404000004040404ULL, 0x0404000404040404ULL,
+        0x0404040004040400ULL, 0x0404040404040400ULL, 0x0404040004040404ULL, 0x0404040404040404ULL},
+    {
+        0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000008ULL, 0x0000000800000008ULL,
+        0x0000080000000000ULL, 0x0000080800000000ULL, 0x0000080000000008ULL, 0x0000080800000008ULL,
+        0x0000000000000800ULL, 0x0000000800000800ULL, 0x0000000000000808ULL, 0x0000000800000808ULL,
+        0x0000080000000800ULL, 0x0000080800000800ULL, 0x0000080000000808ULL, 0x0000080800000808ULL,
+        0x0008000000000000ULL, 0x0008000800000000ULL, 0x0008000000000008ULL, 0x0008000800000008ULL,
+        0x0008080000000000ULL, 0x0008080800000000ULL, 0x0008080000000008ULL, 0x0008080800000008ULL,
+        0x0008000000000800ULL, 0x0008000800000800ULL, 0x0008000000000808ULL, 0x0008000800000808ULL,
+        0x0008080000000800ULL, 0x0008080800000800ULL, 0x0008080000000808ULL, 0x0008080800000808ULL,
+        0x0000000000080000ULL, 0x0000000800080000ULL, 0x0000000000080008ULL, 0x0000000800080008ULL,
+        0x0000080000080000ULL, 0x0000080800080000ULL, 0x0000080000080008ULL, 0x0000080800080008ULL,
+        0x0000000000080800ULL, 0x0000000800080800ULL, 0x0000000000080808ULL, 0x0000000800080808ULL,
+        0x0000080000080800ULL, 0x0000080800080800ULL, 0x0000080000080808ULL, 0x0000080800080808ULL,
+        0x0008000000080000ULL, 0x0008000800080000ULL, 0x0008000000080008ULL, 0x0008000800080008ULL,
+        0x0008080000080000ULL, 0x0008080800080000ULL, 0x0008080000080008ULL, 0x0008080800080008ULL,
+        0x0008000000080800ULL, 0x0008000800080800ULL, 0x0008000000080808ULL, 0x0008000800080808ULL,
+        0x0008080000080800ULL, 0x0008080800080800ULL, 0x0008080000080808ULL, 0x0008080800080808ULL,
+        0x0800000000000000ULL, 0x0800000800000000ULL, 0x0800000000000008ULL, 0x0800000800000008ULL,
+        0x0800080000000000ULL, 0x0800080800000000ULL, 0x0800080000000008ULL, 0x0800080800000008ULL,
+        0x0800000000000800ULL, 0x0800000800000800ULL, 0x0800000000000808ULL, 0x0800000800000808ULL,
+        0x0800080000000800ULL, 0x0800080800000800ULL, 0x0800080000000808ULL, 0x0800080800000808ULL,
+        0x0808000000000000ULL, 0x0808000800000000ULL, 0x0808000000000008ULL, 0x0808000800000008ULL,
+        0x0808080000000000ULL, 0x0808080800000000ULL, 0x0808080000000008ULL, 0x0808080800000008ULL,
+        0x0808000000000800ULL, 0x0808000800000800ULL, 0x0808000000000808ULL, 0x0808000800000808ULL,
+        0x0808080000000800ULL, 0x0808080800000800ULL, 0x0808080000000808ULL, 0x0808080800000808ULL,
+        0x0800000000080000ULL, 0x0800000800080000ULL, 0x0800000000080008ULL, 0x0800000800080008ULL,
+        0x0800080000080000ULL, 0x0800080800080000ULL, 0x0800080000080008ULL, 0x0800080800080008ULL,
+        0x0800000000080800ULL, 0x0800000800080800ULL, 0x0800000000080808ULL, 0x0800000800080808ULL,
+        0x0800080000080800ULL, 0x0800080800080800ULL, 0x0800080000080808ULL, 0x0800080800080808ULL,
+        0x0808000000080000ULL, 0x0808000800080000ULL, 0x0808000000080008ULL, 0x0808000800080008ULL,
+        0x0808080000080000ULL, 0x0808080800080000ULL, 0x0808080000080008ULL, 0x0808080800080008ULL,
+        0x0808000000080800ULL, 0x0808000800080800ULL, 0x0808000000080808ULL, 0x0808000800080808ULL,
+        0x0808080000080800ULL, 0x0808080800080800ULL, 0x0808080000080808ULL, 0x0808080800080808ULL,
+        0x0000000008000000ULL, 0x0000000808000000ULL, 0x0000000008000008ULL, 0x0000000808000008ULL,
+        0x0000080008000000ULL, 0x0000080808000000ULL, 0x0000080008000008ULL, 0x0000080808000008ULL,
+        0x0000000008000800ULL, 0x0000000808000800ULL, 0x0000000008000808ULL, 0x0000000808000808ULL,
+        0x0000080008000800ULL, 0x0000080808000800ULL, 0x0000080008000808ULL, 0x0000080808000808ULL,
+        0x0008000008000000ULL, 0x0008000808000000ULL, 0x0008000008000008ULL, 0x0008000808000008ULL,
+        0x0008080008000000ULL, 0x0008080808000000ULL, 0x0008080008000008ULL, 0x0008080808000008ULL,
+        0x0008000008000800ULL, 0x0008000808000800ULL, 0x0008000008000808ULL, 0x0008000808000808ULL,
+        0x0008080008000800ULL, 0x0008080808000800ULL, 0x0008080008000808ULL, 0x0008080808000808ULL,
+        0x0000000008080000ULL, 0x0000000808080000ULL, 0x0000000008080008ULL, 0x0000000808080008ULL,
+        0x0000080008080000ULL, 0x0000080808080000ULL, 0x0000080008080008ULL, 0x0000080808080008ULL,
+        0x0000000008080800ULL, 0x0000000808080800ULL, 0x0000000008080808ULL, 0x0000000808080808ULL,
+        0x0000080008080800ULL, 0x0000080808080800ULL, 0x0000080008080808ULL, 0x0000080808080808ULL,
+        0x0008000008080000ULL, 0x0008000808080000ULL, 0x0008000008080008ULL, 0x0008000808080008ULL,
+        0x0008080008080000ULL, 0x0008080808080000ULL, 0x0008080008080008ULL, 0x0008080808080008ULL,
+        0x0008000008080800ULL, 0x0008000808080800ULL, 0x0008000008080808ULL, 0x0008000808080808ULL,
+        0x0008080008080800ULL, 0x0008080808080800ULL, 0x0008080008080808ULL, 0x0008080808080808ULL,
+        0x0800000008000000ULL, 0x0800000808000000ULL, 0x0800000008000008ULL, 0x0800000808000008ULL,
+        0x0800080008000000ULL, 0x0800080808000000ULL, 0x0800080008000008ULL, 0x0800080808000008ULL,
+        0x0800000008000800ULL, 0x0800000808000800ULL, 0x0800000008000808ULL, 0x0800000808000808ULL,
+        0x0800080008000800ULL, 0x0800080808000800ULL, 0x0800080008000808ULL, 0x0800080808000808ULL,
+        0x0808000008000000ULL, 0x0808000808000000ULL, 0x0808000008000008ULL, 0x0808000808000008ULL,
+        0x0808080008000000ULL, 0x0808080808000000ULL, 0x0808080008000008ULL, 0x0808080808000008ULL,
+        0x0808000008000800ULL, 0x0808000808000800ULL, 0x0808000008000808ULL, 0x0808000808000808ULL,
+        0x0808080008000800ULL, 0x0808080808000800ULL, 0x0808080008000808ULL, 0x0808080808000808ULL,
+        0x0800000008080000ULL, 0x0800000808080000ULL, 0x0800000008080008ULL, 0x0800000808080008ULL,
+        0x0800080008080000ULL, 0x0800080808080000ULL, 0x0800080008080008ULL, 0x0800080808080008ULL,
+        0x0800000008080800ULL, 0x0800000808080800ULL, 0x0800000008080808ULL, 0x0800000808080808ULL,
+        0x0800080008080800ULL, 0x0800080808080800ULL, 0x0800080008080808ULL, 0x0800080808080808ULL,
+        0x0808000008080000ULL, 0x0808000808080000ULL, 0x0808000008080008ULL, 0x0808000808080008ULL,
+        0x0808080008080000ULL, 0x0808080808080000ULL, 0x0808080008080008ULL, 0x0808080808080008ULL,
+        0x0808000008080800ULL, 0x0808000808080800ULL, 0x0808000008080808ULL, 0x0808000808080808ULL,
+        0x0808080008080800ULL, 0x0808080808080800ULL, 0x0808080008080808ULL, 0x0808080808080808ULL},
+    {
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000010ULL, 0x0000001000000010ULL,
+        0x0000100000000000ULL, 0x0000101000000000ULL, 0x0000100000000010ULL, 0x0000101000000010ULL,
+        0x0000000000001000ULL, 0x0000001000001000ULL, 0x0000000000001010ULL, 0x0000001000001010ULL,
+        0x0000100000001000ULL, 0x0000101000001000ULL, 0x0000100000001010ULL, 0x0000101000001010ULL,
+        0x0010000000000000ULL, 0x0010001000000000ULL, 0x0010000000000010ULL, 0x0010001000000010ULL,
+        0x0010100000000000ULL, 0x0010101000000000ULL, 0x0010100000000010ULL, 0x0010101000000010ULL,
+        0x0010000000001000ULL, 0x0010001000001000ULL, 0x0010000000001010ULL, 0x0010001000001010ULL,
+        0x0010100000001000ULL, 0x0010101000001000ULL, 0x0010100000001010ULL, 0x0010101000001010ULL,
+        0x0000000000100000ULL, 0x0000001000100000ULL, 0x0000000000100010ULL, 0x0000001000100010ULL,
+        0x0000100000100000ULL, 0x0000101000100000ULL, 0x0000100000100010ULL, 0x0000101000100010ULL,
+        0x0000000000101000ULL, 0x0000001000101000ULL, 0x0000000000101010ULL, 0x0000001000101010ULL,
+        0x0000100000101000ULL, 0x0000101000101000ULL, 0x0000100000101010ULL, 0x0000101000101010ULL,
+        0x0010000000100000ULL, 0x0010001000100000ULL, 0x0010000000100010ULL, 0x0010001000100010ULL,
+        0x0010100000100000ULL, 0x0010101000100000ULL, 0x0010100000100010ULL, 0x0010101000100010ULL,
+        0x0010000000101000ULL, 0x0010001000101000ULL, 0x0010000000101010ULL, 0x0010001000101010ULL,
+        0x0010100000101000ULL, 0x0010101000101000ULL, 0x0010100000101010ULL, 0x0010101000101010ULL,
+        0x1000000000000000ULL, 0x1000001000000000ULL, 0x1000000000000010ULL, 0x1000001000000010ULL,
+        0x1000100000000000ULL, 0x1000101000000000ULL, 0x1000100000000010ULL, 0x1000101000000010ULL,
+        0x1000000000001000ULL, 0x1000001000001000ULL, 0x1000000000001010ULL, 0x1000001000001010ULL,
+        0x1000100000001000ULL, 0x1000101000001000ULL, 0x1000100000001010ULL, 0x1000101000001010ULL,
+        0x1010000000000000ULL, 0x1010001000000000ULL, 0x1010000000000010ULL, 0x1010001000000010ULL,
+        0x1010100000000000ULL, 0x1010101000000000ULL, 0x1010100000000010ULL, 0x1010101000000010ULL,
+        0x1010000000001000ULL, 0x1010001000001000ULL, 0x1010000000001010ULL, 0x1010001000001010ULL,
+        0x1010100000001000ULL, 0x1010101000001000ULL, 0x1010100000001010ULL, 0x1010101000001010ULL,
+        0x1000000000100000ULL, 0x1000001000100000ULL, 0x1000000000100010ULL, 0x1000001000100010ULL,
+        0x1000100000100000ULL, 0x1000101000100000ULL, 0x1000100000100010ULL, 0x1000101000100010ULL,
+        0x1000000000101000ULL, 0x1000001000101000ULL, 0x1000000000101010ULL, 0x1000001000101010ULL,
+        0x1000100000101000ULL, 0x1000101000101000ULL, 0x1000100000101010ULL, 0x1000101000101010ULL,
+        0x1010000000100000ULL, 0x1010001000100000ULL, 0x1010000000100010ULL, 0x1010001000100010ULL,
+        0x1010100000100000ULL, 0x1010101000100000ULL, 0x1010100000100010ULL, 0x1010101000100010ULL,
+        0x1010000000101000ULL, 0x1010001000101000ULL, 0x1010000000101010ULL, 0x1010001000101010ULL,
+        0x1010100000101000ULL, 0x1010101000101000ULL, 0x1010100000101010ULL, 0x1010101000101010ULL,
+        0x0000000010000000ULL, 0x0000001010000000ULL, 0x0000000010000010ULL, 0x0000001010000010ULL,
+        0x0000100010000000ULL, 0x0000101010000000ULL, 0x0000100010000010ULL, 0x0000101010000010ULL,
+        0x0000000010001000ULL, 0x0000001010001000ULL, 0x0000000010001010ULL, 0x0000001010001010ULL,
+        0x0000100010001000ULL, 0x0000101010001000ULL, 0x0000100010001010ULL, 0x0000101010001010ULL,
+        0x0010000010000000ULL, 0x0010001010000000ULL, 0x0010000010000010ULL, 0x0010001010000010ULL,
+        0x0010100010000000ULL, 0x0010101010000000ULL, 0x0010100010000010ULL, 0x0010101010000010ULL,
+        0x0010000010001000ULL, 0x0010001010001000ULL, 0x0010000010001010ULL, 0x0010001010001010ULL,
+        0x0010100010001000ULL, 0x0010101010001000ULL, 0x0010100010001010ULL, 0x0010101010001010ULL,
+        0x0000000010100000ULL, 0x0000001010100000ULL, 0x0000000010100010ULL, 0x0000001010100010ULL,
+        0x0000100010100000ULL, 0x0000101010100000ULL, 0x0000100010100010ULL, 0x0000101010100010ULL,
+        0x0000000010101000ULL, 0x0000001010101000ULL, 0x0000000010101010ULL, 0x0000001010101010ULL,
+        0x0000100010101000ULL, 0x0000101010101000ULL, 0x0000100010101010ULL, 0x0000101010101010ULL,
+        0x0010000010100000ULL, 0x0010001010100000ULL, 0x0010000010100010ULL, 0x0010001010100010ULL,
+        0x0010100010100000ULL, 0x0010101010100000ULL, 0x0010100010100010ULL, 0x0010101010100010ULL,
+        0x0010000010101000ULL, 0x0010001010101000ULL, 0x0010000010101010ULL, 0x0010001010101010ULL,
+        0x0010100010101000ULL, 0x0010101010101000ULL, 0x0010100010101010ULL, 0x0010101010101010ULL,
+        0x1000000010000000ULL, 0x1000001010000000ULL, 0x1000000010000010ULL, 0x1000001010000010ULL,
+        0x1000100010000000ULL, 0x1000101010000000ULL, 0x1000100010000010ULL, 0x1000101010000010ULL,
+        0x1000000010001000ULL, 0x1000001010001000ULL, 0x1000000010001010ULL, 0x1000001010001010ULL,
+        0x1000100010001000ULL, 0x1000101010001000ULL, 0x1000100010001010ULL, 0x1000101010001010ULL,
+        0x1010000010000000ULL, 0x1010001010000000ULL, 0x1010000010000010ULL, 0x1010001010000010ULL,
+        0x1010100010000000ULL, 0x1010101010000000ULL, 0x1010100010000010ULL, 0x1010101010000010ULL,
+        0x1010000010001000ULL, 0x1010001010001000ULL, 0x1010000010001010ULL, 0x1010001010001010ULL,
+        0x1010100010001000ULL, 0x1010101010001000ULL, 0x1010100010001010ULL, 0x1010101010001010ULL,
+        0x1000000010100000ULL, 0x1000001010100000ULL, 0x1000000010100010ULL, 0x1000001010100010ULL,
+        0x1000100010100000ULL, 0x1000101010100000ULL, 0x1000100010100010ULL, 0x1000101010100010ULL,
+        0x1000000010101000ULL, 0x1000001010101000ULL, 0x1000000010101010ULL, 0x1000001010101010ULL,
+        0x1000100010101000ULL, 0x1000101010101000ULL, 0x1000100010101010ULL, 0x1000101010101010ULL,
+        0x1010000010100000ULL, 0x1010001010100000ULL, 0x1010000010100010ULL, 0x1010001010100010ULL,
+        0x1010100010100000ULL, 0x1010101010100000ULL, 0x1010100010100010ULL, 0x1010101010100010ULL,
+        0x1010000010101000ULL, 0x1010001010101000ULL, 0x1010000010101010ULL, 0x1010001010101010ULL,
+        0x1010100010101000ULL, 0x1010101010101000ULL, 0x1010100010101010ULL, 0x1010101010101010ULL},
+    {
+        0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000020ULL, 0x0000002000000020ULL,
+        0x0000200000000000ULL, 0x0000202000000000ULL, 0x0000200000000020ULL, 0x0000202000000020ULL,
+        0x0000000000002000ULL, 0x0000002000002000ULL, 0x0000000000002020ULL, 0x0000002000002020ULL,
+        0x0000200000002000ULL, 0x0000202000002000ULL, 0x0000200000002020ULL, 0x0000202000002020ULL,
+        0x0020000000000000ULL, 0x0020002000000000ULL, 0x0020000000000020ULL, 0x0020002000000020ULL,
+        0x0020200000000000ULL, 0x0020202000000000ULL, 0x0020200000000020ULL, 0x0020202000000020ULL,
+        0x0020000000002000ULL, 0x0020002000002000ULL, 0x0020000000002020ULL, 0x0020002000002020ULL,
+        0x0020200000002000ULL, 0x0020202000002000ULL, 0x0020200000002020ULL, 0x0020202000002020ULL,
+        0x0000000000200000ULL, 0x0000002000200000ULL, 0x0000000000200020ULL, 0x0000002000200020ULL,
+        0x0000200000200000ULL, 0x0000202000200000ULL, 0x0000200000200020ULL, 0x0000202000200020ULL,
+        0x0000000000202000ULL, 0x0000002000202000ULL, 0x0000000000202020ULL, 0x0000002000202020ULL,
+        0x0000200000202000ULL, 0x0000202000202000ULL, 0x0000200000202020ULL, 0x0000202000202020ULL,
+        0x0020000000200000ULL, 0x0020002000200000ULL, 0x0020000000200020ULL, 0x0020002000200020ULL,
+        0x0020200000200000ULL, 0x0020202000200000ULL, 0x0020200000200020ULL, 0x0020202000200020ULL,
+        0x0020000000202000ULL, 0x0020002000202000ULL, 0x0020000000202020ULL, 0x0020002000202020ULL,
+        0x0020200000202000ULL, 0x0020202000202000ULL, 0x0020200000202020ULL, 0x0020202000202020ULL,
+        0x2000000000000000ULL, 0x2000002000000000ULL, 0x2000000000000020ULL, 0x2000002000000020ULL,
+        0x2000200000000000ULL, 0x2000202000000000ULL, 0x2000200000000020ULL, 0x2000202000000020ULL,
+        0x2000000000002000ULL, 0x2000002000002000ULL, 0x2000000000002020ULL, 0x2000002000002020ULL,
+        0x2000200000002000ULL, 0x2000202000002000ULL, 0x2000200000002020ULL, 0x2000202000002020ULL,
+        0x2020000000000000ULL, 0x2020002000000000ULL, 0x2020000000000020ULL, 0x2020002000000020ULL,
+        0x2020200000000000ULL, 0x2020202000000000ULL, 0x2020200000000020ULL, 0x2020202000000020ULL,
+        0x2020000000002000ULL, 0x2020002000002000ULL, 0x2020000000002020ULL, 0x2020002000002020ULL,
+        0x2020200000002000ULL, 0x2020202000002000ULL, 0x2020200000002020ULL, 0x2020202000002020ULL,
+        0x2000000000200000ULL, 0x2000002000200000ULL, 0x2000000000200020ULL, 0x2000002000200020ULL,
+        0x2000200000200000ULL, 0x2000202000200000ULL, 0x2000200000200020ULL, 0x2000202000200020ULL,
+        0x2000000000202000ULL, 0x2000002000202000ULL, 0x2000000000202020ULL, 0x2000002000202020ULL,
+        0x2000200000202000ULL, 0x2000202000202000ULL, 0x2000200000202020ULL, 0x2000202000202020ULL,
+        0x2020000000200000ULL, 0x2020002000200000ULL, 0x2020000000200020ULL, 0x2020002000200020ULL,
+        0x2020200000200000ULL, 0x2020202000200000ULL, 0x2020200000200020ULL, 0x2020202000200020ULL,
+        0x2020000000202000ULL, 0x2020002000202000ULL, 0x2020000000202020ULL, 0x2020002000202020ULL,
+        0x2020200000202000ULL, 0x2020202000202000ULL, 0x2020200000202020ULL, 0x2020202000202020ULL,
+        0x0000000020000000ULL, 0x0000002020000000ULL, 0x0000000020000020ULL, 0x0000002020000020ULL,
+        0x0000200020000000ULL, 0x0000202020000000ULL, 0x0000200020000020ULL, 0x0000202020000020ULL,
+        0x0000000020002000ULL, 0x0000002020002000ULL, 0x0000000020002020ULL, 0x0000002020002020ULL,
+        0x0000200020002000ULL, 0x0000202020002000ULL, 0x0000200020002020ULL, 0x0000202020002020ULL,
+        0x0020000020000000ULL, 0x0020002020000000ULL, 0x0020000020000020ULL, 0x0020002020000020ULL,
+        0x0020200020000000ULL, 0x0020202020000000ULL, 0x0020200020000020ULL, 0x0020202020000020ULL,
+        0x0020000020002000ULL, 0x0020002020002000ULL, 0x0020000020002020ULL, 0x0020002020002020ULL,
+        0x0020200020002000ULL, 0x0020202020002000ULL, 0x0020200020002020ULL, 0x0020202020002020ULL,
+        0x0000000020200000ULL, 0x0000002020200000ULL, 0x0000000020200020ULL, 0x0000002020200020ULL,
+        0x0000200020200000ULL, 0x0000202020200000ULL, 0x0000200020200020ULL, 0x0000202020200020ULL,
+        0x0000000020202000ULL, 0x0000002020202000ULL, 0x0000000020202020ULL, 0x0000002020202020ULL,
+        0x0000200020202000ULL, 0x0000202020202000ULL, 0x0000200020202020ULL, 0x0000202020202020ULL,
+        0x0020000020200000ULL, 0x0020002020200000ULL, 0x0020000020200020ULL, 0x0020002020200020ULL,
+        0x0020200020200000ULL, 0x0020202020200000ULL, 0x0020200020200020ULL, 0x0020202020200020ULL,
+        0x0020000020202000ULL, 0x0020002020202000ULL, 0x0020000020202020ULL, 0x0020002020202020ULL,
+        0x0020200020202000ULL, 0x0020202020202000ULL, 0x0020200020202020ULL, 0x0020202020202020ULL,
+        0x2000000020000000ULL, 0x2000002020000000ULL, 0x2000000020000020ULL, 0x2000002020000020ULL,
+        0x2000200020000000ULL, 0x2000202020000000ULL, 0x2000200020000020ULL, 0x2000202020000020ULL,
+        0x2000000020002000ULL, 0x2000002020002000ULL, 0x2000000020002020ULL, 0x2000002020002020ULL,
+        0x2000200020002000ULL, 0x2000202020002000ULL, 0x2000200020002020ULL, 0x2000202020002020ULL,
+        0x2020000020000000ULL, 0x2020002020000000ULL, 0x2020000020000020ULL, 0x2020002020000020ULL,
+        0x2020200020000000ULL, 0x2020202020000000ULL, 0x2020200020000020ULL, 0x2020202020000020ULL,
+        0x2020000020002000ULL, 0x2020002020002000ULL, 0x2020000020002020ULL, 0x2020002020002020ULL,
+        0x2020200020002000ULL, 0x2020202020002000ULL, 0x2020200020002020ULL, 0x2020202020002020ULL,
+        0x2000000020200000ULL, 0x2000002020200000ULL, 0x2000000020200020ULL, 0x2000002020200020ULL,
+        0x2000200020200000ULL, 0x2000202020200000ULL, 0x2000200020200020ULL, 0x2000202020200020ULL,
+        0x2000000020202000ULL, 0x2000002020202000ULL, 0x2000000020202020ULL, 0x2000002020202020ULL,
+        0x2000200020202000ULL, 0x2000202020202000ULL, 0x2000200020202020ULL, 0x2000202020202020ULL,
+        0x2020000020200000ULL, 0x2020002020200000ULL, 0x2020000020200020ULL, 0x2020002020200020ULL,
+        0x2020200020200000ULL, 0x2020202020200000ULL, 0x2020200020200020ULL, 0x2020202020200020ULL,
+        0x2020000020202000ULL, 0x2020002020202000ULL, 0x2020000020202020ULL, 0x2020002020202020ULL,
+        0x2020200020202000ULL, 0x2020202020202000ULL, 0x2020200020202020ULL, 0x2020202020202020ULL},
+    {
+        0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000040ULL, 0x0000004000000040ULL,
+        0x0000400000000000ULL, 0x0000404000000000ULL, 0x0000400000000040ULL, 0x0000404000000040ULL,
+        0x0000000000004000ULL, 0x0000004000004000ULL, 0x0000000000004040ULL, 0x0000004000004040ULL,
+        0x0000400000004000ULL, 0x0000404000004000ULL, 0x0000400000004040ULL, 0x0000404000004040ULL,
+        0x0040000000000000ULL, 0x0040004000000000ULL, 0x0040000000000040ULL, 0x0040004000000040ULL,
+        0x0040400000000000ULL, 0x0040404000000000ULL, 0x0040400000000040ULL, 0x0040404000000040ULL,
+        0x0040000000004000ULL, 0x0040004000004000ULL, 0x0040000000004040ULL, 0x0040004000004040ULL,
+        0x0040400000004000ULL, 0x0040404000004000ULL, 0x0040400000004040ULL, 0x0040404000004040ULL,
+        0x0000000000400000ULL, 0x0000004000400000ULL, 0x0000000000400040ULL, 0x0000004000400040ULL,
+        0x0000400000400000ULL, 0x0000404000400000ULL, 0x0000400000400040ULL, 0x0000404000400040ULL,
+        0x0000000000404000ULL, 0x0000004000404000ULL, 0x0000000000404040ULL, 0x0000004000404040ULL,
+        0x0000400000404000ULL, 0x0000404000404000ULL, 0x0000400000404040ULL, 0x0000404000404040ULL,
+        0x0040000000400000ULL, 0x0040004000400000ULL, 0x0040000000400040ULL, 0x0040004000400040ULL,
+        0x0040400000400000ULL, 0x0040404000400000ULL, 0x0040400000400040ULL, 0x0040404000400040ULL,
+        0x0040000000404000ULL, 0x0040004000404000ULL, 0x0040000000404040ULL, 0x0040004000404040ULL,
+        0x0040400000404000ULL, 0x0040404000404000ULL, 0x0040400000404040ULL, 0x0040404000404040ULL,
+        0x4000000000000000ULL, 0x4000004000000000ULL, 0x4000000000000040ULL, 0x4000004000000040ULL,
+        0x4000400000000000ULL, 0x4000404000000000ULL, 0x4000400000000040ULL, 0x4000404000000040ULL,
+        0x4000000000004000ULL, 0x4000004000004000ULL, 0x4000000000004040ULL, 0x4000004000004040ULL,
+        0x4000400000004000ULL, 0x4000404000004000ULL, 0x4000400000004040ULL, 0x4000404000004040ULL,
+        0x4040000000000000ULL, 0x4040004000000000ULL, 0x4040000000000040ULL, 0x4040004000000040ULL,
+        0x4040400000000000ULL, 0x4040404000000000ULL, 0x4040400000000040ULL, 0x4040404000000040ULL,
+        0x4040000000004000ULL, 0x4040004000004000ULL, 0x4040000000004040ULL, 0x4040004000004040ULL,
+        0x4040400000004000ULL, 0x4040404000004000ULL, 0x4040400000004040ULL, 0x4040404000004040ULL,
+        0x4000000000400000ULL, 0x4000004000400000ULL, 0x4000000000400040ULL, 0x4000004000400040ULL,
+        0x4000400000400000ULL, 0x4000404000400000ULL, 0x4000400000400040ULL, 0x4000404000400040ULL,
+        0x4000000000404000ULL, 0x4000004000404000ULL, 0x4000000000404040ULL, 0x4000004000404040ULL,
+        0x4000400000404000ULL, 0x4000404000404000ULL, 0x4000400000404040ULL, 0x4000404000404040ULL,
+        0x4040000000400000ULL, 0x4040004000400000ULL, 0x4040000000400040ULL, 0x4040004000400040ULL,
+        0x4040400000400000ULL, 0x4040404000400000ULL, 0x4040400000400040ULL, 0x4040404000400040ULL,
+        0x4040000000404000ULL, 0x4040004000404000ULL, 0x4040000000404040ULL, 0x4040004000404040ULL,
+        0x4040400000404000ULL, 0x4040404000404000ULL, 0x4040400000404040ULL, 0x4040404000404040ULL,
+        0x0000000040000000ULL, 0x0000004040000000ULL, 0x0000000040000040ULL, 0x0000004040000040ULL,
+        0x0000400040000000ULL, 0x0000404040000000ULL, 0x0000400040000040ULL, 0x0000404040000040ULL,
+        0x0000000040004000ULL, 0x0000004040004000ULL, 0x0000000040004040ULL, 0x0000004040004040ULL,
+        0x0000400040004000ULL, 0x0000404040004000ULL, 0x0000400040004040ULL, 0x0000404040004040ULL,
+        0x0040000040000000ULL, 0x0040004040000000ULL, 0x0040000040000040ULL, 0x0040004040000040ULL,
+        0x0040400040000000ULL, 0x0040404040000000ULL, 0x0040400040000040ULL, 0x0040404040000040ULL,
+        0x0040000040004000ULL, 0x0040004040004000ULL, 0x0040000040004040ULL, 0x0040004040004040ULL,
+        0x0040400040004000ULL, 0x0040404040004000ULL, 0x0040400040004040ULL, 0x0040404040004040ULL,
+        0x0000000040400000ULL, 0x0000004040400000ULL, 0x0000000040400040ULL, 0x0000004040400040ULL,
+        0x0000400040400000ULL, 0x0000404040400000ULL, 0x0000400040400040ULL, 0x0000404040400040ULL,
+        0x0000000040404000ULL, 0x0000004040404000ULL, 0x0000000040404040ULL, 0x0000004040404040ULL,
+        0x0000400040404000ULL, 0x0000404040404000ULL, 0x0000400040404040ULL, 0x0000404040404040ULL,
+        0x0040000040400000ULL, 0x0040004040400000ULL, 0x0040000040400040ULL, 0x0040004040400040ULL,
+        0x0040400040400000ULL, 0x0040404040400000ULL, 0x0040400040400040ULL, 0x0040404040400040ULL,
+        0x0040000040404000ULL, 0x0040004040404000ULL, 0x0040000040404040ULL, 0x0040004040404040ULL,
+        0x0040400040404000ULL, 0x0040404040404000ULL, 0x0040400040404040ULL, 0x0040404040404040ULL,
+        0x4000000040000000ULL, 0x4000004040000000ULL, 0x4000000040000040ULL, 0x4000004040000040ULL,
+        0x4000400040000000ULL, 0x4000404040000000ULL, 0x4000400040000040ULL, 0x4000404040000040ULL,
+        0x4000000040004000ULL, 0x4000004040004000ULL, 0x4000000040004040ULL, 0x4000004040004040ULL,
+        0x4000400040004000ULL, 0x4000404040004000ULL, 0x4000400040004040ULL, 0x4000404040004040ULL,
+        0x4040000040000000ULL, 0x4040004040000000ULL, 0x4040000040000040ULL, 0x4040004040000040ULL,
+        0x4040400040000000ULL, 0x4040404040000000ULL, 0x4040400040000040ULL, 0x4040404040000040ULL,
+        0x4040000040004000ULL, 0x4040004040004000ULL, 0x4040000040004040ULL, 0x4040004040004040ULL,
+        0x4040400040004000ULL, 0x4040404040004000ULL, 0x4040400040004040ULL, 0x4040404040004040ULL,
+        0x4000000040400000ULL, 0x4000004040400000ULL, 0x4000000040400040ULL, 0x4000004040400040ULL,
+        0x4000400040400000ULL, 0x4000404040400000ULL, 0x4000400040400040ULL, 0x4000404040400040ULL,
+        0x4000000040404000ULL, 0x4000004040404000ULL, 0x4000000040404040ULL, 0x4000004040404040ULL,
+        0x4000400040404000ULL, 0x4000404040404000ULL, 0x4000400040404040ULL, 0x4000404040404040ULL,
+        0x4040000040400000ULL, 0x4040004040400000ULL, 0x4040000040400040ULL, 0x4040004040400040ULL,
+        0x4040400040400000ULL, 0x4040404040400000ULL, 0x4040400040400040ULL, 0x4040404040400040ULL,
+        0x4040000040404000ULL, 0x4040004040404000ULL, 0x4040000040404040ULL, 0x4040004040404040ULL,
+        0x4040400040404000ULL, 0x4040404040404000ULL, 0x4040400040404040ULL, 0x4040404040404040ULL},
+    {
+        0x0000000000000000ULL, 0x0000008000000000ULL, 0x0000000000000080ULL, 0x0000008000000080ULL,
+        0x0000800000000000ULL, 0x0000808000000000ULL, 0x0000800000000080ULL, 0x0000808000000080ULL,
+        0x0000000000008000ULL, 0x0000008000008000ULL, 0x0000000000008080ULL, 0x0000008000008080ULL,
+        0x0000800000008000ULL, 0x0000808000008000ULL, 0x0000800000008080ULL, 0x0000808000008080ULL,
+        0x0080000000000000ULL, 0x0080008000000000ULL, 0x0080000000000080ULL, 0x0080008000000080ULL,
+        0x0080800000000000ULL, 0x0080808000000000ULL, 0x0080800000000080ULL, 0x0080808000000080ULL,
+        0x0080000000008000ULL, 0x0080008000008000ULL, 0x0080000000008080ULL, 0x0080008000008080ULL,
+        0x0080800000008000ULL, 0x0080808000008000ULL, 0x0080800000008080ULL, 0x0080808000008080ULL,
+        0x0000000000800000ULL, 0x0000008000800000ULL, 0x0000000000800080ULL, 0x0000008000800080ULL,
+        0x0000800000800000ULL, 0x0000808000800000ULL, 0x0000800000800080ULL, 0x0000808000800080ULL,
+        0x0000000000808000ULL, 0x0000008000808000ULL, 0x0000000000808080ULL, 0x0000008000808080ULL,
+        0x0000800000808000ULL, 0x0000808000808000ULL, 0x0000800000808080ULL, 0x0000808000808080ULL,
+        0x0080000000800000ULL, 0x0080008000800000ULL, 0x0080000000800080ULL, 0x0080008000800080ULL,
+        0x0080800000800000ULL, 0x0080808000800000ULL, 0x0080800000800080ULL, 0x0080808000800080ULL,
+        0x0080000000808000ULL, 0x0080008000808000ULL, 0x0080000000808080ULL, 0x0080008000808080ULL,
+        0x0080800000808000ULL, 0x0080808000808000ULL, 0x0080800000808080ULL, 0x0080808000808080ULL,
+        0x8000000000000000ULL, 0x8000008000000000ULL, 0x8000000000000080ULL, 0x8000008000000080ULL,
+        0x8000800000000000ULL, 0x8000808000000000ULL, 0x8000800000000080ULL, 0x8000808000000080ULL,
+        0x8000000000008000ULL, 0x8000008000008000ULL, 0x8000000000008080ULL, 0x8000008000008080ULL,
+        0x8000800000008000ULL, 0x8000808000008000ULL, 0x8000800000008080ULL, 0x8000808000008080ULL,
+        0x8080000000000000ULL, 0x8080008000000000ULL, 0x8080000000000080ULL, 0x8080008000000080ULL,
+        0x8080800000000000ULL, 0x8080808000000000ULL, 0x8080800000000080ULL, 0x8080808000000080ULL,
+        0x8080000000008000ULL, 0x8080008000008000ULL, 0x8080000000008080ULL, 0x8080008000008080ULL,
+        0x8080800000008000ULL, 0x8080808000008000ULL, 0x8080800000008080ULL, 0x8080808000008080ULL,
+        0x8000000000800000ULL, 0x8000008000800000ULL, 0x8000000000800080ULL, 0x8000008000800080ULL,
+        0x8000800000800000ULL, 0x8000808000800000ULL, 0x8000800000800080ULL, 0x8000808000800080ULL,
+        0x8000000000808000ULL, 0x8000008000808000ULL, 0x8000000000808080ULL, 0x8000008000808080ULL,
+        0x8000800000808000ULL, 0x8000808000808000ULL, 0x8000800000808080ULL, 0x8000808000808080ULL,
+        0x8080000000800000ULL, 0x8080008000800000ULL, 0x8080000000800080ULL, 0x8080008000800080ULL,
+        0x8080800000800000ULL, 0x8080808000800000ULL, 0x8080800000800080ULL, 0x8080808000800080ULL,
+        0x8080000000808000ULL, 0x8080008000808000ULL, 0x8080000000808080ULL, 0x8080008000808080ULL,
+        0x8080800000808000ULL, 0x8080808000808000ULL, 0x8080800000808080ULL, 0x8080808000808080ULL,
+        0x0000000080000000ULL, 0x0000008080000000ULL, 0x0000000080000080ULL, 0x0000008080000080ULL,
+        0x0000800080000000ULL, 0x0000808080000000ULL, 0x0000800080000080ULL, 0x0000808080000080ULL,
+        0x0000000080008000ULL, 0x0000008080008000ULL, 0x0000000080008080ULL, 0x0000008080008080ULL,
+        0x0000800080008000ULL, 0x0000808080008000ULL, 0x0000800080008080ULL, 0x0000808080008080ULL,
+        0x0080000080000000ULL, 0x0080008080000000ULL, 0x0080000080000080ULL, 0x0080008080000080ULL,
+        0x0080800080000000ULL, 0x0080808080000000ULL, 0x0080800080000080ULL, 0x0080808080000080ULL,
+        0x0080000080008000ULL, 0x0080008080008000ULL, 0x0080000080008080ULL, 0x0080008080008080ULL,
+        0x0080800080008000ULL, 0x0080808080008000ULL, 0x0080800080008080ULL, 0x0080808080008080ULL,
+        0x0000000080800000ULL, 0x0000008080800000ULL, 0x0000000080800080ULL, 0x0000008080800080ULL,
+        0x0000800080800000ULL, 0x0000808080800000ULL, 0x0000800080800080ULL, 0x0000808080800080ULL,
+        0x0000000080808000ULL, 0x0000008080808000ULL, 0x0000000080808080ULL, 0x0000008080808080ULL,
+        0x0000800080808000ULL, 0x0000808080808000ULL, 0x0000800080808080ULL, 0x0000808080808080ULL,
+        0x0080000080800000ULL, 0x0080008080800000ULL, 0x0080000080800080ULL, 0x0080008080800080ULL,
+        0x0080800080800000ULL, 0x0080808080800000ULL, 0x0080800080800080ULL, 0x0080808080800080ULL,
+        0x0080000080808000ULL, 0x0080008080808000ULL, 0x0080000080808080ULL, 0x0080008080808080ULL,
+        0x0080800080808000ULL, 0x0080808080808000ULL, 0x0080800080808080ULL, 0x0080808080808080ULL,
+        0x8000000080000000ULL, 0x8000008080000000ULL, 0x8000000080000080ULL, 0x8000008080000080ULL,
+        0x8000800080000000ULL, 0x8000808080000000ULL, 0x8000800080000080ULL, 0x8000808080000080ULL,
+        0x8000000080008000ULL, 0x8000008080008000ULL, 0x8000000080008080ULL, 0x8000008080008080ULL,
+        0x8000800080008000ULL, 0x8000808080008000ULL, 0x8000800080008080ULL, 0x8000808080008080ULL,
+        0x8080000080000000ULL, 0x8080008080000000ULL, 0x8080000080000080ULL, 0x8080008080000080ULL,
+        0x8080800080000000ULL, 0x8080808080000000ULL, 0x8080800080000080ULL, 0x8080808080000080ULL,
+        0x8080000080008000ULL, 0x8080008080008000ULL, 0x8080000080008080ULL, 0x8080008080008080ULL,
+        0x8080800080008000ULL, 0x8080808080008000ULL, 0x8080800080008080ULL, 0x8080808080008080ULL,
+        0x8000000080800000ULL, 0x8000008080800000ULL, 0x8000000080800080ULL, 0x8000008080800080ULL,
+        0x8000800080800000ULL, 0x8000808080800000ULL, 0x8000800080800080ULL, 0x8000808080800080ULL,
+        0x8000000080808000ULL, 0x8000008080808000ULL, 0x8000000080808080ULL, 0x8000008080808080ULL,
+        0x8000800080808000ULL, 0x8000808080808000ULL, 0x8000800080808080ULL, 0x8000808080808080ULL,
+        0x8080000080800000ULL, 0x8080008080800000ULL, 0x8080000080800080ULL, 0x8080008080800080ULL,
+        0x8080800080800000ULL, 0x8080808080800000ULL, 0x8080800080800080ULL, 0x8080808080800080ULL,
+        0x8080000080808000ULL, 0x8080008080808000ULL, 0x8080000080808080ULL, 0x8080008080808080ULL,
+        0x8080800080808000ULL, 0x8080808080808000ULL, 0x8080800080808080ULL, 0x8080808080808080ULL}
+};
+
+// 逆初始置换IP^-1, 按输入字节查表
+const BYTE DES_IP_INV_TABLE[8][256] DES_CACHE_ALIGNED = {
+    {
+        0x0000000000000000ULL, 0x4000000000000000ULL, 0x0040000000000000ULL, 0x4040000000000000ULL,
+        0x0000400000000000ULL, 0x4000400000000000ULL, 0x0040400000000000ULL, 0x4040400000000000ULL,
+        0x0000004000000000ULL, 0x4000004000000000ULL, 0x0040004000000000ULL, 0x4040004000000000ULL,
+        0x0000404000000000ULL, 0x4000404000000000ULL, 0x0040404000000000ULL, 0x4040404000000000ULL,
+        0x0000000040000000ULL, 0x4000000040000000ULL, 0x0040000040000000ULL, 0x4040000040000000ULL,
+        0x0000400040000000ULL, 0x4000400040000000ULL, 0x0040400040000000ULL, 0x4040400040000000ULL,
+        0x0000004040000000ULL, 0x4000004040000000ULL, 0x0040004040000000ULL, 0x4040004040000000ULL,
+        0x0000404040000000ULL, 0x4000404040000000ULL, 0x0040404040000000ULL, 0x4040404040000000ULL,
+        0x0000000000400000ULL, 0x4000000000400000ULL, 0x0040000000400000ULL, 0x4040000000400000ULL,
+        0x0000400000400000ULL, 0x4000400000400000ULL, 0x0040400000400000ULL, 0x4040400000400000ULL,
+        0x0000004000400000ULL, 0x4000004000400000ULL, 0x0040004000400000ULL, 0x4040004000400000ULL,
+        0x0000404000400000ULL, 0x4000404000400000ULL, 0x0040404000400000ULL, 0x4040404000400000ULL,
+        0x0000000040400000ULL, 0x4000000040400000ULL, 0x0040000040400000ULL, 0x4040000040400000ULL,
+        0x0000400040400000ULL, 0x4000400040400000ULL, 0x0040400040400000ULL, 0x4040400040400000ULL,
+        0x0000004040400000ULL, 0x4000004040400000ULL, 0x0040004040400000ULL, 0x4040004040400000ULL,
+        0x0000404040400000ULL, 0x4000404040400000ULL, 0x0040404040400000ULL, 0x4040404040400000ULL,
+        0x0000000000004000ULL, 0x4000000000004000ULL, 0x0040000000004000ULL, 0x4040000000004000ULL,
+        0x0000400000004000ULL, 0x4000400000004000ULL, 0x0040400000004000ULL, 0x4040400000004000ULL,
+        0x0000004000004000ULL, 0x4000004000004000ULL, 0x0040004000004000ULL, 0x4040004000004000ULL,
+        0x0000404000004000ULL, 0x4000404000004000ULL, 0x0040404000004000ULL, 0x4040404000004000ULL,
+        0x0000000040004000ULL, 0x4000000040004000ULL, 0x0040000040004000ULL, 0x4040000040004000ULL,
+        0x0000400040004000ULL, 0x4000400040004000ULL, 0x0040400040004000ULL, 0x4040400040004000ULL,
+        0x0000004040004000ULL, 0x4000004040004000ULL, 0x0040004040004000ULL, 0x4040004040004000ULL,
+        0x0000404040004000ULL, 0x4000404040004000ULL, 0x0040404040004000ULL, 0x4040404040004000ULL,
+        0x0000000000404000ULL, 0x4000000000404000ULL, 0x0040000000404000ULL, 0x4040000000404000ULL,
+        0x0000400000404000ULL, 0x4000400000404000ULL, 0x0040400000404000ULL, 0x4040400000404000ULL,
+        0x0000004000404000ULL, 0x4000004000404000ULL, 0x0040004000404000ULL, 0x4040004000404000ULL,
+        0x0000404000404000ULL, 0x4000404000404000ULL, 0x0040404000404000ULL, 0x4040404000404000ULL,
+        0x0000000040404000ULL, 0x4000000040404000ULL, 0x0040000040404000ULL, 0x4040000040404000ULL,
+        0x0000400040404000ULL, 0x4000400040404000ULL, 0x0040400040404000ULL, 0x4040400040404000ULL,
+        0x0000004040404000ULL, 0x4000004040404000ULL, 0x0040004040404000ULL, 0x4040004040404000ULL,
+        0x0000404040404000ULL, 0x4000404040404000ULL, 0x0040404040404000ULL, 0x4040404040404000ULL,
+        0x0000000000000040ULL, 0x4000000000000040ULL, 0x0040000000000040ULL, 0x4040000000000040ULL,
+        0x0000400000000040ULL, 0x4000400000000040ULL, 0x0040400000000040ULL, 0x4040400000000040ULL,
+        0x0000004000000040ULL, 0x4000004000000040ULL, 0x0040004000000040ULL, 0x4040004000000040ULL,
+        0x0000404000000040ULL, 0x4000404000000040ULL, 0x0040404000000040ULL, 0x4040404000000040ULL,
+        0x0000000040000040ULL, 0x4000000040000040ULL, 0x0040000040000040ULL, 0x4040000040000040ULL,
+        0x0000400040000040ULL, 0x4000400040000040ULL, 0x0040400040000040ULL, 0x4040400040000040ULL,
+        0x0000004040000040ULL, 0x4000004040000040ULL, 0x0040004040000040ULL, 0x4040004040000040ULL,
+        0x0000404040000040ULL, 0x4000404040000040ULL, 0x0040404040000040ULL, 0x4040404040000040ULL,
+        0x0000000000400040ULL, 0x4000000000400040ULL, 0x0040000000400040ULL, 0x4040000000400040ULL,
+        0x0000400000400040ULL, 0x4000400000400040ULL, 0x0040400000400040ULL, 0x4040400000400040ULL,
+        0x0000004000400040ULL, 0x4000004000400040ULL, 0x0040004000400040ULL, 0x4040004000400040ULL,
+        0x0000404000400040ULL, 0x4000404000400040ULL, 0x0040404000400040ULL, 0x4040404000400040ULL,
+        0x0000000040400040ULL, 0x4000000040400040ULL, 0x0040000040400040ULL, 0x4040000040400040ULL,
+        0x0000400040400040ULL, 0x4000400040400040ULL, 0x0040400040400040ULL, 0x4040400040400040ULL,
+        0x0000004040400040ULL, 0x4000004040400040ULL, 0x0040004040400040ULL, 0x4040004040400040ULL,
+        0x0000404040400040ULL, 0x4000404040400040ULL, 0x0040404040400040ULL, 0x4040404040400040ULL,
+        0x0000000000004040ULL, 0x4000000000004040ULL, 0x0040000000004040ULL, 0x4040000000004040ULL,
+        0x0000400000004040ULL, 0x4000400000004040ULL, 0x0040400000004040ULL, 0x4040400000004040ULL,
+        0x0000004000004040ULL, 0x4000004000004040ULL, 0x0040004000004040ULL, 0x4040004000004040ULL,
+        0x0000404000004040ULL, 0x4000404000004040ULL, 0x0040404000004040ULL, 0x4040404000004040ULL,
+        0x0000000040004040ULL, 0x4000000040004040ULL, 0x0040000040004040ULL, 0x4040000040004040ULL,
+        0x0000400040004040ULL, 0x4000400040004040ULL, 0x0040400040004040ULL, 0x4040400040004040ULL,
+        0x0000004040004040ULL, 0x4000004040004040ULL, 0x0040004040004040ULL, 0x4040004040004040ULL,
+        0x0000404040004040ULL, 0x4000404040004040ULL, 0x0040404040004040ULL, 0x4040404040004040ULL,
+        0x0000000000404040ULL, 0x4000000000404040ULL, 0x0040000000404040ULL, 0x4040000000404040ULL,
+        0x0000400000404040ULL, 0x4000400000404040ULL, 0x0040400000404040ULL, 0x4040400000404040ULL,
+        0x0000004000404040ULL, 0x4000004000404040ULL, 0x0040004000404040ULL, 0x4040004000404040ULL,
+        0x0000404000404040ULL, 0x4000404000404040ULL, 0x0040404000404040ULL, 0x4040404000404040ULL,
+        0x0000000040404040ULL, 0x4000000040404040ULL, 0x0040000040404040ULL, 0x4040000040404040ULL,
+        0x0000400040404040ULL, 0x4000400040404040ULL, 0x0040400040404040ULL, 0x4040400040404040ULL,
+        0x0000004040404040ULL, 0x4000004040404040ULL, 0x0040004040404040ULL, 0x4040004040404040ULL,
+        0x0000404040404040ULL, 0x4000404040404040ULL, 0x0040404040404040ULL, 0x4040404040404040ULL},
+    {
+        0x0000000000000000ULL, 0x1000000000000000ULL, 0x0010000000000000ULL, 0x1010000000000000ULL,
+        0x0000100000000000ULL, 0x1000100000000000ULL, 0x0010100000000000ULL, 0x1010100000000000ULL,
+        0x0000001000000000ULL, 0x1000001000000000ULL, 0x0010001000000000ULL, 0x1010001000000000ULL,
+        0x0000101000000000ULL, 0x1000101000000000ULL, 0x0010101000000000ULL, 0x1010101000000000ULL,
+        0x0000000010000000ULL, 0x1000000010000000ULL, 0x0010000010000000ULL, 0x1010000010000000ULL,
+        0x0000100010000000ULL, 0x1000100010000000ULL, 0x0010100010000000ULL, 0x1010100010000000ULL,
+        0x0000001010000000ULL, 0x1000001010000000ULL, 0x0010001010000000ULL, 0x1010001010000000ULL,
+        0x0000101010000000ULL, 0x1000101010000000ULL, 0x0010101010000000ULL, 0x1010101010000000ULL,
+        0x0000000000100000ULL, 0x1000000000100000ULL, 0x0010000000100000ULL, 0x1010000000100000ULL,
+        0x0000100000100000ULL, 0x1000100000100000ULL, 0x0010100000100000ULL, 0x1010100000100000ULL,
+        0x0000001000100000ULL, 0x1000001000100000ULL, 0x0010001000100000ULL, 0x1010001000100000ULL,
+        0x0000101000100000ULL, 0x1000101000100000ULL, 0x0010101000100000ULL, 0x1010101000100000ULL,
+        0x0000000010100000ULL, 0x1000000010100000ULL, 0x0010000010100000ULL, 0x1010000010100000ULL,
+        0x0000100010100000ULL, 0x1000100010100000ULL, 0x0010100010100000ULL, 0x1010100010100000ULL,
+        0x0000001010100000ULL, 0x1000001010100000ULL, 0x0010001010100000ULL, 0x1010001010100000ULL,
+        0x0000101010100000ULL, 0x1000101010100000ULL, 0x0010101010100000ULL, 0x1010101010100000ULL,
+        0x0000000000001000ULL, 0x1000000000001000ULL, 0x0010000000001000ULL, 0x1010000000001000ULL,
+        0x0000100000001000ULL, 0x1000100000001000ULL, 0x0010100000001000ULL, 0x1010100000001000ULL,
+        0x0000001000001000ULL, 0x1000001000001000ULL, 0x0010001000001000ULL, 0x1010001000001000ULL,
+        0x0000101000001000ULL, 0x1000101000001000ULL, 0x0010101000001000ULL, 0x1010101000001000ULL,
+        0x0000000010001000ULL, 0x1000000010001000ULL, 0x0010000010001000ULL, 0x1010000010001000ULL,
+        0x0000100010001000ULL, 0x1000100010001000ULL, 0x0010100010001000ULL, 0x1010100010001000ULL,
+        0x0000001010001000ULL, 0x1000001010001000ULL, 0x0010001010001000ULL, 0x1010001010001000ULL,
+        0x0000101010001000ULL, 0x1000101010001000ULL, 0x0010101010001000ULL, 0x1010101010001000ULL,
+        0x0000000000101000ULL, 0x1000000000101000ULL, 0x0010000000101000ULL, 0x1010000000101000ULL,
+        0x0000100000101000ULL, 0x1000100000101000ULL, 0x0010100000101000ULL, 0x1010100000101000ULL,
+        0x0000001000101000ULL, 0x1000001000101000ULL, 0x0010001000101000ULL, 0x1010001000101000ULL,
+        0x0000101000101000ULL, 0x1000101000101000ULL, 0x0010101000101000ULL, 0x1010101000101000ULL,
+        0x0000000010101000ULL, 0x1000000010101000ULL, 0x0010000010101000ULL, 0x1010000010101000ULL,
+        0x0000100010101000ULL, 0x1000100010101000ULL, 0x0010100010101000ULL, 0x1010100010101000ULL,
+        0x0000001010101000ULL, 0x1000001010101000ULL, 0x0010001010101000ULL, 0x1010001010101000ULL,
+        0x0000101010101000ULL, 0x1000101010101000ULL, 0x0010101010101000ULL, 0x1010101010101000ULL,
+        0x0000000000000010ULL, 0x1000000000000010ULL, 0x0010000000000010ULL, 0x1010000000000010ULL,
+        0x0000100000000010ULL, 0x1000100000000010ULL, 0x0010100000000010ULL, 0x1010100000000010ULL,
+        0x0000001000000010ULL, 0x1000001000000010ULL, 0x0010001000000010ULL, 0x1010001000000010ULL,
+        0x0000101000000010ULL, 0x1000101000000010ULL, 0x0010101000000010ULL, 0x1010101000000010ULL,
+        0x0000000010000010ULL, 0x1000000010000010ULL, 0x0010000010000010ULL, 0x1010000010000010ULL,
+        0x0000100010000010ULL, 0x1000100010000010ULL, 0x0010100010000010ULL, 0x1010100010000010ULL,
+        0x0000001010000010ULL, 0x1000001010000010ULL, 0x0010001010000010ULL, 0x1010001010000010ULL,
+        0x0000101010000010ULL, 0x1000101010000010ULL, 0x0010101010000010ULL, 0x1010101010000010ULL,
+        0x0000000000100010ULL, 0x1000000000100010ULL, 0x0010000000100010ULL, 0x1010000000100010ULL,
+        0x0000100000100010ULL, 0x1000100000100010ULL, 0x0010100000100010ULL, 0x1010100000100010ULL,
+        0x0000001000100010ULL, 0x1000001000100010ULL, 0x0010001000100010ULL, 0x1010001000100010ULL,
+        0x0000101000100010ULL, 0x1000101000100010ULL, 0x0010101000100010ULL, 0x1010101000100010ULL,
+        0x0000000010100010ULL, 0x1000000010100010ULL, 0x0010000010100010ULL, 0x1010000010100010ULL,
+        0x0000100010100010ULL, 0x1000100010100010ULL, 0x0010100010100010ULL, 0x1010100010100010ULL,
+        0x0000001010100010ULL, 0x1000001010100010ULL, 0x0010001010100010ULL, 0x1010001010100010ULL,
+        0x0000101010100010ULL, 0x1000101010100010ULL, 0x0010101010100010ULL, 0x1010101010100010ULL,
+        0x0000000000001010ULL, 0x1000000000001010ULL, 0x0010000000001010ULL, 0x1010000000001010ULL,
+        0x0000100000001010ULL, 0x1000100000001010ULL, 0x0010100000001010ULL, 0x1010100000001010ULL,
+        0x0000001000001010ULL, 0x1000001000001010ULL, 0x0010001000001010ULL, 0x1010001000001010ULL,
+        0x0000101000001010ULL, 0x1000101000001010ULL, 0x0010101000001010ULL, 0x1010101000001010ULL,
+        0x0000000010001010ULL, 0x1000000010001010ULL, 0x0010000010001010ULL, 0x1010000010001010ULL,
+        0x0000100010001010ULL, 0x1000100010001010ULL, 0x0010100010001010ULL, 0x1010100010001010ULL,
+        0x0000001010001010ULL, 0x1000001010001010ULL, 0x0010001010001010ULL, 0x1010001010001010ULL,
+        0x0000101010001010ULL, 0x1000101010001010ULL, 0x0010101010001010ULL, 0x1010101010001010ULL,
+        0x0000000000101010ULL, 0x1000000000101010ULL, 0x0010000000101010ULL, 0x1010000000101010ULL,
+        0x0000100000101010ULL, 0x1000100000101010ULL, 0x0010100000101010ULL, 0x1010100000101010ULL,
+        0x0000001000101010ULL, 0x1000001000101010ULL, 0x0010001000101010ULL, 0x1010001000101010ULL,
+        0x0000101000101010ULL, 0x1000101000101010ULL, 0x0010101000101010ULL, 0x1010101000101010ULL,
+        0x0000000010101010ULL, 0x1000000010101010ULL, 0x0010000010101010ULL, 0x1010000010101010ULL,
+        0x0000100010101010ULL, 0x1000100010101010ULL, 0x0010100010101010ULL, 0x1010100010101010ULL,
+        0x0000001010101010ULL, 0x1000001010101010ULL, 0x0010001010101010ULL, 0x1010001010101010ULL,
+        0x0000101010101010ULL, 0x1000101010101010ULL, 0x0010101010101010ULL, 0x1010101010101010ULL},
+    {
+        0x0000000000000000ULL, 0x0400000000000000ULL, 0x0004000000000000ULL, 0x0404000000000000ULL,
+        0x0000040000000000ULL, 0x0400040000000000ULL, 0x0004040000000000ULL, 0x0404040000000000ULL,
+        0x0000000400000000ULL, 0x0400000400000000ULL, 0x0004000400000000ULL, 0x0404000400000000ULL,
+        0x0000040400000000ULL, 0x0400040400000000ULL, 0x0004040400000000ULL, 0x0404040400000000ULL,
+        0x0000000004000000ULL, 0x0400000004000000ULL, 0x0004000004000000ULL, 0x0404000004000000ULL,
+        0x0000040004000000ULL, 0x0400040004000000ULL, 0x0004040004000000ULL, 0x0404040004000000ULL,
+        0x0000000404000000ULL, 0x0400000404000000ULL, 0x0004000404000000ULL, 0x0404000404000000ULL,
+        0x0000040404000000ULL, 0x0400040404000000ULL, 0x0004040404000000ULL, 0x0404040404000000ULL,
+        0x0000000000040000ULL, 0x0400000000040000ULL, 0x0004000000040000ULL, 0x0404000000040000ULL,
+        0x0000040000040000ULL, 0x0400040000040000ULL, 0x0004040000040000ULL, 0x0404040000040000ULL,
+        0x0000000400040000ULL, 0x0400000400040000ULL, 0x0004000400040000ULL, 0x0404000400040000ULL,
+        0x0000040400040000ULL, 0x0400040400040000ULL, 0x0004040400040000ULL, 0x0404040400040000ULL,
+        0x0000000004040000ULL, 0x0400000004040000ULL, 0x0004000004040000ULL, 0x0404000004040000ULL,
+        0x0000040004040000ULL, 0x0400040004040000ULL, 0x0004040004040000ULL, 0x0404040004040000ULL,
+        0x0000000404040000ULL, 0x0400000404040000ULL, 0x0004000404040000ULL, 0x0404000404040000ULL,
+        0x0000040404040000ULL, 0x0400040404040000ULL, 0x0004040404040000ULL, 0x0404040404040000ULL,
+        0x0000000000000400ULL, 0x0400000000000400ULL, 0x0004000000000400ULL, 0x0404000000000400ULL,
+        0x0000040000000400ULL, 0x0400040000000400ULL, 0x0004040000000400ULL, 0x0404040000000400ULL,
+        0x0000000400000400ULL, 0x0400000400000400ULL, 0x0004000400000400ULL, 0x0404000400000400ULL,
+        0x0000040400000400ULL, 0x0400040400000400ULL, 0x0004040400000400ULL, 0x0404040400000400ULL,
+        0x0000000004000400ULL, 0x0400000004000400ULL, 0x0004000004000400ULL, 0x0404000004000400ULL,
+        0x0000040004000400ULL, 0x0400040004000400ULL, 0x0004040004000400ULL, 0x0404040004000400ULL,
+        0x0000000404000400ULL, 0x0400000404000400ULL, 0x0004000404000400ULL, 0x0404000404000400ULL,
+        0x0000040404000400ULL, 0x0400040404000400ULL, 0x0004040404000400ULL, 0x0404040404000400ULL,
+        0x0000000000040400ULL, 0x0400000000040400ULL, 0x0004000000040400ULL, 0x0404000000040400ULL,
+        0x0000040000040400ULL, 0x0400040000040400ULL, 0x0004040000040400ULL, 0x0404040000040400ULL,
+        0x0000000400040400ULL, 0x0400000400040400ULL, 0x0004000400040400ULL, 0x0404000400040400ULL,
+        0x0000040400040400ULL, 0x0400040400040400ULL, 0x0004040400040400ULL, 0x0404040400040400ULL,
+        0x0000000004040400ULL, 0x0400000004040400ULL, 0x0004000004040400ULL, 0x0404000004040400ULL,
+        0x0000040004040400ULL, 0x0400040004040400ULL, 0x0004040004040400ULL, 0x0404040004040400ULL,
+        0x0000000404040400ULL, 0x0400000404040400ULL, 0x0004000404040400ULL, 0x0404000404040400ULL,
+        0x0000040404040400ULL, 0x0400040404040400ULL, 0x0004040404040400ULL, 0x0404040404040400ULL,
+        0x0000000000000004ULL, 0x0400000000000004ULL, 0x0004000000000004ULL, 0x0404000000000004ULL,
+        0x0000040000000004ULL, 0x0400040000000004ULL, 0x0004040000000004ULL, 0x0404040000000004ULL,
+        0x0000000400000004ULL, 0x0400000400000004ULL, 0x0004000400000004ULL, 0x0404000400000004ULL,
+        0x0000040400000004ULL, 0x0400040400000004ULL, 0x0004040400000004ULL, 0x0404040400000004ULL,
+        0x0000000004000004ULL, 0x0400000004000004ULL, 0x0004000004000004ULL, 0x0404000004000004ULL,
+        0x0000040004000004ULL, 0x0400040004000004ULL, 0x0004040004000004ULL, 0x0404040004000004ULL,
+        0x0000000404000004ULL, 0x0400000404000004ULL, 0x0004000404000004ULL, 0x0404000404000004ULL,
+        0x0000040404000004ULL, 0x0400040404000004ULL, 0x0004040404000004ULL, 0x0404040404000004ULL,
+        0x0000000000040004ULL, 0x0400000000040004ULL, 0x0004000000040004ULL, 0x0404000000040004ULL,
+        0x0000040000040004ULL, 0x0400040000040004ULL, 0x0004040000040004ULL, 0x0404040000040004ULL,
+        0x0000000400040004ULL, 0x0400000400040004ULL, 0x0004000400040004ULL, 0x0404000400040004ULL,
+        0x0000040400040004ULL, 0x0400040400040004ULL, 0x0004040400040004ULL, 0x0404040400040004ULL,
+        0x0000000004040004ULL, 0x0400000004040004ULL, 0x0004000004040004ULL, 0x0404000004040004ULL,
+        0x0000040004040004ULL, 0x0400040004040004ULL, 0x0004040004040004ULL, 0x0404040004040004ULL,
+        0x0000000404040004ULL, 0x0400000404040004ULL, 0x0004000404040004ULL, 0x0404000404040004ULL,
+        0x0000040404040004ULL, 0x0400040404040004ULL, 0x0004040404040004ULL, 0x0404040404040004ULL,
+        0x0000000000000404ULL, 0x0400000000000404ULL, 0x0004000000000404ULL, 0x0404000000000404ULL,
+        0x0000040000000404ULL, 0x0400040000000404ULL, 0x0004040000000404ULL, 0x0404040000000404ULL,
+        0x0000000400000404ULL, 0x0400000400000404ULL, 0x0004000400000404ULL, 0x0404000400000404ULL,
+        0x0000040400000404ULL, 0x0400040400000404ULL, 0x0004040400000404ULL, 0x0404040400000404ULL,
+        0x0000000004000404ULL, 0x0400000004000404ULL, 0x0004000004000404ULL, 0x0404000004000404ULL,
+        0x0000040004000404ULL, 0x0400040004000404ULL, 0x0004040004000404ULL, 0x0404040004000404ULL,
+        0x0000000404000404ULL, 0x0400000404000404ULL, 0x0004000404000404ULL, 0x0404000404000404ULL,
+        0x0000040404000404ULL, 0x0400040404000404ULL, 0x0004040404000404ULL, 0x0404040404000404ULL,
+        0x0000000000040404ULL, 0x0400000000040404ULL, 0x0004000000040404ULL, 0x0404000000040404ULL,
+        0x0000040000040404ULL, 0x0400040000040404ULL, 0x0004040000040404ULL, 0x0404040000040404ULL,
+        0x0000000400040404ULL, 0x0400000400040404ULL, 0x0004000400040404ULL, 0x0404000400040404ULL,
+        0x0000040400040404ULL, 0x0400040400040404ULL, 0x0004040400040404ULL, 0x0404040400040404ULL,
+        0x0000000004040404ULL, 0x0400000004040404ULL, 0x0004000004040404ULL, 0x0404000004040404ULL,
+        0x0000040004040404ULL, 0x0400040004040404ULL, 0x0004040004040404ULL, 0x0404040004040404ULL,
+        0x0000000404040404ULL, 0x0400000404040404ULL, 0x0004000404040404ULL, 0x0404000404040404ULL,
+        0x0000040404040404ULL, 0x0400040404040404ULL, 0x0004040404040404ULL, 0x0404040404040404ULL},
+    {
+        0x0000000000000000ULL, 0x0100000000000000ULL, 0x0001000000000000ULL, 0x0101000000000000ULL,
+        0x0000010000000000ULL, 0x0100010000000000ULL, 0x0001010000000000ULL, 0x0101010000000000ULL,
+        0x0000000100000000ULL, 0x0100000100000000ULL, 0x0001000100000000ULL, 0x0101000100000000ULL,
+        0x0000010100000000ULL, 0x0100010100000000ULL, 0x0001010100000000ULL, 0x0101010100000000ULL,
+        0x0000000001000000ULL, 0x0100000001000000ULL, 0x0001000001000000ULL, 0x0101000001000000ULL,
+        0x0000010001000000ULL, 0x0100010001000000ULL, 0x0001010001000000ULL, 0x0101010001000000ULL,
+        0x0000000101000000ULL, 0x0100000101000000ULL, 0x0001000101000000ULL, 0x0101000101000000ULL,
+        0x0000010101000000ULL, 0x0100010101000000ULL, 0x0001010101000000ULL, 0x0101010101000000ULL,
+        0x0000000000010000ULL, 0x0100000000010000ULL, 0x0001000000010000ULL, 0x0101000000010000ULL,
+        0x0000010000010000ULL, 0x0100010000010000ULL, 0x0001010000010000ULL, 0x0101010000010000ULL,
+        0x0000000100010000ULL, 0x0100000100010000ULL, 0x0001000100010000ULL, 0x0101000100010000ULL,
+        0x0000010100010000ULL, 0x0100010100010000ULL, 0x0001010100010000ULL, 0x0101010100010000ULL,
+        0x0000000001010000ULL, 0x0100000001010000ULL, 0x0001000001010000ULL, 0x0101000001010000ULL,
+        0x0000010001010000ULL, 0x0100010001010000ULL, 0x0001010001010000ULL, 0x0101010001010000ULL,
+        0x0000000101010000ULL, 0x0100000101010000ULL, 0x0001000101010000ULL, 0x0101000101010000ULL,
+        0x0000010101010000ULL, 0x0100010101010000ULL, 0x0001010101010000ULL, 0x0101010101010000ULL,
+        0x0000000000000100ULL, 0x0100000000000100ULL, 0x0001000000000100ULL, 0x0101000000000100ULL,
+        0x0000010000000100ULL, 0x0100010000000100ULL, 0x0001010000000100ULL, 0x0101010000000100ULL,
+        0x0000000100000100ULL, 0x0100000100000100ULL, 0x0001000100000100ULL, 0x0101000100000100ULL,
+        0x0000010100000100ULL, 0x0100010100000100ULL, 0x0001010100000100ULL, 0x0101010100000100ULL,
+        0x0000000001000100ULL, 0x0100000001000100ULL, 0x0001000001000100ULL, 0x0101000001000100ULL,
+        0x0000010001000100ULL, 0x0100010001000100ULL, 0x0001010001000100ULL, 0x0101010001000100ULL,
+        0x0000000101000100ULL, 0x0100000101000100ULL, 0x0001000101000100ULL, 0x0101000101000100ULL,
+        0x0000010101000100ULL, 0x0100010101000100ULL, 0x0001010101000100ULL, 0x0101010101000100ULL,
+        0x0000000000010100ULL, 0x0100000000010100ULL, 0x0001000000010100ULL, 0x0101000000010100ULL,
+        0x0000010000010100ULL, 0x0100010000010100ULL, 0x0001010000010100ULL, 0x0101010000010100ULL,
+        0x0000000100010100ULL, 0x0100000100010100ULL, 0x0001000100010100ULL, 0x0101000100010100ULL,
+        0x0000010100010100ULL, 0x0100010100010100ULL, 0x0001010100010100ULL, 0x0101010100010100ULL,
+        0x0000000001010100ULL, 0x0100000001010100ULL, 0x0001000001010100ULL, 0x0101000001010100ULL,
+        0x0000010001010100ULL, 0x0100010001010100ULL, 0x0001010001010100ULL, 0x0101010001010100ULL,
+        0x0000000101010100ULL, 0x0100000101010100ULL, 0x0001000101010100ULL, 0x0101000101010100ULL,
+        0x0000010101010100ULL, 0x0100010101010100ULL, 0x0001010101010100ULL, 0x0101010101010100ULL,
+        0x0000000000000001ULL, 0x0100000000000001ULL, 0x0001000000000001ULL, 0x0101000000000001ULL,
+        0x0000010000000001ULL, 0x0100010000000001ULL, 0x0001010000000001ULL, 0x0101010000000001ULL,
+        0x0000000100000001ULL, 0x0100000100000001ULL, 0x0001000100000001ULL, 0x0101000100000001ULL,
+        0x0000010100000001ULL, 0x0100010100000001ULL, 0x0001010100000001ULL, 0x0101010100000001ULL,
+        0x0000000001000001ULL, 0x0100000001000001ULL, 0x0001000001000001ULL, 0x0101000001000001ULL,
+        0x0000010001000001ULL, 0x0100010001000001ULL, 0x0001010001000001ULL, 0x0101010001000001ULL,
+        0x0000000101000001ULL, 0x0100000101000001ULL, 0x0001000101000001ULL, 0x0101000101000001ULL,
+        0x0000010101000001ULL, 0x0100010101000001ULL, 0x0001010101000001ULL, 0x0101010101000001ULL,
+        0x0000000000010001ULL, 0x0100000000010001ULL, 0x0001000000010001ULL, 0x0101000000010001ULL,
+        0x0000010000010001ULL, 0x0100010000010001ULL, 0x0001010000010001ULL, 0x0101010000010001ULL,
+        0x0000000100010001ULL, 0x0100000100010001ULL, 0x0001000100010001ULL, 0x0101000100010001ULL,
+        0x0000010100010001ULL, 0x0100010100010001ULL, 0x0001010100010001ULL, 0x0101010100010001ULL,
+        0x0000000001010001ULL, 0x0100000001010001ULL, 0x0001000001010001ULL, 0x0101000001010001ULL,
+        0x0000010001010001ULL, 0x0100010001010001ULL, 0x0001010001010001ULL, 0x0101010001010001ULL,
+        0x0000000101010001ULL, 0x0100000101010001ULL, 0x0001000101010001ULL, 0x0101000101010001ULL,
+        0x0000010101010001ULL, 0x0100010101010001ULL, 0x0001010101010001ULL, 0x0101010101010001ULL,
+        0x0000000000000101ULL, 0x0100000000000101ULL, 0x0001000000000101ULL, 0x0101000000000101ULL,
+        0x0000010000000101ULL, 0x0100010000000101ULL, 0x0001010000000101ULL, 0x0101010000000101ULL,
+        0x0000000100000101ULL, 0x0100000100000101ULL, 0x0001000100000101ULL, 0x0101000100000101ULL,
+        0x0000010100000101ULL, 0x0100010100000101ULL, 0x0001010100000101ULL, 0x0101010100000101ULL,
+        0x0000000001000101ULL, 0x0100000001000101ULL, 0x0001000001000101ULL, 0x0101000001000101ULL,
+        0x0000010001000101ULL, 0x0100010001000101ULL, 0x0001010001000101ULL, 0x0101010001000101ULL,
+        0x0000000101000101ULL, 0x0100000101000101ULL, 0x0001000101000101ULL, 0x0101000101000101ULL,
+        0x0000010101000101ULL, 0x0100010101000101ULL, 0x0001010101000101ULL, 0x0101010101000101ULL,
+        0x0000000000010101ULL, 0x0100000000010101ULL, 0x0001000000010101ULL, 0x0101000000010101ULL,
+        0x0000010000010101ULL, 0x0100010000010101ULL, 0x0001010000010101ULL, 0x0101010000010101ULL,
+        0x0000000100010101ULL, 0x0100000100010101ULL, 0x0001000100010101ULL, 0x0101000100010101ULL,
+        0x0000010100010101ULL, 0x0100010100010101ULL, 0x0001010100010101ULL, 0x0101010100010101ULL,
+        0x0000000001010101ULL, 0x0100000001010101ULL, 0x0001000001010101ULL, 0x0101000001010101ULL,
+        0x0000010001010101ULL, 0x0100010001010101ULL, 0x0001010001010101ULL, 0x0101010001010101ULL,
+        0x0000000101010101ULL, 0x0100000101010101ULL, 0x0001000101010101ULL, 0x0101000101010101ULL,
+        0x0000010101010101ULL, 0x0100010101010101ULL, 0x0001010101010101ULL, 0x0101010101010101ULL},
+    {
+        0x0000000000000000ULL, 0x8000000000000000ULL, 0x0080000000000000ULL, 0x8080000000000000ULL,
+        0x0000800000000000ULL, 0x8000800000000000ULL, 0x0080800000000000ULL, 0x8080800000000000ULL,
+        0x0000008000000000ULL, 0x8000008000000000ULL, 0x0080008000000000ULL, 0x8080008000000000ULL,
+        0x0000808000000000ULL, 0x8000808000000000ULL, 0x0080808000000000ULL, 0x8080808000000000ULL,
+        0x0000000080000000ULL, 0x8000000080000000ULL, 0x0080000080000000ULL, 0x8080000080000000ULL,
+        0x0000800080000000ULL, 0x8000800080000000ULL, 0x0080800080000000ULL, 0x8080800080000000ULL,
+        0x0000008080000000ULL, 0x8000008080000000ULL, 0x0080008080000000ULL, 0x8080008080000000ULL,
+        0x0000808080000000ULL, 0x8000808080000000ULL, 0x0080808080000000ULL, 0x8080808080000000ULL,
+        0x0000000000800000ULL, 0x8000000000800000ULL, 0x0080000000800000ULL, 0x8080000000800000ULL,
+        0x0000800000800000ULL, 0x8000800000800000ULL, 0x0080800000800000ULL, 0x8080800000800000ULL,
+        0x0000008000800000ULL, 0x8000008000800000ULL, 0x0080008000800000ULL, 0x8080008000800000ULL,
+        0x0000808000800000ULL, 0x8000808000800000ULL, 0x0080808000800000ULL, 0x8080808000800000ULL,
+        0x0000000080800000ULL, 0x8000000080800000ULL, 0x0080000080800000ULL, 0x8080000080800000ULL,
+        0x0000800080800000ULL, 0x8000800080800000ULL, 0x0080800080800000ULL, 0x8080800080800000ULL,
+        0x0000008080800000ULL, 0x8000008080800000ULL, 0x0080008080800000ULL, 0x8080008080800000ULL,
+        0x0000808080800000ULL, 0x8000808080800000ULL, 0x0080808080800000ULL, 0x8080808080800000ULL,
+        0x0000000000008000ULL, 0x8000000000008000ULL, 0x0080000000008000ULL, 0x8080000000008000ULL,
+        0x0000800000008000ULL, 0x8000800000008000ULL, 0x0080800000008000ULL, 0x8080800000008000ULL,
+        0x0000008000008000ULL, 0x8000008000008000ULL, 0x0080008000008000ULL, 0x8080008000008000ULL,
+        0x0000808000008000ULL, 0x8000808000008000ULL, 0x0080808000008000ULL, 0x8080808000008000ULL,
+        0x0000000080008000ULL, 0x8000000080008000ULL, 0x0080000080008000ULL, 0x8080000080008000ULL,
+        0x0000800080008000ULL, 0x8000800080008000ULL, 0x0080800080008000ULL, 0x8080800080008000ULL,
+        0x0000008080008000ULL, 0x8000008080008000ULL, 0x0080008080008000ULL, 0x8080008080008000ULL,
+        0x0000808080008000ULL, 0x8000808080008000ULL, 0x0080808080008000ULL, 0x8080808080008000ULL,
+        0x0000000000808000ULL, 0x8000000000808000ULL, 0x0080000000808000ULL, 0x8080000000808000ULL,
+        0x0000800000808000ULL, 0x8000800000808000ULL, 0x0080800000808000ULL, 0x8080800000808000ULL,
+        0x0000008000808000ULL, 0x8000008000808000ULL, 0x0080008000808000ULL, 0x8080008000808000ULL,
+        0x0000808000808000ULL, 0x8000808000808000ULL, 0x0080808000808000ULL, 0x8080808000808000ULL,
+        0x0000000080808000ULL, 0x8000000080808000ULL, 0x0080000080808000ULL, 0x8080000080808000ULL,
+        0x0000800080808000ULL, 0x8000800080808000ULL, 0x0080800080808000ULL, 0x8080800080808000ULL,
+        0x0000008080808000ULL, 0x8000008080808000ULL, 0x0080008080808000ULL, 0x8080008080808000ULL,
+        0x0000808080808000ULL, 0x8000808080808000ULL, 0x0080808080808000ULL, 0x8080808080808000ULL,
+        0x0000000000000080ULL, 0x8000000000000080ULL, 0x0080000000000080ULL, 0x8080000000000080ULL,
+        0x0000800000000080ULL, 0x8000800000000080ULL, 0x0080800000000080ULL, 0x8080800000000080ULL,
+        0x0000008000000080ULL, 0x8000008000000080ULL, 0x0080008000000080ULL, 0x8080008000000080ULL,
+        0x0000808000000080ULL, 0x8000808000000080ULL, 0x0080808000000080ULL, 0x8080808000000080ULL,
+        0x0000000080000080ULL, 0x8000000080000080ULL, 0x0080000080000080ULL, 0x8080000080000080ULL,
+        0x0000800080000080ULL, 0x8000800080000080ULL, 0x0080800080000080ULL, 0x8080800080000080ULL,
+        0x0000008080000080ULL, 0x8000008080000080ULL, 0x0080008080000080ULL, 0x8080008080000080ULL,
+        0x0000808080000080ULL, 0x8000808080000080ULL, 0x0080808080000080ULL, 0x8080808080000080ULL,
+        0x0000000000800080ULL, 0x8000000000800080ULL, 0x0080000000800080ULL, 0x8080000000800080ULL,
+        0x0000800000800080ULL, 0x8000800000800080ULL, 0x0080800000800080ULL, 0x8080800000800080ULL,
+        0x0000008000800080ULL, 0x8000008000800080ULL, 0x0080008000800080ULL, 0x8080008000800080ULL,
+        0x0000808000800080ULL, 0x8000808000800080ULL, 0x0080808000800080ULL, 0x8080808000800080ULL,
+        0x0000000080800080ULL, 0x8000000080800080ULL, 0x0080000080800080ULL, 0x8080000080800080ULL,
+        0x0000800080800080ULL, 0x8000800080800080ULL, 0x0080800080800080ULL, 0x8080800080800080ULL,
+        0x0000008080800080ULL, 0x8000008080800080ULL, 0x0080008080800080ULL, 0x8080008080800080ULL,
+        0x0000808080800080ULL, 0x8000808080800080ULL, 0x0080808080800080ULL, 0x8080808080800080ULL,
+        0x0000000000008080ULL, 0x8000000000008080ULL, 0x0080000000008080ULL, 0x8080000000008080ULL,
+        0x0000800000008080ULL, 0x8000800000008080ULL, 0x0080800000008080ULL, 0x8080800000008080ULL,
+        0x0000008000008080ULL, 0x8000008000008080ULL, 0x0080008000008080ULL, 0x8080008000008080ULL,
+        0x0000808000008080ULL, 0x8000808000008080ULL, 0x0080808000008080ULL, 0x8080808000008080ULL,
+        0x0000000080008080ULL, 0x8000000080008080ULL, 0x0080000080008080ULL, 0x8080000080008080ULL,
+        0x0000800080008080ULL, 0x8000800080008080ULL, 0x0080800080008080ULL, 0x8080800080008080ULL,
+        0x0000008080008080ULL, 0x8000008080008080ULL, 0x0080008080008080ULL, 0x8080008080008080ULL,
+        0x0000808080008080ULL, 0x8000808080008080ULL, 0x0080808080008080ULL, 0x8080808080008080ULL,
+        0x0000000000808080ULL, 0x8000000000808080ULL, 0x0080000000808080ULL, 0x8080000000808080ULL,
+        0x0000800000808080ULL, 0x8000800000808080ULL, 0x0080800000808080ULL, 0x8080800000808080ULL,
+        0x0000008000808080ULL, 0x8000008000808080ULL, 0x0080008000808080ULL, 0x8080008000808080ULL,
+        0x0000808000808080ULL, 0x8000808000808080ULL, 0x0080808000808080ULL, 0x8080808000808080ULL,
+        0x0000000080808080ULL, 0x8000000080808080ULL, 0x0080000080808080ULL, 0x8080000080808080ULL,
+        0x0000800080808080ULL, 0x8000800080808080ULL, 0x0080800080808080ULL, 0x8080800080808080ULL,
+        0x0000008080808080ULL, 0x8000008080808080ULL, 0x0080008080808080ULL, 0x8080008080808080ULL,
+        0x0000808080808080ULL, 0x8000808080808080ULL, 0x0080808080808080ULL, 0x8080808080808080ULL},
+    {
+        0x0000000000000000ULL, 0x2000000000000000ULL, 0x0020000000000000ULL, 0x2020000000000000ULL,
+        0x0000200000000000ULL, 0x2000200000000000ULL, 0x0020200000000000ULL, 0x2020200000000000ULL,
+        0x0000002000000000ULL, 0x2000002000000000ULL, 0x0020002000000000ULL, 0x2020002000000000ULL,
+        0x0000202000000000ULL, 0x2000202000000000ULL, 0x0020202000000000ULL, 0x2020202000000000ULL,
+        0x0000000020000000ULL, 0x2000000020000000ULL, 0x0020000020000000ULL, 0x2020000020000000ULL,
+        0x0000200020000000ULL, 0x2000200020000000ULL, 0x0020200020000000ULL, 0x2020200020000000ULL,
+        0x0000002020000000ULL, 0x2000002020000000ULL, 0x0020002020000000ULL, 0x2020002020000000ULL,
+        0x0000202020000000ULL, 0x2000202020000000ULL, 0x0020202020000000ULL, 0x2020202020000000ULL,
+        0x0000000000200000ULL, 0x2000000000200000ULL, 0x0020000000200000ULL, 0x2020000000200000ULL,
+        0x0000200000200000ULL, 0x2000200000200000ULL, 0x0020200000200000ULL, 0x2020200000200000ULL,
+        0x0000002000200000ULL, 0x2000002000200000ULL, 0x0020002000200000ULL, 0x2020002000200000ULL,
+        0x0000202000200000ULL, 0x2000202000200000ULL, 0x0020202000200000ULL, 0x2020202000200000ULL,
+        0x0000000020200000ULL, 0x2000000020200000ULL, 0x0020000020200000ULL, 0x2020000020200000ULL,
+        0x0000200020200000ULL, 0x2000200020200000ULL, 0x0020200020200000ULL, 0x2020200020200000ULL,
+        0x0000002020200000ULL, 0x2000002020200000ULL, 0x0020002020200000ULL, 0x2020002020200000ULL,
+        0x0000202020200000ULL, 0x2000202020200000ULL, 0x0020202020200000ULL, 0x2020202020200000ULL,
+        0x0000000000002000ULL, 0x2000000000002000ULL, 0x0020000000002000ULL, 0x2020000000002000ULL,
+        0x0000200000002000ULL, 0x2000200000002000ULL, 0x0020200000002000ULL, 0x2020200000002000ULL,
+        0x0000002000002000ULL, 0x2000002000002000ULL, 0x0020002000002000ULL, 0x2020002000002000ULL,
+        0x0000202000002000ULL, 0x2000202000002000ULL, 0x0020202000002000ULL, 0x2020202000002000ULL,
+        0x0000000020002000ULL, 0x2000000020002000ULL, 0x0020000020002000ULL, 0x2020000020002000ULL,
+        0x0000200020002000ULL, 0x2000200020002000ULL, 0x0020200020002000ULL, 0x2020200020002000ULL,
+        0x0000002020002000ULL, 0x2000002020002000ULL, 0x0020002020002000ULL, 0x2020002020002000ULL,
+        0x0000202020002000ULL, 0x2000202020002000ULL, 0x0020202020002000ULL, 0x2020202020002000ULL,
+        0x0000000000202000ULL, 0x2000000000202000ULL, 0x0020000000202000ULL, 0x2020000000202000ULL,
+        0x0000200000202000ULL, 0x2000200000202000ULL, 0x0020200000202000ULL, 0x2020200000202000ULL,
+        0x0000002000202000ULL, 0x2000002000202000ULL, 0x0020002000202000ULL, 0x2020002000202000ULL,
+        0x0000202000202000ULL, 0x2000202000202000ULL, 0x0020202000202000ULL, 0x2020202000202000ULL,
+        0x0000000020202000ULL, 0x2000000020202000ULL, 0x0020000020202000ULL, 0x2020000020202000ULL,
+        0x0000200020202000ULL, 0x2000200020202000ULL, 0x0020200020202000ULL, 0x2020200020202000ULL,
+        0x0000002020202000ULL, 0x2000002020202000ULL, 0x0020002020202000ULL, 0x2020002020202000ULL,
+        0x0000202020202000ULL, 0x2000202020202000ULL, 0x0020202020202000ULL, 0x2020202020202000ULL,
+        0x0000000000000020ULL, 0x2000000000000020ULL, 0x0020000000000020ULL, 0x2020000000000020ULL,
+        0x0000200000000020ULL, 0x2000200000000020ULL, 0x0020200000000020ULL, 0x2020200000000020ULL,
+        0x0000002000000020ULL, 0x2000002000000020ULL, 0x0020002000000020ULL, 0x2020002000000020ULL,
+        0x0000202000000020ULL, 0x2000202000000020ULL, 0x0020202000000020ULL, 0x2020202000000020ULL,
+        0x0000000020000020ULL, 0x2000000020000020ULL, 0x0020000020000020ULL, 0x2020000020000020ULL,
+        0x0000200020000020ULL, 0x2000200020000020ULL, 0x0020200020000020ULL, 0x2020200020000020ULL,
+        0x0000002020000020ULL, 0x2000002020000020ULL, 0x0020002020000020ULL, 0x2020002020000020ULL,
+        0x0000202020000020ULL, 0x2000202020000020ULL, 0x0020202020000020ULL, 0x2020202020000020ULL,
+        0x0000000000200020ULL, 0x2000000000200020ULL, 0x0020000000200020ULL, 0x2020000000200020ULL,
+        0x0000200000200020ULL, 0x2000200000200020ULL, 0x0020200000200020ULL, 0x2020200000200020ULL,
+        0x0000002000200020ULL, 0x2000002000200020ULL, 0x0020002000200020ULL, 0x2020002000200020ULL,
+        0x0000202000200020ULL, 0x2000202000200020ULL, 0x0020202000200020ULL, 0x2020202000200020ULL,
+        0x0000000020200020ULL, 0x2000000020200020ULL, 0x0020000020200020ULL, 0x2020000020200020ULL,
+        0x0000200020200020ULL, 0x2000200020200020ULL, 0x0020200020200020ULL, 0x2020200020200020ULL,
+        0x0000002020200020ULL, 0x2000002020200020ULL, 0x0020002020200020ULL, 0x2020002020200020ULL,
+        0x0000202020200020ULL, 0x2000202020200020ULL, 0x0020202020200020ULL, 0x2020202020200020ULL,
+        0x0000000000002020ULL, 0x2000000000002020ULL, 0x0020000000002020ULL, 0x2020000000002020ULL,
+        0x0000200000002020ULL, 0x2000200000002020ULL, 0x0020200000002020ULL, 0x2020200000002020ULL,
+        0x0000002000002020ULL, 0x2000002000002020ULL, 0x0020002000002020ULL, 0x2020002000002020ULL,
+        0x0000202000002020ULL, 0x2000202000002020ULL, 0x0020202000002020ULL, 0x2020202000002020ULL,
+        0x0000000020002020ULL, 0x2000000020002020ULL, 0x0020000020002020ULL, 0x2020000020002020ULL,
+        0x0000200020002020ULL, 0x2000200020002020ULL, 0x0020200020002020ULL, 0x2020200020002020ULL,
+        0x0000002020002020ULL, 0x2000002020002020ULL, 0x0020002020002020ULL, 0x2020002020002020ULL,
+        0x0000202020002020ULL, 0x2000202020002020ULL, 0x0020202020002020ULL, 0x2020202020002020ULL,
+        0x0000000000202020ULL, 0x2000000000202020ULL, 0x0020000000202020ULL, 0x2020000000202020ULL,
+        0x0000200000202020ULL, 0x2000200000202020ULL, 0x0020200000202020ULL, 0x2020200000202020ULL,
+        0x0000002000202020ULL, 0x2000002000202020ULL, 0x0020002000202020ULL, 0x2020002000202020ULL,
+        0x0000202000202020ULL, 0x2000202000202020ULL, 0x0020202000202020ULL, 0x2020202000202020ULL,
+        0x0000000020202020ULL, 0x2000000020202020ULL, 0x0020000020202020ULL, 0x2020000020202020ULL,
+        0x0000200020202020ULL, 0x2000200020202020ULL, 0x0020200020202020ULL, 0x2020200020202020ULL,
+        0x0000002020202020ULL, 0x2000002020202020ULL, 0x0020002020202020ULL, 0x2020002020202020ULL,
+        0x0000202020202020ULL, 0x2000202020202020ULL, 0x0020202020202020ULL, 0x2020202020202020ULL},
+    {
+        0x0000000000000000ULL, 0x0800000000000000ULL, 0x0008000000000000ULL, 0x0808000000000000ULL,
+        0x0000080000000000ULL, 0x0800080000000000ULL, 0x0008080000000000ULL, 0x0808080000000000ULL,
+        0x0000000800000000ULL, 0x0800000800000000ULL, 0x0008000800000000ULL, 0x0808000800000000ULL,
+        0x0000080800000000ULL, 0x0800080800000000ULL, 0x0008080800000000ULL, 0x0808080800000000ULL,
+        0x0000000008000000ULL, 0x0800000008000000ULL, 0x0008000008000000ULL, 0x0808000008000000ULL,
+        0x0000080008000000ULL, 0x0800080008000000ULL, 0x0008080008000000ULL, 0x0808080008000000ULL,
+        0x0000000808000000ULL, 0x0800000808000000ULL, 0x0008000808000000ULL, 0x0808000808000000ULL,
+        0x0000080808000000ULL, 0x0800080808000000ULL, 0x0008080808000000ULL, 0x0808080808000000ULL,
+        0x0000000000080000ULL, 0x0800000000080000ULL, 0x0008000000080000ULL, 0x0808000000080000ULL,
+        0x0000080000080000ULL, 0x0800080000080000ULL, 0x0008080000080000ULL, 0x0808080000080000ULL,
+        0x0000000800080000ULL, 0x0800000800080000ULL, 0x0008000800080000ULL, 0x0808000800080000ULL,
+        0x0000080800080000ULL, 0x0800080800080000ULL, 0x0008080800080000ULL, 0x0808080800080000ULL,
+        0x0000000008080000ULL, 0x0800000008080000ULL, 0x0008000008080000ULL, 0x0808000008080000ULL,
+        0x0000080008080000ULL, 0x0800080008080000ULL, 0x0008080008080000ULL, 0x0808080008080000ULL,
+        0x0000000808080000ULL, 0x0800000808080000ULL, 0x0008000808080000ULL, 0x0808000808080000ULL,
+        0x0000080808080000ULL, 0x0800080808080000ULL, 0x0008080808080000ULL, 0x0808080808080000ULL,
+        0x0000000000000800ULL, 0x0800000000000800ULL, 0x0008000000000800ULL, 0x0808000000000800ULL,
+        0x0000080000000800ULL, 0x0800080000000800ULL, 0x0008080000000800ULL, 0x0808080000000800ULL,
+        0x0000000800000800ULL, 0x0800000800000800ULL, 0x0008000800000800ULL, 0x0808000800000800ULL,
+        0x0000080800000800ULL, 0x0800080800000800ULL, 0x0008080800000800ULL, 0x0808080800000800ULL,
+        0x0000000008000800ULL, 0x0800000008000800ULL, 0x0008000008000800ULL, 0x0808000008000800ULL,
+        0x0000080008000800ULL, 0x0800080008000800ULL, 0x0008080008000800ULL, 0x0808080008000800ULL,
+        0x0000000808000800ULL, 0x0800000808000800ULL, 0x0008000808000800ULL, 0x0808000808000800ULL,
+        0x0000080808000800ULL, 0x0800080808000800ULL, 0x0008080808000800ULL, 0x0808080808000800ULL,
+        0x0000000000080800ULL, 0x0800000000080800ULL, 0x0008000000080800ULL, 0x0808000000080800ULL,
+        0x0000080000080800ULL, 0x0800080000080800ULL, 0x0008080000080800ULL, 0x0808080000080800ULL,
+        0x0000000800080800ULL, 0x0800000800080800ULL, 0x0008000800080800ULL, 0x0808000800080800ULL,
+        0x0000080800080800ULL, 0x0800080800080800ULL, 0x0008080800080800ULL, 0x0808080800080800ULL,
+        0x0000000008080800ULL, 0x0800000008080800ULL, 0x0008000008080800ULL, 0x0808000008080800ULL,
+        0x0000080008080800ULL, 0x0800080008080800ULL, 0x0008080008080800ULL, 0x0808080008080800ULL,
+        0x0000000808080800ULL, 0x0800000808080800ULL, 0x0008000808080800ULL, 0x0808000808080800ULL,
+        0x0000080808080800ULL, 0x0800080808080800ULL, 0x0008080808080800ULL, 0x0808080808080800ULL,
+        0x0000000000000008ULL, 0x0800000000000008ULL, 0x0008000000000008ULL, 0x0808000000000008ULL,
+        0x0000080000000008ULL, 0x0800080000000008ULL, 0x0008080000000008ULL, 0x0808080000000008ULL,
+        0x0000000800000008ULL, 0x0800000800000008ULL, 0x0008000800000008ULL, 0x0808000800000008ULL,
+        0x0000080800000008ULL, 0x0800080800000008ULL, 0x0008080800000008ULL, 0x0808080800000008ULL,
+        0x0000000008000008ULL, 0x0800000008000008ULL, 0x0008000008000008ULL, 0x0808000008000008ULL,
+        0x0000080008000008ULL, 0x0800080008000008ULL, 0x0008080008000008ULL, 0x0808080008000008ULL,
+        0x0000000808000008ULL, 0x0800000808000008ULL, 0x0008000808000008ULL, 0x0808000808000008ULL,
+        0x0000080808000008ULL, 0x0800080808000008ULL, 0x0008080808000008ULL, 0x0808080808000008ULL,
+        0x0000000000080008ULL, 0x0800000000080008ULL, 0x0008000000080008ULL, 0x0808000000080008ULL,
+        0x0000080000080008ULL, 0x0800080000080008ULL, 0x0008080000080008ULL, 0x0808080000080008ULL,
+        0x0000000800080008ULL, 0x0800000800080008ULL, 0x0008000800080008ULL, 0x0808000800080008ULL,
+        0x0000080800080008ULL, 0x0800080800080008ULL, 0x0008080800080008ULL, 0x0808080800080008ULL,
+        0x0000000008080008ULL, 0x0800000008080008ULL, 0x0008000008080008ULL, 0x0808000008080008ULL,
+        0x0000080008080008ULL, 0x0800080008080008ULL, 0x0008080008080008ULL, 0x0808080008080008ULL,
+        0x0000000808080008ULL, 0x0800000808080008ULL, 0x0008000808080008ULL, 0x0808000808080008ULL,
+        0x0000080808080008ULL, 0x0800080808080008ULL, 0x0008080808080008ULL, 0x0808080808080008ULL,
+        0x0000000000000808ULL, 0x0800000000000808ULL, 0x0008000000000808ULL, 0x0808000000000808ULL,
+        0x0000080000000808ULL, 0x0800080000000808ULL, 0x0008080000000808ULL, 0x0808080000000808ULL,
+        0x0000000800000808ULL, 0x0800000800000808ULL, 0x0008000800000808ULL, 0x0808000800000808ULL,
+        0x0000080800000808ULL, 0x0800080800000808ULL, 0x0008080800000808ULL, 0x0808080800000808ULL,
+        0x0000000008000808ULL, 0x0800000008000808ULL, 0x0008000008000808ULL, 0x0808000008000808ULL,
+        0x0000080008000808ULL, 0x0800080008000808ULL, 0x0008080008000808ULL, 0x0808080008000808ULL,
+        0x0000000808000808ULL, 0x0800000808000808ULL, 0x0008000808000808ULL, 0x0808000808000808ULL,
+        0x0000080808000808ULL, 0x0800080808000808ULL, 0x0008080808000808ULL, 0x0808080808000808ULL,
+        0x0000000000080808ULL, 0x0800000000080808ULL, 0x0008000000080808ULL, 0x0808000000080808ULL,
+        0x0000080000080808ULL, 0x0800080000080808ULL, 0x0008080000080808ULL, 0x0808080000080808ULL,
+        0x0000000800080808ULL, 0x0800000800080808ULL, 0x0008000800080808ULL, 0x0808000800080808ULL,
+        0x0000080800080808ULL, 0x0800080800080808ULL, 0x0008080800080808ULL, 0x0808080800080808ULL,
+        0x0000000008080808ULL, 0x0800000008080808ULL, 0x0008000008080808ULL, 0x0808000008080808ULL,
+        0x0000080008080808ULL, 0x0800080008080808ULL, 0x0008080008080808ULL, 0x0808080008080808ULL,
+        0x0000000808080808ULL, 0x0800000808080808ULL, 0x0008000808080808ULL, 0x0808000808080808ULL,
+        0x0000080808080808ULL, 0x0800080808080808ULL, 0x0008080808080808ULL, 0x0808080808080808ULL},
+    {
+        0x0000000000000000ULL, 0x0200000000000000ULL, 0x0002000000000000ULL, 0x0202000000000000ULL,
+        0x0000020000000000ULL, 0x0200020000000000ULL, 0x0002020000000000ULL, 0x0202020000000000ULL,
+        0x0000000200000000ULL, 0x0200000200000000ULL, 0x0002000200000000ULL, 0x0202000200000000ULL,
+        0x0000020200000000ULL, 0x0200020200000000ULL, 0x0002020200000000ULL, 0x0202020200000000ULL,
+        0x0000000002000000ULL, 0x0200000002000000ULL, 0x0002000002000000ULL, 0x0202000002000000ULL,
+        0x0000020002000000ULL, 0x0200020002000000ULL, 0x0002020002000000ULL, 0x0202020002000000ULL,
+        0x0000000202000000ULL, 0x0200000202000000ULL, 0x0002000202000000ULL, 0x0202000202000000ULL,
+        0x0000020202000000ULL, 0x0200020202000000ULL, 0x0002020202000000ULL, 0x0202020202000000ULL,
+        0x0000000000020000ULL, 0x0200000000020000ULL, 0x0002000000020000ULL, 0x0202000000020000ULL,
+        0x0000020000020000ULL, 0x0200020000020000ULL, 0x0002020000020000ULL, 0x0202020000020000ULL,
+        0x0000000200020000ULL, 0x0200000200020000ULL, 0x0002000200020000ULL, 0x0202000200020000ULL,
+        0x0000020200020000ULL, 0x0200020200020000ULL, 0x0002020200020000ULL, 0x0202020200020000ULL,
+        0x0000000002020000ULL, 0x0200000002020000ULL, 0x0002000002020000ULL, 0x0202000002020000ULL,
+        0x0000020002020000ULL, 0x0200020002020000ULL, 0x0002020002020000ULL, 0x0202020002020000ULL,
+        0x0000000202020000ULL, 0x0200000202020000ULL, 0x0002000202020000ULL, 0x0202000202020000ULL,
+        0x0000020202020000ULL, 0x0200020202020000ULL, 0x0002020202020000ULL, 0x0202020202020000ULL,
+        0x0000000000000200ULL, 0x0200000000000200ULL, 0x0002000000000200ULL, 0x0202000000000200ULL,
+        0x0000020000000200ULL, 0x0200020000000200ULL, 0x0002020000000200ULL, 0x0202020000000200ULL,
+        0x0000000200000200ULL, 0x0200000200000200ULL, 0x0002000200000200ULL, 0x0202000200000200ULL,
+        0x0000020200000200ULL, 0x0200020200000200ULL, 0x0002020200000200ULL, 0x0202020200000200ULL,
+        0x0000000002000200ULL, 0x0200000002000200ULL, 0x0002000002000200ULL, 0x0202000002000200ULL,
+        0x0000020002000200ULL, 0x0200020002000200ULL, 0x0002020002000200ULL, 0x0202020002000200ULL,
+        0x0000000202000200ULL, 0x0200000202000200ULL, 0x0002000202000200ULL, 0x0202000202000200ULL,
+        0x0000020202000200ULL, 0x0200020202000200ULL, 0x0002020202000200ULL, 0x0202020202000200ULL,
+        0x0000000000020200ULL, 0x0200000000020200ULL, 0x0002000000020200ULL, 0x0202000000020200ULL,
+        0x0000020000020200ULL, 0x0200020000020200ULL, 0x0002020000020200ULL, 0x0202020000020200ULL,
+        0x0000000200020200ULL, 0x0200000200020200ULL, 0x0002000200020200ULL, 0x0202000200020200ULL,
+        0x0000020200020200ULL, 0x0200020200020200ULL, 0x0002020200020200ULL, 0x0202020200020200ULL,
+        0x0000000002020200ULL, 0x0200000002020200ULL, 0x0002000002020200ULL, 0x0202000002020200ULL,
+        0x0000020002020200ULL, 0x0200020002020200ULL, 0x0002020002020200ULL, 0x0202020002020200ULL,
+        0x0000000202020200ULL, 0x0200000202020200ULL, 0x0002000202020200ULL, 0x0202000202020200ULL,
+        0x0000020202020200ULL, 0x0200020202020200ULL, 0x0002020202020200ULL, 0x0202020202020200ULL,
+        0x0000000000000002ULL, 0x0200000000000002ULL, 0x0002000000000002ULL, 0x0202000000000002ULL,
+        0x0000020000000002ULL, 0x0200020000000002ULL, 0x0002020000000002ULL, 0x0202020000000002ULL,
+        0x0000000200000002ULL, 0x0200000200000002ULL, 0x0002000200000002ULL, 0x0202000200000002ULL,
+        0x0000020200000002ULL, 0x0200020200000002ULL, 0x0002020200000002ULL, 0x0202020200000002ULL,
+        0x0000000002000002ULL, 0x0200000002000002ULL, 0x0002000002000002ULL, 0x0202000002000002ULL,
+        0x0000020002000002ULL, 0x0200020002000002ULL, 0x0002020002000002ULL, 0x0202020002000002ULL,
+        0x0000000202000002ULL, 0x0200000202000002ULL, 0x0002000202000002ULL, 0x0202000202000002ULL,
+        0x0000020202000002ULL, 0x0200020202000002ULL, 0x0002020202000002ULL, 0x0202020202000002ULL,
+        0x0000000000020002ULL, 0x0200000000020002ULL, 0x0002000000020002ULL, 0x0202000000020002ULL,
+        0x0000020000020002ULL, 0x0200020000020002ULL, 0x0002020000020002ULL, 0x0202020000020002ULL,
+        0x0000000200020002ULL, 0x0200000200020002ULL, 0x0002000200020002ULL, 0x0202000200020002ULL,
+        0x0000020200020002ULL, 0x0200020200020002ULL, 0x0002020200020002ULL, 0x0202020200020002ULL,
+        0x0000000002020002ULL, 0x0200000002020002ULL, 0x0002000002020002ULL, 0x0202000002020002ULL,
+        0x0000020002020002ULL, 0x0200020002020002ULL, 0x0002020002020002ULL, 0x0202020002020002ULL,
+        0x0000000202020002ULL, 0x0200000202020002ULL, 0x0002000202020002ULL, 0x0202000202020002ULL,
+        0x0000020202020002ULL, 0x0200020202020002ULL, 0x0002020202020002ULL, 0x0202020202020002ULL,
+        0x0000000000000202ULL, 0x0200000000000202ULL, 0x0002000000000202ULL, 0x0202000000000202ULL,
+        0x0000020000000202ULL, 0x0200020000000202ULL, 0x0002020000000202ULL, 0x0202020000000202ULL,
+        0x0000000200000202ULL, 0x0200000200000202ULL, 0x0002000200000202ULL, 0x0202000200000202ULL,
+        0x0000020200000202ULL, 0x0200020200000202ULL, 0x0002020200000202ULL, 0x0202020200000202ULL,
+        0x0000000002000202ULL, 0x0200000002000202ULL, 0x0002000002000202ULL, 0x0202000002000202ULL,
+        0x0000020002000202ULL, 0x0200020002000202ULL, 0x0002020002000202ULL, 0x0202020002000202ULL,
+        0x0000000202000202ULL, 0x0200000202000202ULL, 0x0002000202000202ULL, 0x0202000202000202ULL,
+        0x0000020202000202ULL, 0x0200020202000202ULL, 0x0002020202000202ULL, 0x0202020202000202ULL,
+        0x0000000000020202ULL, 0x0200000000020202ULL, 0x0002000000020202ULL, 0x0202000000020202ULL,
+        0x0000020000020202ULL, 0x0200020000020202ULL, 0x0002020000020202ULL, 0x0202020000020202ULL,
+        0x0000000200020202ULL, 0x0200000200020202ULL, 0x0002000200020202ULL, 0x0202000200020202ULL,
+        0x0000020200020202ULL, 0x0200020200020202ULL, 0x0002020200020202ULL, 0x0202020200020202ULL,
+        0x0000000002020202ULL, 0x0200000002020202ULL, 0x0002000002020202ULL, 0x0202000002020202ULL,
+        0x0000020002020202ULL, 0x0200020002020202ULL, 0x0002020002020202ULL, 0x0202020002020202ULL,
+        0x0000000202020202ULL, 0x0200000202020202ULL, 0x0002000202020202ULL, 0x0202000202020202ULL,
+        0x0000020202020202ULL, 0x0200020202020202ULL, 0x0002020202020202ULL, 0x0202020202020202ULL}
+};
+
+// E扩展: 32位输入按字节查表, 输出48位
+const BYTE DES_E_TABLE[4][256] DES_CACHE_ALIGNED = {
+    {
+        0x0000000000000000ULL, 0x0000002800000000ULL, 0x0000004000000000ULL, 0x0000006800000000ULL,
+        0x0000008000000000ULL, 0x000000A800000000ULL, 0x000000C000000000ULL, 0x000000E800000000ULL,
+        0x0000050000000000ULL, 0x0000052800000000ULL, 0x0000054000000000ULL, 0x0000056800000000ULL,
+        0x0000058000000000ULL, 0x000005A800000000ULL, 0x000005C000000000ULL, 0x000005E800000000ULL,
+        0x00000A0000000000ULL, 0x00000A2800000000ULL, 0x00000A4000000000ULL, 0x00000A6800000000ULL,
+        0x00000A8000000000ULL, 0x00000AA800000000ULL, 0x00000AC000000000ULL, 0x00000AE800000000ULL,
+        0x00000F0000000000ULL, 0x00000F2800000000ULL, 0x00000F4000000000ULL, 0x00000F6800000000ULL,
+        0x00000F8000000000ULL, 0x00000FA800000000ULL, 0x00000FC000000000ULL, 0x00000FE800000000ULL,
+        0x0000100000000000ULL, 0x0000102800000000ULL, 0x0000104000000000ULL, 0x0000106800000000ULL,
+        0x0000108000000000ULL, 0x000010A800000000ULL, 0x000010C000000000ULL, 0x000010E800000000ULL,
+        0x0000150000000000ULL, 0x0000152800000000ULL, 0x0000154000000000ULL, 0x0000156800000000ULL,
+        0x0000158000000000ULL, 0x000015A800000000ULL, 0x000015C000000000ULL, 0x000015E800000000ULL,
+        0x00001A0000000000ULL, 0x00001A2800000000ULL, 0x00001A4000000000ULL, 0x00001A6800000000ULL,
+        0x00001A8000000000ULL, 0x00001AA800000000ULL, 0x00001AC000000000ULL, 0x00001AE800000000ULL,
+        0x00001F0000000000ULL, 0x00001F2800000000ULL, 0x00001F4000000000ULL, 0x00001F6800000000ULL,
+        0x00001F8000000000ULL, 0x00001FA800000000ULL, 0x00001FC000000000ULL, 0x00001FE800000000ULL,
+        0x0000200000000000ULL, 0x0000202800000000ULL, 0x0000204000000000ULL, 0x0000206800000000ULL,
+        0x0000208000000000ULL, 0x000020A800000000ULL, 0x000020C000000000ULL, 0x000020E800000000ULL,
+        0x0000250000000000ULL, 0x0000252800000000ULL, 0x0000254000000000ULL, 0x0000256800000000ULL,
+        0x0000258000000000ULL, 0x000025A800000000ULL, 0x000025C000000000ULL, 0x000025E800000000ULL,
+        0x00002A0000000000ULL, 0x00002A2800000000ULL, 0x00002A4000000000ULL, 0x00002A6800000000ULL,
+        0x00002A8000000000ULL, 0x00002AA800000000ULL, 0x00002AC000000000ULL, 0x00002AE800000000ULL,
+        0x00002F0000000000ULL, 0x00002F2800000000ULL, 0x00002F4000000000ULL, 0x00002F6800000000ULL,
+        0x00002F8000000000ULL, 0x00002FA800000000ULL, 0x00002FC000000000ULL, 0x00002FE800000000ULL,
+        0x0000300000000000ULL, 0x0000302800000000ULL, 0x0000304000000000ULL, 0x0000306800000000ULL,
+        0x0000308000000000ULL, 0x000030A800000000ULL, 0x000030C000000000ULL, 0x000030E800000000ULL,
+        0x0000350000000000ULL, 0x0000352800000000ULL, 0x0000354000000000ULL, 0x0000356800000000ULL,
+        0x0000358000000000ULL, 0x000035A800000000ULL, 0x000035C000000000ULL, 0x000035E800000000ULL,
+        0x00003A0000000000ULL, 0x00003A2800000000ULL, 0x00003A4000000000ULL, 0x00003A6800000000ULL,
+        0x00003A8000000000ULL, 0x00003AA800000000ULL, 0x00003AC000000000ULL, 0x00003AE800000000ULL,
+        0x00003F0000000000ULL, 0x00003F2800000000ULL, 0x00003F4000000000ULL, 0x00003F6800000000ULL,
+        0x00003F8000000000ULL, 0x00003FA800000000ULL, 0x00003FC000000000ULL, 0x00003FE800000000ULL,
+        0x0000400000000001ULL, 0x0000402800000001ULL, 0x0000404000000001ULL, 0x0000406800000001ULL,
+        0x0000408000000001ULL, 0x000040A800000001ULL, 0x000040C000000001ULL, 0x000040E800000001ULL,
+        0x0000450000000001ULL, 0x0000452800000001ULL, 0x0000454000000001ULL, 0x0000456800000001ULL,
+        0x0000458000000001ULL, 0x000045A800000001ULL, 0x000045C000000001ULL, 0x000045E800000001ULL,
+        0x00004A0000000001ULL, 0x00004A2800000001ULL, 0x00004A4000000001ULL, 0x00004A6800000001ULL,
+        0x00004A8000000001ULL, 0x00004AA800000001ULL, 0x00004AC000000001ULL, 0x00004AE800000001ULL,
+        0x00004F0000000001ULL, 0x00004F2800000001ULL, 0x00004F4000000001ULL, 0x00004F6800000001ULL,
+        0x00004F8000000001ULL, 0x00004FA800000001ULL, 0x00004FC000000001ULL, 0x00004FE800000001ULL,
+        0x0000500000000001ULL, 0x0000502800000001ULL, 0x0000504000000001ULL, 0x0000506800000001ULL,
+        0x0000508000000001ULL, 0x000050A800000001ULL, 0x000050C000000001ULL, 0x000050E800000001ULL,
+        0x0000550000000001ULL, 0x0000552800000001ULL, 0x0000554000000001ULL, 0x0000556800000001ULL,
+        0x0000558000000001ULL, 0x000055A800000001ULL, 0x000055C000000001ULL, 0x000055E800000001ULL,
+        0x00005A0000000001ULL, 0x00005A2800000001ULL, 0x00005A4000000001ULL, 0x00005A6800000001ULL,
+        0x00005A8000000001ULL, 0x00005AA800000001ULL, 0x00005AC000000001ULL, 0x00005AE800000001ULL,
+        0x00005F0000000001ULL, 0x00005F2800000001ULL, 0x00005F4000000001ULL, 0x00005F6800000001ULL,
+        0x00005F8000000001ULL, 0x00005FA800000001ULL, 0x00005FC000000001ULL, 0x00005FE800000001ULL,
+        0x0000600000000001ULL, 0x0000602800000001ULL, 0x0000604000000001ULL, 0x0000606800000001ULL,
+        0x0000608000000001ULL, 0x000060A800000001ULL, 0x000060C000000001ULL, 0x000060E800000001ULL,
+        0x0000650000000001ULL, 0x0000652800000001ULL, 0x0000654000000001ULL, 0x0000656800000001ULL,
+        0x0000658000000001ULL, 0x000065A800000001ULL, 0x000065C000000001ULL, 0x000065E800000001ULL,
+        0x00006A0000000001ULL, 0x00006A2800000001ULL, 0x00006A4000000001ULL, 0x00006A6800000001ULL,
+        0x00006A8000000001ULL, 0x00006AA800000001ULL, 0x00006AC000000001ULL, 0x00006AE800000001ULL,
+        0x00006F0000000001ULL, 0x00006F2800000001ULL, 0x00006F4000000001ULL, 0x00006F6800000001ULL,
+        0x00006F8000000001ULL, 0x00006FA800000001ULL, 0x00006FC000000001ULL, 0x00006FE800000001ULL,
+        0x0000700000000001ULL, 0x0000702800000001ULL, 0x0000704000000001ULL, 0x0000706800000001ULL,
+        0x0000708000000001ULL, 0x000070A800000001ULL, 0x000070C000000001ULL, 0x000070E800000001ULL,
+        0x0000750000000001ULL, 0x0000752800000001ULL, 0x0000754000000001ULL, 0x0000756800000001ULL,
+        0x0000758000000001ULL, 0x000075A800000001ULL, 0x000075C000000001ULL, 0x000075E800000001ULL,
+        0x00007A0000000001ULL, 0x00007A2800000001ULL, 0x00007A4000000001ULL, 0x00007A6800000001ULL,
+        0x00007A8000000001ULL, 0x00007AA800000001ULL, 0x00007AC000000001ULL, 0x00007AE800000001ULL,
+        0x00007F0000000001ULL, 0x00007F2800000001ULL, 0x00007F4000000001ULL, 0x00007F6800000001ULL,
+        0x00007F8000000001ULL, 0x00007FA800000001ULL, 0x00007FC000000001ULL, 0x00007FE800000001ULL},
+    {
+        0x0000000000000000ULL, 0x0000000002800000ULL, 0x0000000004000000ULL, 0x0000000006800000ULL,
+        0x0000000008000000ULL, 0x000000000A800000ULL, 0x000000000C000000ULL, 0x000000000E800000ULL,
+        0x0000000050000000ULL, 0x0000000052800000ULL, 0x0000000054000000ULL, 0x0000000056800000ULL,
+        0x0000000058000000ULL, 0x000000005A800000ULL, 0x000000005C000000ULL, 0x000000005E800000ULL,
+        0x00000000A0000000ULL, 0x00000000A2800000ULL, 0x00000000A4000000ULL, 0x00000000A6800000ULL,
+        0x00000000A8000000ULL, 0x00000000AA800000ULL, 0x00000000AC000000ULL, 0x00000000AE800000ULL,
+        0x00000000F0000000ULL, 0x00000000F2800000ULL, 0x00000000F4000000ULL, 0x00000000F6800000ULL,
+        0x00000000F8000000ULL, 0x00000000FA800000ULL, 0x00000000FC000000ULL, 0x00000000FE800000ULL,
+        0x0000000100000000ULL, 0x0000000102800000ULL, 0x0000000104000000ULL, 0x0000000106800000ULL,
+        0x0000000108000000ULL, 0x000000010A800000ULL, 0x000000010C000000ULL, 0x000000010E800000ULL,
+        0x0000000150000000ULL, 0x0000000152800000ULL, 0x0000000154000000ULL, 0x0000000156800000ULL,
+        0x0000000158000000ULL, 0x000000015A800000ULL, 0x000000015C000000ULL, 0x000000015E800000ULL,
+        0x00000001A0000000ULL, 0x00000001A2800000ULL, 0x00000001A4000000ULL, 0x00000001A6800000ULL,
+        0x00000001A8000000ULL, 0x00000001AA800000ULL, 0x00000001AC000000ULL, 0x00000001AE800000ULL,
+        0x00000001F0000000ULL, 0x00000001F2800000ULL, 0x00000001F4000000ULL, 0x00000001F6800000ULL,
+        0x00000001F8000000ULL, 0x00000001FA800000ULL, 0x00000001FC000000ULL, 0x00000001FE800000ULL,
+        0x0000000200000000ULL, 0x0000000202800000ULL, 0x0000000204000000ULL, 0x0000000206800000ULL,
+        0x0000000208000000ULL, 0x000000020A800000ULL, 0x000000020C000000ULL, 0x000000020E800000ULL,
+        0x0000000250000000ULL, 0x0000000252800000ULL, 0x0000000254000000ULL, 0x0000000256800000ULL,
+        0x0000000258000000ULL, 0x000000025A800000ULL, 0x000000025C000000ULL, 0x000000025E800000ULL,
+        0x00000002A0000000ULL, 0x00000002A2800000ULL, 0x00000002A4000000ULL, 0x00000002A6800000ULL,
+        0x00000002A8000000ULL, 0x00000002AA800000ULL, 0x00000002AC000000ULL, 0x00000002AE800000ULL,
+        0x00000002F0000000ULL, 0x00000002F2800000ULL, 0x00000002F4000000ULL, 0x00000002F6800000ULL,
+        0x00000002F8000000ULL, 0x00000002FA800000ULL, 0x00000002FC000000ULL, 0x00000002FE800000ULL,
+        0x0000000300000000ULL, 0x0000000302800000ULL, 0x0000000304000000ULL, 0x0000000306800000ULL,
+        0x0000000308000000ULL, 0x000000030A800000ULL, 0x000000030C000000ULL, 0x000000030E800000ULL,
+        0x0000000350000000ULL, 0x0000000352800000ULL, 0x0000000354000000ULL, 0x0000000356800000ULL,
+        0x0000000358000000ULL, 0x000000035A800000ULL, 0x000000035C000000ULL, 0x000000035E800000ULL,
+        0x00000003A0000000ULL, 0x00000003A2800000ULL, 0x00000003A4000000ULL, 0x00000003A6800000ULL,
+        0x00000003A8000000ULL, 0x00000003AA800000ULL, 0x00000003AC000000ULL, 0x00000003AE800000ULL,
+        0x00000003F0000000ULL, 0x00000003F2800000ULL, 0x00000003F4000000ULL, 0x00000003F6800000ULL,
+        0x00000003F8000000ULL, 0x00000003FA800000ULL, 0x00000003FC000000ULL, 0x00000003FE800000ULL,
+        0x0000001400000000ULL, 0x0000001402800000ULL, 0x0000001404000000ULL, 0x0000001406800000ULL,
+        0x0000001408000000ULL, 0x000000140A800000ULL, 0x000000140C000000ULL, 0x000000140E800000ULL,
+        0x0000001450000000ULL, 0x0000001452800000ULL, 0x0000001454000000ULL, 0x0000001456800000ULL,
+        0x0000001458000000ULL, 0x000000145A800000ULL, 0x000000145C000000ULL, 0x000000145E800000ULL,
+        0x00000014A0000000ULL, 0x00000014A2800000ULL, 0x00000014A4000000ULL, 0x00000014A6800000ULL,
+        0x00000014A8000000ULL, 0x00000014AA800000ULL, 0x00000014AC000000ULL, 0x00000014AE800000ULL,
+        0x00000014F0000000ULL, 0x00000014F2800000ULL, 0x00000014F4000000ULL, 0x00000014F6800000ULL,
+        0x00000014F8000000ULL, 0x00000014FA800000ULL, 0x00000014FC000000ULL, 0x00000014FE800000ULL,
+        0x0000001500000000ULL, 0x0000001502800000ULL, 0x0000001504000000ULL, 0x0000001506800000ULL,
+        0x0000001508000000ULL, 0x000000150A800000ULL, 0x000000150C000000ULL, 0x000000150E800000ULL,
+        0x0000001550000000ULL, 0x0000001552800000ULL, 0x0000001554000000ULL, 0x0000001556800000ULL,
+        0x0000001558000000ULL, 0x000000155A800000ULL, 0x000000155C000000ULL, 0x000000155E800000ULL,
+        0x00000015A0000000ULL, 0x00000015A2800000ULL, 0x00000015A4000000ULL, 0x00000015A6800000ULL,
+        0x00000015A8000000ULL, 0x00000015AA800000ULL, 0x00000015AC000000ULL, 0x00000015AE800000ULL,
+        0x00000015F0000000ULL, 0x00000015F2800000ULL, 0x00000015F4000000ULL, 0x00000015F6800000ULL,
+        0x00000015F8000000ULL, 0x00000015FA800000ULL, 0x00000015FC000000ULL, 0x00000015FE800000ULL,
+        0x0000001600000000ULL, 0x0000001602800000ULL, 0x0000001604000000ULL, 0x0000001606800000ULL,
+        0x0000001608000000ULL, 0x000000160A800000ULL, 0x000000160C000000ULL, 0x000000160E800000ULL,
+        0x0000001650000000ULL, 0x0000001652800000ULL, 0x0000001654000000ULL, 0x0000001656800000ULL,
+        0x0000001658000000ULL, 0x000000165A800000ULL, 0x000000165C000000ULL, 0x000000165E800000ULL,
+        0x00000016A0000000ULL, 0x00000016A2800000ULL, 0x00000016A4000000ULL, 0x00000016A6800000ULL,
+        0x00000016A8000000ULL, 0x00000016AA800000ULL, 0x00000016AC000000ULL, 0x00000016AE800000ULL,
+        0x00000016F0000000ULL, 0x00000016F2800000ULL, 0x00000016F4000000ULL, 0x00000016F6800000ULL,
+        0x00000016F8000000ULL, 0x00000016FA800000ULL, 0x00000016FC000000ULL, 0x00000016FE800000ULL,
+        0x0000001700000000ULL, 0x0000001702800000ULL, 0x0000001704000000ULL, 0x0000001706800000ULL,
+        0x0000001708000000ULL, 0x000000170A800000ULL, 0x000000170C000000ULL, 0x000000170E800000ULL,
+        0x0000001750000000ULL, 0x0000001752800000ULL, 0x0000001754000000ULL, 0x0000001756800000ULL,
+        0x0000001758000000ULL, 0x000000175A800000ULL, 0x000000175C000000ULL, 0x000000175E800000ULL,
+        0x00000017A0000000ULL, 0x00000017A2800000ULL, 0x00000017A4000000ULL, 0x00000017A6800000ULL,
+        0x00000017A8000000ULL, 0x00000017AA800000ULL, 0x00000017AC000000ULL, 0x00000017AE800000ULL,
+        0x00000017F0000000ULL, 0x00000017F2800000ULL, 0x00000017F4000000ULL, 0x00000017F6800000ULL,
+        0x00000017F8000000ULL, 0x00000017FA800000ULL, 0x00000017FC000000ULL, 0x00000017FE800000ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000002800ULL, 0x0000000000004000ULL, 0x0000000000006800ULL,
+        0x0000000000008000ULL, 0x000000000000A800ULL, 0x000000000000C000ULL, 0x000000000000E800ULL,
+        0x0000000000050000ULL, 0x0000000000052800ULL, 0x0000000000054000ULL, 0x0000000000056800ULL,
+        0x0000000000058000ULL, 0x000000000005A800ULL, 0x000000000005C000ULL, 0x000000000005E800ULL,
+        0x00000000000A0000ULL, 0x00000000000A2800ULL, 0x00000000000A4000ULL, 0x00000000000A6800ULL,
+        0x00000000000A8000ULL, 0x00000000000AA800ULL, 0x00000000000AC000ULL, 0x00000000000AE800ULL,
+        0x00000000000F0000ULL, 0x00000000000F2800ULL, 0x00000000000F4000ULL, 0x00000000000F6800ULL,
+        0x00000000000F8000ULL, 0x00000000000FA800ULL, 0x00000000000FC000ULL, 0x00000000000FE800ULL,
+        0x0000000000100000ULL, 0x0000000000102800ULL, 0x0000000000104000ULL, 0x0000000000106800ULL,
+        0x0000000000108000ULL, 0x000000000010A800ULL, 0x000000000010C000ULL, 0x000000000010E800ULL,
+        0x0000000000150000ULL, 0x0000000000152800ULL, 0x0000000000154000ULL, 0x0000000000156800ULL,
+        0x0000000000158000ULL, 0x000000000015A800ULL, 0x000000000015C000ULL, 0x000000000015E800ULL,
+        0x00000000001A0000ULL, 0x00000000001A2800ULL, 0x00000000001A4000ULL, 0x00000000001A6800ULL,
+        0x00000000001A8000ULL, 0x00000000001AA800ULL, 0x00000000001AC000ULL, 0x00000000001AE800ULL,
+        0x00000000001F0000ULL, 0x00000000001F2800ULL, 0x00000000001F4000ULL, 0x00000000001F6800ULL,
+        0x00000000001F8000ULL, 0x00000000001FA800ULL, 0x00000000001FC000ULL, 0x00000000001FE800ULL,
+        0x0000000000200000ULL, 0x0000000000202800ULL, 0x0000000000204000ULL, 0x0000000000206800ULL,
+        0x0000000000208000ULL, 0x000000000020A800ULL, 0x000000000020C000ULL, 0x000000000020E800ULL,
+        0x0000000000250000ULL, 0x0000000000252800ULL, 0x0000000000254000ULL, 0x0000000000256800ULL,
+        0x0000000000258000ULL, 0x000000000025A800ULL, 0x000000000025C000ULL, 0x000000000025E800ULL,
+        0x00000000002A0000ULL, 0x00000000002A2800ULL, 0x00000000002A4000ULL, 0x00000000002A6800ULL,
+        0x00000000002A8000ULL, 0x00000000002AA800ULL, 0x00000000002AC000ULL, 0x00000000002AE800ULL,
+        0x00000000002F0000ULL, 0x00000000002F2800ULL, 0x00000000002F4000ULL, 0x00000000002F6800ULL,
+        0x00000000002F8000ULL, 0x00000000002FA800ULL, 0x00000000002FC000ULL, 0x00000000002FE800ULL,
+        0x0000000000300000ULL, 0x0000000000302800ULL, 0x0000000000304000ULL, 0x0000000000306800ULL,
+        0x0000000000308000ULL, 0x000000000030A800ULL, 0x000000000030C000ULL, 0x000000000030E800ULL,
+        0x0000000000350000ULL, 0x0000000000352800ULL, 0x0000000000354000ULL, 0x0000000000356800ULL,
+        0x0000000000358000ULL, 0x000000000035A800ULL, 0x000000000035C000ULL, 0x000000000035E800ULL,
+        0x00000000003A0000ULL, 0x00000000003A2800ULL, 0x00000000003A4000ULL, 0x00000000003A6800ULL,
+        0x00000000003A8000ULL, 0x00000000003AA800ULL, 0x00000000003AC000ULL, 0x00000000003AE800ULL,
+        0x00000000003F0000ULL, 0x00000000003F2800ULL, 0x00000000003F4000ULL, 0x00000000003F6800ULL,
+        0x00000000003F8000ULL, 0x00000000003FA800ULL, 0x00000000003FC000ULL, 0x00000000003FE800ULL,
+        0x0000000001400000ULL, 0x0000000001402800ULL, 0x0000000001404000ULL, 0x0000000001406800ULL,
+        0x0000000001408000ULL, 0x000000000140A800ULL, 0x000000000140C000ULL, 0x000000000140E800ULL,
+        0x0000000001450000ULL, 0x0000000001452800ULL, 0x0000000001454000ULL, 0x0000000001456800ULL,
+        0x0000000001458000ULL, 0x000000000145A800ULL, 0x000000000145C000ULL, 0x000000000145E800ULL,
+        0x00000000014A0000ULL, 0x00000000014A2800ULL, 0x00000000014A4000ULL, 0x00000000014A6800ULL,
+        0x00000000014A8000ULL, 0x00000000014AA800ULL, 0x00000000014AC000ULL, 0x00000000014AE800ULL,
+        0x00000000014F0000ULL, 0x00000000014F2800ULL, 0x00000000014F4000ULL, 0x00000000014F6800ULL,
+        0x00000000014F8000ULL, 0x00000000014FA800ULL, 0x00000000014FC000ULL, 0x00000000014FE800ULL,
+        0x0000000001500000ULL, 0x0000000001502800ULL, 0x0000000001504000ULL, 0x0000000001506800ULL,
+        0x0000000001508000ULL, 0x000000000150A800ULL, 0x000000000150C000ULL, 0x000000000150E800ULL,
+        0x0000000001550000ULL, 0x0000000001552800ULL, 0x0000000001554000ULL, 0x0000000001556800ULL,
+        0x0000000001558000ULL, 0x000000000155A800ULL, 0x000000000155C000ULL, 0x000000000155E800ULL,
+        0x00000000015A0000ULL, 0x00000000015A2800ULL, 0x00000000015A4000ULL, 0x00000000015A6800ULL,
+        0x00000000015A8000ULL, 0x00000000015AA800ULL, 0x00000000015AC000ULL, 0x00000000015AE800ULL,
+        0x00000000015F0000ULL, 0x00000000015F2800ULL, 0x00000000015F4000ULL, 0x00000000015F6800ULL,
+        0x00000000015F8000ULL, 0x00000000015FA800ULL, 0x00000000015FC000ULL, 0x00000000015FE800ULL,
+        0x0000000001600000ULL, 0x0000000001602800ULL, 0x0000000001604000ULL, 0x0000000001606800ULL,
+        0x0000000001608000ULL, 0x000000000160A800ULL, 0x000000000160C000ULL, 0x000000000160E800ULL,
+        0x0000000001650000ULL, 0x0000000001652800ULL, 0x0000000001654000ULL, 0x0000000001656800ULL,
+        0x0000000001658000ULL, 0x000000000165A800ULL, 0x000000000165C000ULL, 0x000000000165E800ULL,
+        0x00000000016A0000ULL, 0x00000000016A2800ULL, 0x00000000016A4000ULL, 0x00000000016A6800ULL,
+        0x00000000016A8000ULL, 0x00000000016AA800ULL, 0x00000000016AC000ULL, 0x00000000016AE800ULL,
+        0x00000000016F0000ULL, 0x00000000016F2800ULL, 0x00000000016F4000ULL, 0x00000000016F6800ULL,
+        0x00000000016F8000ULL, 0x00000000016FA800ULL, 0x00000000016FC000ULL, 0x00000000016FE800ULL,
+        0x0000000001700000ULL, 0x0000000001702800ULL, 0x0000000001704000ULL, 0x0000000001706800ULL,
+        0x0000000001708000ULL, 0x000000000170A800ULL, 0x000000000170C000ULL, 0x000000000170E800ULL,
+        0x0000000001750000ULL, 0x0000000001752800ULL, 0x0000000001754000ULL, 0x0000000001756800ULL,
+        0x0000000001758000ULL, 0x000000000175A800ULL, 0x000000000175C000ULL, 0x000000000175E800ULL,
+        0x00000000017A0000ULL, 0x00000000017A2800ULL, 0x00000000017A4000ULL, 0x00000000017A6800ULL,
+        0x00000000017A8000ULL, 0x00000000017AA800ULL, 0x00000000017AC000ULL, 0x00000000017AE800ULL,
+        0x00000000017F0000ULL, 0x00000000017F2800ULL, 0x00000000017F4000ULL, 0x00000000017F6800ULL,
+        0x00000000017F8000ULL, 0x00000000017FA800ULL, 0x00000000017FC000ULL, 0x00000000017FE800ULL},
+    {
+        0x0000000000000000ULL, 0x0000800000000002ULL, 0x0000000000000004ULL, 0x0000800000000006ULL,
+        0x0000000000000008ULL, 0x000080000000000AULL, 0x000000000000000CULL, 0x000080000000000EULL,
+        0x0000000000000050ULL, 0x0000800000000052ULL, 0x0000000000000054ULL, 0x0000800000000056ULL,
+        0x0000000000000058ULL, 0x000080000000005AULL, 0x000000000000005CULL, 0x000080000000005EULL,
+        0x00000000000000A0ULL, 0x00008000000000A2ULL, 0x00000000000000A4ULL, 0x00008000000000A6ULL,
+        0x00000000000000A8ULL, 0x00008000000000AAULL, 0x00000000000000ACULL, 0x00008000000000AEULL,
+        0x00000000000000F0ULL, 0x00008000000000F2ULL, 0x00000000000000F4ULL, 0x00008000000000F6ULL,
+        0x00000000000000F8ULL, 0x00008000000000FAULL, 0x00000000000000FCULL, 0x00008000000000FEULL,
+        0x0000000000000100ULL, 0x0000800000000102ULL, 0x0000000000000104ULL, 0x0000800000000106ULL,
+        0x0000000000000108ULL, 0x000080000000010AULL, 0x000000000000010CULL, 0x000080000000010EULL,
+        0x0000000000000150ULL, 0x0000800000000152ULL, 0x0000000000000154ULL, 0x0000800000000156ULL,
+        0x0000000000000158ULL, 0x000080000000015AULL, 0x000000000000015CULL, 0x000080000000015EULL,
+        0x00000000000001A0ULL, 0x00008000000001A2ULL, 0x00000000000001A4ULL, 0x00008000000001A6ULL,
+        0x00000000000001A8ULL, 0x00008000000001AAULL, 0x00000000000001ACULL, 0x00008000000001AEULL,
+        0x00000000000001F0ULL, 0x00008000000001F2ULL, 0x00000000000001F4ULL, 0x00008000000001F6ULL,
+        0x00000000000001F8ULL, 0x00008000000001FAULL, 0x00000000000001FCULL, 0x00008000000001FEULL,
+        0x0000000000000200ULL, 0x0000800000000202ULL, 0x0000000000000204ULL, 0x0000800000000206ULL,
+        0x0000000000000208ULL, 0x000080000000020AULL, 0x000000000000020CULL, 0x000080000000020EULL,
+        0x0000000000000250ULL, 0x0000800000000252ULL, 0x0000000000000254ULL, 0x0000800000000256ULL,
+        0x0000000000000258ULL, 0x000080000000025AULL, 0x000000000000025CULL, 0x000080000000025EULL,
+        0x00000000000002A0ULL, 0x00008000000002A2ULL, 0x00000000000002A4ULL, 0x00008000000002A6ULL,
+        0x00000000000002A8ULL, 0x00008000000002AAULL, 0x00000000000002ACULL, 0x00008000000002AEULL,
+        0x00000000000002F0ULL, 0x00008000000002F2ULL, 0x00000000000002F4ULL, 0x00008000000002F6ULL,
+        0x00000000000002F8ULL, 0x00008000000002FAULL, 0x00000000000002FCULL, 0x00008000000002FEULL,
+        0x0000000000000300ULL, 0x0000800000000302ULL, 0x0000000000000304ULL, 0x0000800000000306ULL,
+        0x0000000000000308ULL, 0x000080000000030AULL, 0x000000000000030CULL, 0x000080000000030EULL,
+        0x0000000000000350ULL, 0x0000800000000352ULL, 0x0000000000000354ULL, 0x0000800000000356ULL,
+        0x0000000000000358ULL, 0x000080000000035AULL, 0x000000000000035CULL, 0x000080000000035EULL,
+        0x00000000000003A0ULL, 0x00008000000003A2ULL, 0x00000000000003A4ULL, 0x00008000000003A6ULL,
+        0x00000000000003A8ULL, 0x00008000000003AAULL, 0x00000000000003ACULL, 0x00008000000003AEULL,
+        0x00000000000003F0ULL, 0x00008000000003F2ULL, 0x00000000000003F4ULL, 0x00008000000003F6ULL,
+        0x00000000000003F8ULL, 0x00008000000003FAULL, 0x00000000000003FCULL, 0x00008000000003FEULL,
+        0x0000000000001400ULL, 0x0000800000001402ULL, 0x0000000000001404ULL, 0x0000800000001406ULL,
+        0x0000000000001408ULL, 0x000080000000140AULL, 0x000000000000140CULL, 0x000080000000140EULL,
+        0x0000000000001450ULL, 0x0000800000001452ULL, 0x0000000000001454ULL, 0x0000800000001456ULL,
+        0x0000000000001458ULL, 0x000080000000145AULL, 0x000000000000145CULL, 0x000080000000145EULL,
+        0x00000000000014A0ULL, 0x00008000000014A2ULL, 0x00000000000014A4ULL, 0x00008000000014A6ULL,
+        0x00000000000014A8ULL, 0x00008000000014AAULL, 0x00000000000014ACULL, 0x00008000000014AEULL,
+        0x00000000000014F0ULL, 0x00008000000014F2ULL, 0x00000000000014F4ULL, 0x00008000000014F6ULL,
+        0x00000000000014F8ULL, 0x00008000000014FAULL, 0x00000000000014FCULL, 0x00008000000014FEULL,
+        0x0000000000001500ULL, 0x0000800000001502ULL, 0x0000000000001504ULL, 0x0000800000001506ULL,
+        0x0000000000001508ULL, 0x000080000000150AULL, 0x000000000000150CULL, 0x000080000000150EULL,
+        0x0000000000001550ULL, 0x0000800000001552ULL, 0x0000000000001554ULL, 0x0000800000001556ULL,
+        0x0000000000001558ULL, 0x000080000000155AULL, 0x000000000000155CULL, 0x000080000000155EULL,
+        0x00000000000015A0ULL, 0x00008000000015A2ULL, 0x00000000000015A4ULL, 0x00008000000015A6ULL,
+        0x00000000000015A8ULL, 0x00008000000015AAULL, 0x00000000000015ACULL, 0x00008000000015AEULL,
+        0x00000000000015F0ULL, 0x00008000000015F2ULL, 0x00000000000015F4ULL, 0x00008000000015F6ULL,
+        0x00000000000015F8ULL, 0x00008000000015FAULL, 0x00000000000015FCULL, 0x00008000000015FEULL,
+        0x0000000000001600ULL, 0x0000800000001602ULL, 0x0000000000001604ULL, 0x0000800000001606ULL,
+        0x0000000000001608ULL, 0x000080000000160AULL, 0x000000000000160CULL, 0x000080000000160EULL,
+        0x0000000000001650ULL, 0x0000800000001652ULL, 0x0000000000001654ULL, 0x0000800000001656ULL,
+        0x0000000000001658ULL, 0x000080000000165AULL, 0x000000000000165CULL, 0x000080000000165EULL,
+        0x00000000000016A0ULL, 0x00008000000016A2ULL, 0x00000000000016A4ULL, 0x00008000000016A6ULL,
+        0x00000000000016A8ULL, 0x00008000000016AAULL, 0x00000000000016ACULL, 0x00008000000016AEULL,
+        0x00000000000016F0ULL, 0x00008000000016F2ULL, 0x00000000000016F4ULL, 0x00008000000016F6ULL,
+        0x00000000000016F8ULL, 0x00008000000016FAULL, 0x00000000000016FCULL, 0x00008000000016FEULL,
+        0x0000000000001700ULL, 0x0000800000001702ULL, 0x0000000000001704ULL, 0x0000800000001706ULL,
+        0x0000000000001708ULL, 0x000080000000170AULL, 0x000000000000170CULL, 0x000080000000170EULL,
+        0x0000000000001750ULL, 0x0000800000001752ULL, 0x0000000000001754ULL, 0x0000800000001756ULL,
+        0x0000000000001758ULL, 0x000080000000175AULL, 0x000000000000175CULL, 0x000080000000175EULL,
+        0x00000000000017A0ULL, 0x00008000000017A2ULL, 0x00000000000017A4ULL, 0x00008000000017A6ULL,
+        0x00000000000017A8ULL, 0x00008000000017AAULL, 0x00000000000017ACULL, 0x00008000000017AEULL,
+        0x00000000000017F0ULL, 0x00008000000017F2ULL, 0x00000000000017F4ULL, 0x00008000000017F6ULL,
+        0x00000000000017F8ULL, 0x00008000000017FAULL, 0x00000000000017FCULL, 0x00008000000017FEULL}
+};
+
+// S-盒与P置换合并的查表, 索引为E扩展后与子密钥异或结果中第i组6位
+const unsigned int DES_SP_TABLE[8][64] DES_CACHE_ALIGNED = {
+    {
+        0x00808200U, 0x00000000U, 0x00008000U, 0x00808202U, 0x00808002U, 0x00008202U, 0x00000002U, 0x00008000U,
+        0x00000200U, 0x00808200U, 0x00808202U, 0x00000200U, 0x00800202U, 0x00808002U, 0x00800000U, 0x00000002U,
+        0x00000202U, 0x00800200U, 0x00800200U, 0x00008200U, 0x00008200U, 0x00808000U, 0x00808000U, 0x00800202U,
+        0x00008002U, 0x00800002U, 0x00800002U, 0x00008002U, 0x00000000U, 0x00000202U, 0x00008202U, 0x00800000U,
+        0x00008000U, 0x00808202U, 0x00000002U, 0x00808000U, 0x00808200U, 0x00800000U, 0x00800000U, 0x00000200U,
+        0x00808002U, 0x00008000U, 0x00008200U, 0x00800002U, 0x00000200U, 0x00000002U, 0x00800202U, 0x00008202U,
+        0x00808202U, 0x00008002U, 0x00808000U, 0x00800202U, 0x00800002U, 0x00000202U, 0x00008202U, 0x00808200U,
+        0x00000202U, 0x00800200U, 0x00800200U, 0x00000000U, 0x00008002U, 0x00008200U, 0x00000000U, 0x00808002U},
+    {
+        0x40084010U, 0x40004000U, 0x00004000U, 0x00084010U, 0x00080000U, 0x00000010U, 0x40080010U, 0x40004010U,
+        0x40000010U, 0x40084010U, 0x40084000U, 0x40000000U, 0x40004000U, 0x00080000U, 0x00000010U, 0x40080010U,
+        0x00084000U, 0x00080010U, 0x40004010U, 0x00000000U, 0x40000000U, 0x00004000U, 0x00084010U, 0x40080000U,
+        0x00080010U, 0x40000010U, 0x00000000U, 0x00084000U, 0x00004010U, 0x40084000U, 0x40080000U, 0x00004010U,
+        0x00000000U, 0x00084010U, 0x40080010U, 0x00080000U, 0x40004010U, 0x40080000U, 0x40084000U, 0x00004000U,
+        0x40080000U, 0x40004000U, 0x00000010U, 0x40084010U, 0x00084010U, 0x00000010U, 0x00004000U, 0x40000000U,
+        0x00004010U, 0x40084000U, 0x00080000U, 0x40000010U, 0x00080010U, 0x40004010U, 0x40000010U, 0x00080010U,
+        0x00084000U, 0x00000000U, 0x40004000U, 0x00004010U, 0x40000000U, 0x40080010U, 0x40084010U, 0x00084000U},
+    {
+        0x00000104U, 0x04010100U, 0x00000000U, 0x04010004U, 0x04000100U, 0x00000000U, 0x00010104U, 0x04000100U,
+        0x00010004U, 0x04000004U, 0x04000004U, 0x00010000U, 0x04010104U, 0x00010004U, 0x04010000U, 0x00000104U,
+        0x04000000U, 0x00000004U, 0x04010100U, 0x00000100U, 0x00010100U, 0x04010000U, 0x04010004U, 0x00010104U,
+        0x04000104U, 0x00010100U, 0x00010000U, 0x04000104U, 0x00000004U, 0x04010104U, 0x00000100U, 0x04000000U,
+        0x04010100U, 0x04000000U, 0x00010004U, 0x00000104U, 0x00010000U, 0x04010100U, 0x04000100U, 0x00000000U,
+        0x00000100U, 0x00010004U, 0x04010104U, 0x04000100U, 0x04000004U, 0x00000100U, 0x00000000U, 0x04010004U,
+        0x04000104U, 0x00010000U, 0x04000000U, 0x04010104U, 0x00000004U, 0x00010104U, 0x00010100U, 0x04000004U,
+        0x04010000U, 0x04000104U, 0x00000104U, 0x04010000U, 0x00010104U, 0x00000004U, 0x04010004U, 0x00010100U},
+    {
+        0x80401000U, 0x80001040U, 0x80001040U, 0x00000040U, 0x00401040U, 0x80400040U, 0x80400000U, 0x80001000U,
+        0x00000000U, 0x00401000U, 0x00401000U, 0x80401040U, 0x80000040U, 0x00000000U, 0x00400040U, 0x80400000U,
+        0x80000000U, 0x00001000U, 0x00400000U, 0x80401000U, 0x00000040U, 0x00400000U, 0x80001000U, 0x00001040U,
+        0x80400040U, 0x80000000U, 0x00001040U, 0x00400040U, 0x00001000U, 0x00401040U, 0x80401040U, 0x80000040U,
+        0x00400040U, 0x80400000U, 0x00401000U, 0x80401040U, 0x80000040U, 0x00000000U, 0x00000000U, 0x00401000U,
+        0x00001040U, 0x00400040U, 0x80400040U, 0x80000000U, 0x80401000U, 0x80001040U, 0x80001040U, 0x00000040U,
+        0x80401040U, 0x80000040U, 0x80000000U, 0x00001000U, 0x80400000U, 0x80001000U, 0x00401040U, 0x80400040U,
+        0x80001000U, 0x00001040U, 0x00400000U, 0x80401000U, 0x00000040U, 0x00400000U, 0x00001000U, 0x00401040U},
+    {
+        0x00000080U, 0x01040080U, 0x01040000U, 0x21000080U, 0x00040000U, 0x00000080U, 0x20000000U, 0x01040000U,
+        0x20040080U, 0x00040000U, 0x01000080U, 0x20040080U, 0x21000080U, 0x21040000U, 0x00040080U, 0x20000000U,
+        0x01000000U, 0x20040000U, 0x20040000U, 0x00000000U, 0x20000080U, 0x21040080U, 0x21040080U, 0x01000080U,
+        0x21040000U, 0x20000080U, 0x00000000U, 0x21000000U, 0x01040080U, 0x01000000U, 0x21000000U, 0x00040080U,
+        0x00040000U, 0x21000080U, 0x00000080U, 0x01000000U, 0x20000000U, 0x01040000U, 0x21000080U, 0x20040080U,
+        0x01000080U, 0x20000000U, 0x21040000U, 0x01040080U, 0x20040080U, 0x00000080U, 0x01000000U, 0x21040000U,
+        0x21040080U, 0x00040080U, 0x21000000U, 0x21040080U, 0x01040000U, 0x00000000U, 0x20040000U, 0x21000000U,
+        0x00040080U, 0x01000080U, 0x20000080U, 0x00040000U, 0x00000000U, 0x20040000U, 0x01040080U, 0x20000080U},
+    {
+        0x10000008U, 0x10200000U, 0x00002000U, 0x10202008U, 0x10200000U, 0x00000008U, 0x10202008U, 0x00200000U,
+        0x10002000U, 0x00202008U, 0x00200000U, 0x10000008U, 0x00200008U, 0x10002000U, 0x10000000U, 0x00002008U,
+        0x00000000U, 0x00200008U, 0x10002008U, 0x00002000U, 0x00202000U, 0x10002008U, 0x00000008U, 0x10200008U,
+        0x10200008U, 0x00000000U, 0x00202008U, 0x10202000U, 0x00002008U, 0x00202000U, 0x10202000U, 0x10000000U,
+        0x10002000U, 0x00000008U, 0x10200008U, 0x00202000U, 0x10202008U, 0x00200000U, 0x00002008U, 0x10000008U,
+        0x00200000U, 0x10002000U, 0x10000000U, 0x00002008U, 0x10000008U, 0x10202008U, 0x00202000U, 0x10200000U,
+        0x00202008U, 0x10202000U, 0x00000000U, 0x10200008U, 0x00000008U, 0x00002000U, 0x10200000U, 0x00202008U,
+        0x00002000U, 0x00200008U, 0x10002008U, 0x00000000U, 0x10202000U, 0x10000000U, 0x00200008U, 0x10002008U},
+    {
+        0x00100000U, 0x02100001U, 0x02000401U, 0x00000000U, 0x00000400U, 0x02000401U, 0x00100401U, 0x02100400U,
+        0x02100401U, 0x00100000U, 0x00000000U, 0x02000001U, 0x00000001U, 0x02000000U, 0x02100001U, 0x00000401U,
+        0x02000400U, 0x00100401U, 0x00100001U, 0x02000400U, 0x02000001U, 0x02100000U, 0x02100400U, 0x00100001U,
+        0x02100000U, 0x00000400U, 0x00000401U, 0x02100401U, 0x00100400U, 0x00000001U, 0x02000000U, 0x00100400U,
+        0x02000000U, 0x00100400U, 0x00100000U, 0x02000401U, 0x02000401U, 0x02100001U, 0x02100001U, 0x00000001U,
+        0x00100001U, 0x02000000U, 0x02000400U, 0x00100000U, 0x02100400U, 0x00000401U, 0x00100401U, 0x02100400U,
+        0x00000401U, 0x02000001U, 0x02100401U, 0x02100000U, 0x00100400U, 0x00000000U, 0x00000001U, 0x02100401U,
+        0x00000000U, 0x00100401U, 0x02100000U, 0x00000400U, 0x02000001U, 0x02000400U, 0x00000400U, 0x00100001U},
+    {
+        0x08000820U, 0x00000800U, 0x00020000U, 0x08020820U, 0x08000000U, 0x08000820U, 0x00000020U, 0x08000000U,
+        0x00020020U, 0x08020000U, 0x08020820U, 0x00020800U, 0x08020800U, 0x00020820U, 0x00000800U, 0x00000020U,
+        0x08020000U, 0x08000020U, 0x08000800U, 0x00000820U, 0x00020800U, 0x00020020U, 0x08020020U, 0x08020800U,
+        0x00000820U, 0x00000000U, 0x00000000U, 0x08020020U, 0x08000020U, 0x08000800U, 0x00020820U, 0x00020000U,
+        0x00020820U, 0x00020000U, 0x08020800U, 0x00000800U, 0x00000020U, 0x08020020U, 0x00000800U, 0x00020820U,
+        0x08000800U, 0x00000020U, 0x08000020U, 0x08020000U, 0x08020020U, 0x08000000U, 0x00020000U, 0x08000820U,
+        0x00000000U, 0x08020820U, 0x00020020U, 0x08000020U, 0x08020000U, 0x08000800U, 0x08000820U, 0x00000000U,
+        0x08020820U, 0x00020800U, 0x00020800U, 0x00000820U, 0x00000820U, 0x00020020U, 0x08000000U, 0x08020800U}
+};
+
+// S-盒按6位输入直接索引, 每项4位输出存为一个字节
+const unsigned char DES_SBOX_TABLE[8][64] DES_CACHE_ALIGNED = {
+    {
+        14,  0,  4, 15, 13,  7,  1,  4,  2, 14, 15,  2, 11, 13,  8,  1,
+         3, 10, 10,  6,  6, 12, 12, 11,  5,  9,  9,  5,  0,  3,  7,  8,
+         4, 15,  1, 12, 14,  8,  8,  2, 13,  4,  6,  9,  2,  1, 11,  7,
+        15,  5, 12, 11,  9,  3,  7, 14,  3, 10, 10,  0,  5,  6,  0, 13},
+    {
+        15,  3,  1, 13,  8,  4, 14,  7,  6, 15, 11,  2,  3,  8,  4, 14,
+         9, 12,  7,  0,  2,  1, 13, 10, 12,  6,  0,  9,  5, 11, 10,  5,
+         0, 13, 14,  8,  7, 10, 11,  1, 10,  3,  4, 15, 13,  4,  1,  2,
+         5, 11,  8,  6, 12,  7,  6, 12,  9,  0,  3,  5,  2, 14, 15,  9},
+    {
+        10, 13,  0,  7,  9,  0, 14,  9,  6,  3,  3,  4, 15,  6,  5, 10,
+         1,  2, 13,  8, 12,  5,  7, 14, 11, 12,  4, 11,  2, 15,  8,  1,
+        13,  1,  6, 10,  4, 13,  9,  0,  8,  6, 15,  9,  3,  8,  0,  7,
+        11,  4,  1, 15,  2, 14, 12,  3,  5, 11, 10,  5, 14,  2,  7, 12},
+    {
+         7, 13, 13,  8, 14, 11,  3,  5,  0,  6,  6, 15,  9,  0, 10,  3,
+         1,  4,  2,  7,  8,  2,  5, 12, 11,  1, 12, 10,  4, 14, 15,  9,
+        10,  3,  6, 15,  9,  0,  0,  6, 12, 10, 11,  1,  7, 13, 13,  8,
+        15,  9,  1,  4,  3,  5, 14, 11,  5, 12,  2,  7,  8,  2,  4, 14},
+    {
+         2, 14, 12, 11,  4,  2,  1, 12,  7,  4, 10,  7, 11, 13,  6,  1,
+         8,  5,  5,  0,  3, 15, 15, 10, 13,  3,  0,  9, 14,  8,  9,  6,
+         4, 11,  2,  8,  1, 12, 11,  7, 10,  1, 13, 14,  7,  2,  8, 13,
+        15,  6,  9, 15, 12,  0,  5,  9,  6, 10,  3,  4,  0,  5, 14,  3},
+    {
+        12, 10,  1, 15, 10,  4, 15,  2,  9,  7,  2, 12,  6,  9,  8,  5,
+         0,  6, 13,  1,  3, 13,  4, 14, 14,  0,  7, 11,  5,  3, 11,  8,
+         9,  4, 14,  3, 15,  2,  5, 12,  2,  9,  8,  5, 12, 15,  3, 10,
+         7, 11,  0, 14,  4,  1, 10,  7,  1,  6, 13,  0, 11,  8,  6, 13},
+    {
+         4, 13, 11,  0,  2, 11, 14,  7, 15,  4,  0,  9,  8,  1, 13, 10,
+         3, 14, 12,  3,  9,  5,  7, 12,  5,  2, 10, 15,  6,  8,  1,  6,
+         1,  6,  4, 11, 11, 13, 13,  8, 12,  1,  3,  4,  7, 10, 14,  7,
+        10,  9, 15,  5,  6,  0,  8, 15,  0, 14,  5,  2,  9,  3,  2, 12},
+    {
+        13,  1,  2, 15,  8, 13,  4,  8,  6, 10, 15,  3, 11,  7,  1,  4,
+        10, 12,  9,  5,  3,  6, 14, 11,  5,  0,  0, 14, 12,  9,  7,  2,
+         7,  2, 11,  1,  4, 14,  1,  7,  9,  4, 12, 10, 14,  8,  2, 13,
+         0, 15,  6, 12, 10,  9, 13,  0, 15,  3,  3,  5,  5,  6,  8, 11}
+};
+
+// P置换按S-盒输出查表: 第i个S-盒输出4位值时的P置换结果
+const unsigned int DES_P4_TABLE[8][16] DES_CACHE_ALIGNED = {
+    {
+        0x00000000U, 0x00000002U, 0x00000200U, 0x00000202U, 0x00008000U, 0x00008002U, 0x00008200U, 0x00008202U,
+        0x00800000U, 0x00800002U, 0x00800200U, 0x00800202U, 0x00808000U, 0x00808002U, 0x00808200U, 0x00808202U},
+    {
+        0x00000000U, 0x00004000U, 0x40000000U, 0x40004000U, 0x00000010U, 0x00004010U, 0x40000010U, 0x40004010U,
+        0x00080000U, 0x00084000U, 0x40080000U, 0x40084000U, 0x00080010U, 0x00084010U, 0x40080010U, 0x40084010U},
+    {
+        0x00000000U, 0x04000000U, 0x00000004U, 0x04000004U, 0x00010000U, 0x04010000U, 0x00010004U, 0x04010004U,
+        0x00000100U, 0x04000100U, 0x00000104U, 0x04000104U, 0x00010100U, 0x04010100U, 0x00010104U, 0x04010104U},
+    {
+        0x00000000U, 0x80000000U, 0x00400000U, 0x80400000U, 0x00001000U, 0x80001000U, 0x00401000U, 0x80401000U,
+        0x00000040U, 0x80000040U, 0x00400040U, 0x80400040U, 0x00001040U, 0x80001040U, 0x00401040U, 0x80401040U},
+    {
+        0x00000000U, 0x20000000U, 0x00000080U, 0x20000080U, 0x00040000U, 0x20040000U, 0x00040080U, 0x20040080U,
+        0x01000000U, 0x21000000U, 0x01000080U, 0x21000080U, 0x01040000U, 0x21040000U, 0x01040080U, 0x21040080U},
+    {
+        0x00000000U, 0x00002000U, 0x00200000U, 0x00202000U, 0x00000008U, 0x00002008U, 0x00200008U, 0x00202008U,
+        0x10000000U, 0x10002000U, 0x10200000U, 0x10202000U, 0x10000008U, 0x10002008U, 0x10200008U, 0x10202008U},
+    {
+        0x00000000U, 0x02000000U, 0x00000400U, 0x02000400U, 0x00100000U, 0x02100000U, 0x00100400U, 0x02100400U,
+        0x00000001U, 0x02000001U, 0x00000401U, 0x02000401U, 0x00100001U, 0x02100001U, 0x00100401U, 0x02100401U},
+    {
+        0x00000000U, 0x00000800U, 0x00020000U, 0x00020800U, 0x00000020U, 0x00000820U, 0x00020020U, 0x00020820U,
+        0x08000000U, 0x08000800U, 0x08020000U, 0x08020800U, 0x08000020U, 0x08000820U, 0x08020020U, 0x08020820U}
+};
+
+// 置换选择PC-1: 64位密钥按字节查表, 输出56位
+const BYTE DES_PC1_TABLE[8][256] DES_CACHE_ALIGNED = {
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000100000ULL,
+        0x0000000000001000ULL, 0x0000000000001000ULL, 0x0000000000101000ULL, 0x0000000000101000ULL,
+        0x0000000000000010ULL, 0x0000000000000010ULL, 0x0000000000100010ULL, 0x0000000000100010ULL,
+        0x0000000000001010ULL, 0x0000000000001010ULL, 0x0000000000101010ULL, 0x0000000000101010ULL,
+        0x0000000000000001ULL, 0x0000000000000001ULL, 0x0000000000100001ULL, 0x0000000000100001ULL,
+        0x0000000000001001ULL, 0x0000000000001001ULL, 0x0000000000101001ULL, 0x0000000000101001ULL,
+        0x0000000000000011ULL, 0x0000000000000011ULL, 0x0000000000100011ULL, 0x0000000000100011ULL,
+        0x0000000000001011ULL, 0x0000000000001011ULL, 0x0000000000101011ULL, 0x0000000000101011ULL,
+        0x0000000100000000ULL, 0x0000000100000000ULL, 0x0000000100100000ULL, 0x0000000100100000ULL,
+        0x0000000100001000ULL, 0x0000000100001000ULL, 0x0000000100101000ULL, 0x0000000100101000ULL,
+        0x0000000100000010ULL, 0x0000000100000010ULL, 0x0000000100100010ULL, 0x0000000100100010ULL,
+        0x0000000100001010ULL, 0x0000000100001010ULL, 0x0000000100101010ULL, 0x0000000100101010ULL,
+        0x0000000100000001ULL, 0x0000000100000001ULL, 0x0000000100100001ULL, 0x0000000100100001ULL,
+        0x0000000100001001ULL, 0x0000000100001001ULL, 0x0000000100101001ULL, 0x0000000100101001ULL,
+        0x0000000100000011ULL, 0x0000000100000011ULL, 0x0000000100100011ULL, 0x0000000100100011ULL,
+        0x0000000100001011ULL, 0x0000000100001011ULL, 0x0000000100101011ULL, 0x0000000100101011ULL,
+        0x0000010000000000ULL, 0x0000010000000000ULL, 0x0000010000100000ULL, 0x0000010000100000ULL,
+        0x0000010000001000ULL, 0x0000010000001000ULL, 0x0000010000101000ULL, 0x0000010000101000ULL,
+        0x0000010000000010ULL, 0x0000010000000010ULL, 0x0000010000100010ULL, 0x0000010000100010ULL,
+        0x0000010000001010ULL, 0x0000010000001010ULL, 0x0000010000101010ULL, 0x0000010000101010ULL,
+        0x0000010000000001ULL, 0x0000010000000001ULL, 0x0000010000100001ULL, 0x0000010000100001ULL,
+        0x0000010000001001ULL, 0x0000010000001001ULL, 0x0000010000101001ULL, 0x0000010000101001ULL,
+        0x0000010000000011ULL, 0x0000010000000011ULL, 0x0000010000100011ULL, 0x0000010000100011ULL,
+        0x0000010000001011ULL, 0x0000010000001011ULL, 0x0000010000101011ULL, 0x0000010000101011ULL,
+        0x0000010100000000ULL, 0x0000010100000000ULL, 0x0000010100100000ULL, 0x0000010100100000ULL,
+        0x0000010100001000ULL, 0x0000010100001000ULL, 0x0000010100101000ULL, 0x0000010100101000ULL,
+        0x0000010100000010ULL, 0x0000010100000010ULL, 0x0000010100100010ULL, 0x0000010100100010ULL,
+        0x0000010100001010ULL, 0x0000010100001010ULL, 0x0000010100101010ULL, 0x0000010100101010ULL,
+        0x0000010100000001ULL, 0x0000010100000001ULL, 0x0000010100100001ULL, 0x0000010100100001ULL,
+        0x0000010100001001ULL, 0x0000010100001001ULL, 0x0000010100101001ULL, 0x0000010100101001ULL,
+        0x0000010100000011ULL, 0x0000010100000011ULL, 0x0000010100100011ULL, 0x0000010100100011ULL,
+        0x0000010100001011ULL, 0x0000010100001011ULL, 0x0000010100101011ULL, 0x0000010100101011ULL,
+        0x0001000000000000ULL, 0x0001000000000000ULL, 0x0001000000100000ULL, 0x0001000000100000ULL,
+        0x0001000000001000ULL, 0x0001000000001000ULL, 0x0001000000101000ULL, 0x0001000000101000ULL,
+        0x0001000000000010ULL, 0x0001000000000010ULL, 0x0001000000100010ULL, 0x0001000000100010ULL,
+        0x0001000000001010ULL, 0x0001000000001010ULL, 0x0001000000101010ULL, 0x0001000000101010ULL,
+        0x0001000000000001ULL, 0x0001000000000001ULL, 0x0001000000100001ULL, 0x0001000000100001ULL,
+        0x0001000000001001ULL, 0x0001000000001001ULL, 0x0001000000101001ULL, 0x0001000000101001ULL,
+        0x0001000000000011ULL, 0x0001000000000011ULL, 0x0001000000100011ULL, 0x0001000000100011ULL,
+        0x0001000000001011ULL, 0x0001000000001011ULL, 0x0001000000101011ULL, 0x0001000000101011ULL,
+        0x0001000100000000ULL, 0x0001000100000000ULL, 0x0001000100100000ULL, 0x0001000100100000ULL,
+        0x0001000100001000ULL, 0x0001000100001000ULL, 0x0001000100101000ULL, 0x0001000100101000ULL,
+        0x0001000100000010ULL, 0x0001000100000010ULL, 0x0001000100100010ULL, 0x0001000100100010ULL,
+        0x0001000100001010ULL, 0x0001000100001010ULL, 0x0001000100101010ULL, 0x0001000100101010ULL,
+        0x0001000100000001ULL, 0x0001000100000001ULL, 0x0001000100100001ULL, 0x0001000100100001ULL,
+        0x0001000100001001ULL, 0x0001000100001001ULL, 0x0001000100101001ULL, 0x0001000100101001ULL,
+        0x0001000100000011ULL, 0x0001000100000011ULL, 0x0001000100100011ULL, 0x0001000100100011ULL,
+        0x0001000100001011ULL, 0x0001000100001011ULL, 0x0001000100101011ULL, 0x0001000100101011ULL,
+        0x0001010000000000ULL, 0x0001010000000000ULL, 0x0001010000100000ULL, 0x0001010000100000ULL,
+        0x0001010000001000ULL, 0x0001010000001000ULL, 0x0001010000101000ULL, 0x0001010000101000ULL,
+        0x0001010000000010ULL, 0x0001010000000010ULL, 0x0001010000100010ULL, 0x0001010000100010ULL,
+        0x0001010000001010ULL, 0x0001010000001010ULL, 0x0001010000101010ULL, 0x0001010000101010ULL,
+        0x0001010000000001ULL, 0x0001010000000001ULL, 0x0001010000100001ULL, 0x0001010000100001ULL,
+        0x0001010000001001ULL, 0x0001010000001001ULL, 0x0001010000101001ULL, 0x0001010000101001ULL,
+        0x0001010000000011ULL, 0x0001010000000011ULL, 0x0001010000100011ULL, 0x0001010000100011ULL,
+        0x0001010000001011ULL, 0x0001010000001011ULL, 0x0001010000101011ULL, 0x0001010000101011ULL,
+        0x0001010100000000ULL, 0x0001010100000000ULL, 0x0001010100100000ULL, 0x0001010100100000ULL,
+        0x0001010100001000ULL, 0x0001010100001000ULL, 0x0001010100101000ULL, 0x0001010100101000ULL,
+        0x0001010100000010ULL, 0x0001010100000010ULL, 0x0001010100100010ULL, 0x0001010100100010ULL,
+        0x0001010100001010ULL, 0x0001010100001010ULL, 0x0001010100101010ULL, 0x0001010100101010ULL,
+        0x0001010100000001ULL, 0x0001010100000001ULL, 0x0001010100100001ULL, 0x0001010100100001ULL,
+        0x0001010100001001ULL, 0x0001010100001001ULL, 0x0001010100101001ULL, 0x0001010100101001ULL,
+        0x0001010100000011ULL, 0x0001010100000011ULL, 0x0001010100100011ULL, 0x0001010100100011ULL,
+        0x0001010100001011ULL, 0x0001010100001011ULL, 0x0001010100101011ULL, 0x0001010100101011ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000200000ULL,
+        0x0000000000002000ULL, 0x0000000000002000ULL, 0x0000000000202000ULL, 0x0000000000202000ULL,
+        0x0000000000000020ULL, 0x0000000000000020ULL, 0x0000000000200020ULL, 0x0000000000200020ULL,
+        0x0000000000002020ULL, 0x0000000000002020ULL, 0x0000000000202020ULL, 0x0000000000202020ULL,
+        0x0000000000000002ULL, 0x0000000000000002ULL, 0x0000000000200002ULL, 0x0000000000200002ULL,
+        0x0000000000002002ULL, 0x0000000000002002ULL, 0x0000000000202002ULL, 0x0000000000202002ULL,
+        0x0000000000000022ULL, 0x0000000000000022ULL, 0x0000000000200022ULL, 0x0000000000200022ULL,
+        0x0000000000002022ULL, 0x0000000000002022ULL, 0x0000000000202022ULL, 0x0000000000202022ULL,
+        0x0000000200000000ULL, 0x0000000200000000ULL, 0x0000000200200000ULL, 0x0000000200200000ULL,
+        0x0000000200002000ULL, 0x0000000200002000ULL, 0x0000000200202000ULL, 0x0000000200202000ULL,
+        0x0000000200000020ULL, 0x0000000200000020ULL, 0x0000000200200020ULL, 0x0000000200200020ULL,
+        0x0000000200002020ULL, 0x0000000200002020ULL, 0x0000000200202020ULL, 0x0000000200202020ULL,
+        0x0000000200000002ULL, 0x0000000200000002ULL, 0x0000000200200002ULL, 0x0000000200200002ULL,
+        0x0000000200002002ULL, 0x0000000200002002ULL, 0x0000000200202002ULL, 0x0000000200202002ULL,
+        0x0000000200000022ULL, 0x0000000200000022ULL, 0x0000000200200022ULL, 0x0000000200200022ULL,
+        0x0000000200002022ULL, 0x0000000200002022ULL, 0x0000000200202022ULL, 0x0000000200202022ULL,
+        0x0000020000000000ULL, 0x0000020000000000ULL, 0x0000020000200000ULL, 0x0000020000200000ULL,
+        0x0000020000002000ULL, 0x0000020000002000ULL, 0x0000020000202000ULL, 0x0000020000202000ULL,
+        0x0000020000000020ULL, 0x0000020000000020ULL, 0x0000020000200020ULL, 0x0000020000200020ULL,
+        0x0000020000002020ULL, 0x0000020000002020ULL, 0x0000020000202020ULL, 0x0000020000202020ULL,
+        0x0000020000000002ULL, 0x0000020000000002ULL, 0x0000020000200002ULL, 0x0000020000200002ULL,
+        0x0000020000002002ULL, 0x0000020000002002ULL, 0x0000020000202002ULL, 0x0000020000202002ULL,
+        0x0000020000000022ULL, 0x0000020000000022ULL, 0x0000020000200022ULL, 0x0000020000200022ULL,
+        0x0000020000002022ULL, 0x0000020000002022ULL, 0x0000020000202022ULL, 0x0000020000202022ULL,
+        0x0000020200000000ULL, 0x0000020200000000ULL, 0x0000020200200000ULL, 0x0000020200200000ULL,
+        0x0000020200002000ULL, 0x0000020200002000ULL, 0x0000020200202000ULL, 0x0000020200202000ULL,
+        0x0000020200000020ULL, 0x0000020200000020ULL, 0x0000020200200020ULL, 0x0000020200200020ULL,
+        0x0000020200002020ULL, 0x0000020200002020ULL, 0x0000020200202020ULL, 0x0000020200202020ULL,
+        0x0000020200000002ULL, 0x0000020200000002ULL, 0x0000020200200002ULL, 0x0000020200200002ULL,
+        0x0000020200002002ULL, 0x0000020200002002ULL, 0x0000020200202002ULL, 0x0000020200202002ULL,
+        0x0000020200000022ULL, 0x0000020200000022ULL, 0x0000020200200022ULL, 0x0000020200200022ULL,
+        0x0000020200002022ULL, 0x0000020200002022ULL, 0x0000020200202022ULL, 0x0000020200202022ULL,
+        0x0002000000000000ULL, 0x0002000000000000ULL, 0x0002000000200000ULL, 0x0002000000200000ULL,
+        0x0002000000002000ULL, 0x0002000000002000ULL, 0x0002000000202000ULL, 0x0002000000202000ULL,
+        0x0002000000000020ULL, 0x0002000000000020ULL, 0x0002000000200020ULL, 0x0002000000200020ULL,
+        0x0002000000002020ULL, 0x0002000000002020ULL, 0x0002000000202020ULL, 0x0002000000202020ULL,
+        0x0002000000000002ULL, 0x0002000000000002ULL, 0x0002000000200002ULL, 0x0002000000200002ULL,
+        0x0002000000002002ULL, 0x0002000000002002ULL, 0x0002000000202002ULL, 0x0002000000202002ULL,
+        0x0002000000000022ULL, 0x0002000000000022ULL, 0x0002000000200022ULL, 0x0002000000200022ULL,
+        0x0002000000002022ULL, 0x0002000000002022ULL, 0x0002000000202022ULL, 0x0002000000202022ULL,
+        0x0002000200000000ULL, 0x0002000200000000ULL, 0x0002000200200000ULL, 0x0002000200200000ULL,
+        0x0002000200002000ULL, 0x0002000200002000ULL, 0x0002000200202000ULL, 0x0002000200202000ULL,
+        0x0002000200000020ULL, 0x0002000200000020ULL, 0x0002000200200020ULL, 0x0002000200200020ULL,
+        0x0002000200002020ULL, 0x0002000200002020ULL, 0x0002000200202020ULL, 0x0002000200202020ULL,
+        0x0002000200000002ULL, 0x0002000200000002ULL, 0x0002000200200002ULL, 0x0002000200200002ULL,
+        0x0002000200002002ULL, 0x0002000200002002ULL, 0x0002000200202002ULL, 0x0002000200202002ULL,
+        0x0002000200000022ULL, 0x0002000200000022ULL, 0x0002000200200022ULL, 0x0002000200200022ULL,
+        0x0002000200002022ULL, 0x0002000200002022ULL, 0x0002000200202022ULL, 0x0002000200202022ULL,
+        0x0002020000000000ULL, 0x0002020000000000ULL, 0x0002020000200000ULL, 0x0002020000200000ULL,
+        0x0002020000002000ULL, 0x0002020000002000ULL, 0x0002020000202000ULL, 0x0002020000202000ULL,
+        0x0002020000000020ULL, 0x0002020000000020ULL, 0x0002020000200020ULL, 0x0002020000200020ULL,
+        0x0002020000002020ULL, 0x0002020000002020ULL, 0x0002020000202020ULL, 0x0002020000202020ULL,
+        0x0002020000000002ULL, 0x0002020000000002ULL, 0x0002020000200002ULL, 0x0002020000200002ULL,
+        0x0002020000002002ULL, 0x0002020000002002ULL, 0x0002020000202002ULL, 0x0002020000202002ULL,
+        0x0002020000000022ULL, 0x0002020000000022ULL, 0x0002020000200022ULL, 0x0002020000200022ULL,
+        0x0002020000002022ULL, 0x0002020000002022ULL, 0x0002020000202022ULL, 0x0002020000202022ULL,
+        0x0002020200000000ULL, 0x0002020200000000ULL, 0x0002020200200000ULL, 0x0002020200200000ULL,
+        0x0002020200002000ULL, 0x0002020200002000ULL, 0x0002020200202000ULL, 0x0002020200202000ULL,
+        0x0002020200000020ULL, 0x0002020200000020ULL, 0x0002020200200020ULL, 0x0002020200200020ULL,
+        0x0002020200002020ULL, 0x0002020200002020ULL, 0x0002020200202020ULL, 0x0002020200202020ULL,
+        0x0002020200000002ULL, 0x0002020200000002ULL, 0x0002020200200002ULL, 0x0002020200200002ULL,
+        0x0002020200002002ULL, 0x0002020200002002ULL, 0x0002020200202002ULL, 0x0002020200202002ULL,
+        0x0002020200000022ULL, 0x0002020200000022ULL, 0x0002020200200022ULL, 0x0002020200200022ULL,
+        0x0002020200002022ULL, 0x0002020200002022ULL, 0x0002020200202022ULL, 0x0002020200202022ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000400000ULL,
+        0x0000000000004000ULL, 0x0000000000004000ULL, 0x0000000000404000ULL, 0x0000000000404000ULL,
+        0x0000000000000040ULL, 0x0000000000000040ULL, 0x0000000000400040ULL, 0x0000000000400040ULL,
+        0x0000000000004040ULL, 0x0000000000004040ULL, 0x0000000000404040ULL, 0x0000000000404040ULL,
+        0x0000000000000004ULL, 0x0000000000000004ULL, 0x0000000000400004ULL, 0x0000000000400004ULL,
+        0x0000000000004004ULL, 0x0000000000004004ULL, 0x0000000000404004ULL, 0x0000000000404004ULL,
+        0x0000000000000044ULL, 0x0000000000000044ULL, 0x0000000000400044ULL, 0x0000000000400044ULL,
+        0x0000000000004044ULL, 0x0000000000004044ULL, 0x0000000000404044ULL, 0x0000000000404044ULL,
+        0x0000000400000000ULL, 0x0000000400000000ULL, 0x0000000400400000ULL, 0x0000000400400000ULL,
+        0x0000000400004000ULL, 0x0000000400004000ULL, 0x0000000400404000ULL, 0x0000000400404000ULL,
+        0x0000000400000040ULL, 0x0000000400000040ULL, 0x0000000400400040ULL, 0x0000000400400040ULL,
+        0x0000000400004040ULL, 0x0000000400004040ULL, 0x0000000400404040ULL, 0x0000000400404040ULL,
+        0x0000000400000004ULL, 0x0000000400000004ULL, 0x0000000400400004ULL, 0x0000000400400004ULL,
+        0x0000000400004004ULL, 0x0000000400004004ULL, 0x0000000400404004ULL, 0x0000000400404004ULL,
+        0x0000000400000044ULL, 0x0000000400000044ULL, 0x0000000400400044ULL, 0x0000000400400044ULL,
+        0x0000000400004044ULL, 0x0000000400004044ULL, 0x0000000400404044ULL, 0x0000000400404044ULL,
+        0x0000040000000000ULL, 0x0000040000000000ULL, 0x0000040000400000ULL, 0x0000040000400000ULL,
+        0x0000040000004000ULL, 0x0000040000004000ULL, 0x0000040000404000ULL, 0x0000040000404000ULL,
+        0x0000040000000040ULL, 0x0000040000000040ULL, 0x0000040000400040ULL, 0x0000040000400040ULL,
+        0x0000040000004040ULL, 0x0000040000004040ULL, 0x0000040000404040ULL, 0x0000040000404040ULL,
+        0x0000040000000004ULL, 0x0000040000000004ULL, 0x0000040000400004ULL, 0x0000040000400004ULL,
+        0x0000040000004004ULL, 0x0000040000004004ULL, 0x0000040000404004ULL, 0x0000040000404004ULL,
+        0x0000040000000044ULL, 0x0000040000000044ULL, 0x0000040000400044ULL, 0x0000040000400044ULL,
+        0x0000040000004044ULL, 0x0000040000004044ULL, 0x0000040000404044ULL, 0x0000040000404044ULL,
+        0x0000040400000000ULL, 0x0000040400000000ULL, 0x0000040400400000ULL, 0x0000040400400000ULL,
+        0x0000040400004000ULL, 0x0000040400004000ULL, 0x0000040400404000ULL, 0x0000040400404000ULL,
+        0x0000040400000040ULL, 0x0000040400000040ULL, 0x0000040400400040ULL, 0x0000040400400040ULL,
+        0x0000040400004040ULL, 0x0000040400004040ULL, 0x0000040400404040ULL, 0x0000040400404040ULL,
+        0x0000040400000004ULL, 0x0000040400000004ULL, 0x0000040400400004ULL, 0x0000040400400004ULL,
+        0x0000040400004004ULL, 0x0000040400004004ULL, 0x0000040400404004ULL, 0x0000040400404004ULL,
+        0x0000040400000044ULL, 0x0000040400000044ULL, 0x0000040400400044ULL, 0x0000040400400044ULL,
+        0x0000040400004044ULL, 0x0000040400004044ULL, 0x0000040400404044ULL, 0x0000040400404044ULL,
+        0x0004000000000000ULL, 0x0004000000000000ULL, 0x0004000000400000ULL, 0x0004000000400000ULL,
+        0x0004000000004000ULL, 0x0004000000004000ULL, 0x0004000000404000ULL, 0x0004000000404000ULL,
+        0x0004000000000040ULL, 0x0004000000000040ULL, 0x0004000000400040ULL, 0x0004000000400040ULL,
+        0x0004000000004040ULL, 0x0004000000004040ULL, 0x0004000000404040ULL, 0x0004000000404040ULL,
+        0x0004000000000004ULL, 0x0004000000000004ULL, 0x0004000000400004ULL, 0x0004000000400004ULL,
+        0x0004000000004004ULL, 0x0004000000004004ULL, 0x0004000000404004ULL, 0x0004000000404004ULL,
+        0x0004000000000044ULL, 0x0004000000000044ULL, 0x0004000000400044ULL, 0x0004000000400044ULL,
+        0x0004000000004044ULL, 0x0004000000004044ULL, 0x0004000000404044ULL, 0x0004000000404044ULL,
+        0x0004000400000000ULL, 0x0004000400000000ULL, 0x0004000400400000ULL, 0x0004000400400000ULL,
+        0x0004000400004000ULL, 0x0004000400004000ULL, 0x0004000400404000ULL, 0x0004000400404000ULL,
+        0x0004000400000040ULL, 0x0004000400000040ULL, 0x0004000400400040ULL, 0x0004000400400040ULL,
+        0x0004000400004040ULL, 0x0004000400004040ULL, 0x0004000400404040ULL, 0x0004000400404040ULL,
+        0x0004000400000004ULL, 0x0004000400000004ULL, 0x0004000400400004ULL, 0x0004000400400004ULL,
+        0x0004000400004004ULL, 0x0004000400004004ULL, 0x0004000400404004ULL, 0x0004000400404004ULL,
+        0x0004000400000044ULL, 0x0004000400000044ULL, 0x0004000400400044ULL, 0x0004000400400044ULL,
+        0x0004000400004044ULL, 0x0004000400004044ULL, 0x0004000400404044ULL, 0x0004000400404044ULL,
+        0x0004040000000000ULL, 0x0004040000000000ULL, 0x0004040000400000ULL, 0x0004040000400000ULL,
+        0x0004040000004000ULL, 0x0004040000004000ULL, 0x0004040000404000ULL, 0x0004040000404000ULL,
+        0x0004040000000040ULL, 0x0004040000000040ULL, 0x0004040000400040ULL, 0x0004040000400040ULL,
+        0x0004040000004040ULL, 0x0004040000004040ULL, 0x0004040000404040ULL, 0x0004040000404040ULL,
+        0x0004040000000004ULL, 0x0004040000000004ULL, 0x0004040000400004ULL, 0x0004040000400004ULL,
+        0x0004040000004004ULL, 0x0004040000004004ULL, 0x0004040000404004ULL, 0x0004040000404004ULL,
+        0x0004040000000044ULL, 0x0004040000000044ULL, 0x0004040000400044ULL, 0x0004040000400044ULL,
+        0x0004040000004044ULL, 0x0004040000004044ULL, 0x0004040000404044ULL, 0x0004040000404044ULL,
+        0x0004040400000000ULL, 0x0004040400000000ULL, 0x0004040400400000ULL, 0x0004040400400000ULL,
+        0x0004040400004000ULL, 0x0004040400004000ULL, 0x0004040400404000ULL, 0x0004040400404000ULL,
+        0x0004040400000040ULL, 0x0004040400000040ULL, 0x0004040400400040ULL, 0x0004040400400040ULL,
+        0x0004040400004040ULL, 0x0004040400004040ULL, 0x0004040400404040ULL, 0x0004040400404040ULL,
+        0x0004040400000004ULL, 0x0004040400000004ULL, 0x0004040400400004ULL, 0x0004040400400004ULL,
+        0x0004040400004004ULL, 0x0004040400004004ULL, 0x0004040400404004ULL, 0x0004040400404004ULL,
+        0x0004040400000044ULL, 0x0004040400000044ULL, 0x0004040400400044ULL, 0x0004040400400044ULL,
+        0x0004040400004044ULL, 0x0004040400004044ULL, 0x0004040400404044ULL, 0x0004040400404044ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000800000ULL, 0x0000000000800000ULL,
+        0x0000000000008000ULL, 0x0000000000008000ULL, 0x0000000000808000ULL, 0x0000000000808000ULL,
+        0x0000000000000080ULL, 0x0000000000000080ULL, 0x0000000000800080ULL, 0x0000000000800080ULL,
+        0x0000000000008080ULL, 0x0000000000008080ULL, 0x0000000000808080ULL, 0x0000000000808080ULL,
+        0x0000000000000008ULL, 0x0000000000000008ULL, 0x0000000000800008ULL, 0x0000000000800008ULL,
+        0x0000000000008008ULL, 0x0000000000008008ULL, 0x0000000000808008ULL, 0x0000000000808008ULL,
+        0x0000000000000088ULL, 0x0000000000000088ULL, 0x0000000000800088ULL, 0x0000000000800088ULL,
+        0x0000000000008088ULL, 0x0000000000008088ULL, 0x0000000000808088ULL, 0x0000000000808088ULL,
+        0x0000000800000000ULL, 0x0000000800000000ULL, 0x0000000800800000ULL, 0x0000000800800000ULL,
+        0x0000000800008000ULL, 0x0000000800008000ULL, 0x0000000800808000ULL, 0x0000000800808000ULL,
+        0x0000000800000080ULL, 0x0000000800000080ULL, 0x0000000800800080ULL, 0x0000000800800080ULL,
+        0x0000000800008080ULL, 0x0000000800008080ULL, 0x0000000800808080ULL, 0x0000000800808080ULL,
+        0x0000000800000008ULL, 0x0000000800000008ULL, 0x0000000800800008ULL, 0x0000000800800008ULL,
+        0x0000000800008008ULL, 0x0000000800008008ULL, 0x0000000800808008ULL, 0x0000000800808008ULL,
+        0x0000000800000088ULL, 0x0000000800000088ULL, 0x0000000800800088ULL, 0x0000000800800088ULL,
+        0x0000000800008088ULL, 0x0000000800008088ULL, 0x0000000800808088ULL, 0x0000000800808088ULL,
+        0x0000080000000000ULL, 0x0000080000000000ULL, 0x0000080000800000ULL, 0x0000080000800000ULL,
+        0x0000080000008000ULL, 0x0000080000008000ULL, 0x0000080000808000ULL, 0x0000080000808000ULL,
+        0x0000080000000080ULL, 0x0000080000000080ULL, 0x0000080000800080ULL, 0x0000080000800080ULL,
+        0x0000080000008080ULL, 0x0000080000008080ULL, 0x0000080000808080ULL, 0x0000080000808080ULL,
+        0x0000080000000008ULL, 0x0000080000000008ULL, 0x0000080000800008ULL, 0x0000080000800008ULL,
+        0x0000080000008008ULL, 0x0000080000008008ULL, 0x0000080000808008ULL, 0x0000080000808008ULL,
+        0x0000080000000088ULL, 0x0000080000000088ULL, 0x0000080000800088ULL, 0x0000080000800088ULL,
+        0x0000080000008088ULL, 0x0000080000008088ULL, 0x0000080000808088ULL, 0x0000080000808088ULL,
+        0x0000080800000000ULL, 0x0000080800000000ULL, 0x0000080800800000ULL, 0x0000080800800000ULL,
+        0x0000080800008000ULL, 0x0000080800008000ULL, 0x0000080800808000ULL, 0x0000080800808000ULL,
+        0x0000080800000080ULL, 0x0000080800000080ULL, 0x0000080800800080ULL, 0x0000080800800080ULL,
+        0x0000080800008080ULL, 0x0000080800008080ULL, 0x0000080800808080ULL, 0x0000080800808080ULL,
+        0x0000080800000008ULL, 0x0000080800000008ULL, 0x0000080800800008ULL, 0x0000080800800008ULL,
+        0x0000080800008008ULL, 0x0000080800008008ULL, 0x0000080800808008ULL, 0x0000080800808008ULL,
+        0x0000080800000088ULL, 0x0000080800000088ULL, 0x0000080800800088ULL, 0x0000080800800088ULL,
+        0x0000080800008088ULL, 0x0000080800008088ULL, 0x0000080800808088ULL, 0x0000080800808088ULL,
+        0x0008000000000000ULL, 0x0008000000000000ULL, 0x0008000000800000ULL, 0x0008000000800000ULL,
+        0x0008000000008000ULL, 0x0008000000008000ULL, 0x0008000000808000ULL, 0x0008000000808000ULL,
+        0x0008000000000080ULL, 0x0008000000000080ULL, 0x0008000000800080ULL, 0x0008000000800080ULL,
+        0x0008000000008080ULL, 0x0008000000008080ULL, 0x0008000000808080ULL, 0x0008000000808080ULL,
+        0x0008000000000008ULL, 0x0008000000000008ULL, 0x0008000000800008ULL, 0x0008000000800008ULL,
+        0x0008000000008008ULL, 0x0008000000008008ULL, 0x0008000000808008ULL, 0x0008000000808008ULL,
+        0x0008000000000088ULL, 0x0008000000000088ULL, 0x0008000000800088ULL, 0x0008000000800088ULL,
+        0x0008000000008088ULL, 0x0008000000008088ULL, 0x0008000000808088ULL, 0x0008000000808088ULL,
+        0x0008000800000000ULL, 0x0008000800000000ULL, 0x0008000800800000ULL, 0x0008000800800000ULL,
+        0x0008000800008000ULL, 0x0008000800008000ULL, 0x0008000800808000ULL, 0x0008000800808000ULL,
+        0x0008000800000080ULL, 0x0008000800000080ULL, 0x0008000800800080ULL, 0x0008000800800080ULL,
+        0x0008000800008080ULL, 0x0008000800008080ULL, 0x0008000800808080ULL, 0x0008000800808080ULL,
+        0x0008000800000008ULL, 0x0008000800000008ULL, 0x0008000800800008ULL, 0x0008000800800008ULL,
+        0x0008000800008008ULL, 0x0008000800008008ULL, 0x0008000800808008ULL, 0x0008000800808008ULL,
+        0x0008000800000088ULL, 0x0008000800000088ULL, 0x0008000800800088ULL, 0x0008000800800088ULL,
+        0x0008000800008088ULL, 0x0008000800008088ULL, 0x0008000800808088ULL, 0x0008000800808088ULL,
+        0x0008080000000000ULL, 0x0008080000000000ULL, 0x0008080000800000ULL, 0x0008080000800000ULL,
+        0x0008080000008000ULL, 0x0008080000008000ULL, 0x0008080000808000ULL, 0x0008080000808000ULL,
+        0x0008080000000080ULL, 0x0008080000000080ULL, 0x0008080000800080ULL, 0x0008080000800080ULL,
+        0x0008080000008080ULL, 0x0008080000008080ULL, 0x0008080000808080ULL, 0x0008080000808080ULL,
+        0x0008080000000008ULL, 0x0008080000000008ULL, 0x0008080000800008ULL, 0x0008080000800008ULL,
+        0x0008080000008008ULL, 0x0008080000008008ULL, 0x0008080000808008ULL, 0x0008080000808008ULL,
+        0x0008080000000088ULL, 0x0008080000000088ULL, 0x0008080000800088ULL, 0x0008080000800088ULL,
+        0x0008080000008088ULL, 0x0008080000008088ULL, 0x0008080000808088ULL, 0x0008080000808088ULL,
+        0x0008080800000000ULL, 0x0008080800000000ULL, 0x0008080800800000ULL, 0x0008080800800000ULL,
+        0x0008080800008000ULL, 0x0008080800008000ULL, 0x0008080800808000ULL, 0x0008080800808000ULL,
+        0x0008080800000080ULL, 0x0008080800000080ULL, 0x0008080800800080ULL, 0x0008080800800080ULL,
+        0x0008080800008080ULL, 0x0008080800008080ULL, 0x0008080800808080ULL, 0x0008080800808080ULL,
+        0x0008080800000008ULL, 0x0008080800000008ULL, 0x0008080800800008ULL, 0x0008080800800008ULL,
+        0x0008080800008008ULL, 0x0008080800008008ULL, 0x0008080800808008ULL, 0x0008080800808008ULL,
+        0x0008080800000088ULL, 0x0008080800000088ULL, 0x0008080800800088ULL, 0x0008080800800088ULL,
+        0x0008080800008088ULL, 0x0008080800008088ULL, 0x0008080800808088ULL, 0x0008080800808088ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL, 0x0000000001000000ULL,
+        0x0000000000010000ULL, 0x0000000000010000ULL, 0x0000000001010000ULL, 0x0000000001010000ULL,
+        0x0000000000000100ULL, 0x0000000000000100ULL, 0x0000000001000100ULL, 0x0000000001000100ULL,
+        0x0000000000010100ULL, 0x0000000000010100ULL, 0x0000000001010100ULL, 0x0000000001010100ULL,
+        0x0000000010000000ULL, 0x0000000010000000ULL, 0x0000000011000000ULL, 0x0000000011000000ULL,
+        0x0000000010010000ULL, 0x0000000010010000ULL, 0x0000000011010000ULL, 0x0000000011010000ULL,
+        0x0000000010000100ULL, 0x0000000010000100ULL, 0x0000000011000100ULL, 0x0000000011000100ULL,
+        0x0000000010010100ULL, 0x0000000010010100ULL, 0x0000000011010100ULL, 0x0000000011010100ULL,
+        0x0000001000000000ULL, 0x0000001000000000ULL, 0x0000001001000000ULL, 0x0000001001000000ULL,
+        0x0000001000010000ULL, 0x0000001000010000ULL, 0x0000001001010000ULL, 0x0000001001010000ULL,
+        0x0000001000000100ULL, 0x0000001000000100ULL, 0x0000001001000100ULL, 0x0000001001000100ULL,
+        0x0000001000010100ULL, 0x0000001000010100ULL, 0x0000001001010100ULL, 0x0000001001010100ULL,
+        0x0000001010000000ULL, 0x0000001010000000ULL, 0x0000001011000000ULL, 0x0000001011000000ULL,
+        0x0000001010010000ULL, 0x0000001010010000ULL, 0x0000001011010000ULL, 0x0000001011010000ULL,
+        0x0000001010000100ULL, 0x0000001010000100ULL, 0x0000001011000100ULL, 0x0000001011000100ULL,
+        0x0000001010010100ULL, 0x0000001010010100ULL, 0x0000001011010100ULL, 0x0000001011010100ULL,
+        0x0000100000000000ULL, 0x0000100000000000ULL, 0x0000100001000000ULL, 0x0000100001000000ULL,
+        0x0000100000010000ULL, 0x0000100000010000ULL, 0x0000100001010000ULL, 0x0000100001010000ULL,
+        0x0000100000000100ULL, 0x0000100000000100ULL, 0x0000100001000100ULL, 0x0000100001000100ULL,
+        0x0000100000010100ULL, 0x0000100000010100ULL, 0x0000100001010100ULL, 0x0000100001010100ULL,
+        0x0000100010000000ULL, 0x0000100010000000ULL, 0x0000100011000000ULL, 0x0000100011000000ULL,
+        0x0000100010010000ULL, 0x0000100010010000ULL, 0x0000100011010000ULL, 0x0000100011010000ULL,
+        0x0000100010000100ULL, 0x0000100010000100ULL, 0x0000100011000100ULL, 0x0000100011000100ULL,
+        0x0000100010010100ULL, 0x0000100010010100ULL, 0x0000100011010100ULL, 0x0000100011010100ULL,
+        0x0000101000000000ULL, 0x0000101000000000ULL, 0x0000101001000000ULL, 0x0000101001000000ULL,
+        0x0000101000010000ULL, 0x0000101000010000ULL, 0x0000101001010000ULL, 0x0000101001010000ULL,
+        0x0000101000000100ULL, 0x0000101000000100ULL, 0x0000101001000100ULL, 0x0000101001000100ULL,
+        0x0000101000010100ULL, 0x0000101000010100ULL, 0x0000101001010100ULL, 0x0000101001010100ULL,
+        0x0000101010000000ULL, 0x0000101010000000ULL, 0x0000101011000000ULL, 0x0000101011000000ULL,
+        0x0000101010010000ULL, 0x0000101010010000ULL, 0x0000101011010000ULL, 0x0000101011010000ULL,
+        0x0000101010000100ULL, 0x0000101010000100ULL, 0x0000101011000100ULL, 0x0000101011000100ULL,
+        0x0000101010010100ULL, 0x0000101010010100ULL, 0x0000101011010100ULL, 0x0000101011010100ULL,
+        0x0010000000000000ULL, 0x0010000000000000ULL, 0x0010000001000000ULL, 0x0010000001000000ULL,
+        0x0010000000010000ULL, 0x0010000000010000ULL, 0x0010000001010000ULL, 0x0010000001010000ULL,
+        0x0010000000000100ULL, 0x0010000000000100ULL, 0x0010000001000100ULL, 0x0010000001000100ULL,
+        0x0010000000010100ULL, 0x0010000000010100ULL, 0x0010000001010100ULL, 0x0010000001010100ULL,
+        0x0010000010000000ULL, 0x0010000010000000ULL, 0x0010000011000000ULL, 0x0010000011000000ULL,
+        0x0010000010010000ULL, 0x0010000010010000ULL, 0x0010000011010000ULL, 0x0010000011010000ULL,
+        0x0010000010000100ULL, 0x0010000010000100ULL, 0x0010000011000100ULL, 0x0010000011000100ULL,
+        0x0010000010010100ULL, 0x0010000010010100ULL, 0x0010000011010100ULL, 0x0010000011010100ULL,
+        0x0010001000000000ULL, 0x0010001000000000ULL, 0x0010001001000000ULL, 0x0010001001000000ULL,
+        0x0010001000010000ULL, 0x0010001000010000ULL, 0x0010001001010000ULL, 0x0010001001010000ULL,
+        0x0010001000000100ULL, 0x0010001000000100ULL, 0x0010001001000100ULL, 0x0010001001000100ULL,
+        0x0010001000010100ULL, 0x0010001000010100ULL, 0x0010001001010100ULL, 0x0010001001010100ULL,
+        0x0010001010000000ULL, 0x0010001010000000ULL, 0x0010001011000000ULL, 0x0010001011000000ULL,
+        0x0010001010010000ULL, 0x0010001010010000ULL, 0x0010001011010000ULL, 0x0010001011010000ULL,
+        0x0010001010000100ULL, 0x0010001010000100ULL, 0x0010001011000100ULL, 0x0010001011000100ULL,
+        0x0010001010010100ULL, 0x0010001010010100ULL, 0x0010001011010100ULL, 0x0010001011010100ULL,
+        0x0010100000000000ULL, 0x0010100000000000ULL, 0x0010100001000000ULL, 0x0010100001000000ULL,
+        0x0010100000010000ULL, 0x0010100000010000ULL, 0x0010100001010000ULL, 0x0010100001010000ULL,
+        0x0010100000000100ULL, 0x0010100000000100ULL, 0x0010100001000100ULL, 0x0010100001000100ULL,
+        0x0010100000010100ULL, 0x0010100000010100ULL, 0x0010100001010100ULL, 0x0010100001010100ULL,
+        0x0010100010000000ULL, 0x0010100010000000ULL, 0x0010100011000000ULL, 0x0010100011000000ULL,
+        0x0010100010010000ULL, 0x0010100010010000ULL, 0x0010100011010000ULL, 0x0010100011010000ULL,
+        0x0010100010000100ULL, 0x0010100010000100ULL, 0x0010100011000100ULL, 0x0010100011000100ULL,
+        0x0010100010010100ULL, 0x0010100010010100ULL, 0x0010100011010100ULL, 0x0010100011010100ULL,
+        0x0010101000000000ULL, 0x0010101000000000ULL, 0x0010101001000000ULL, 0x0010101001000000ULL,
+        0x0010101000010000ULL, 0x0010101000010000ULL, 0x0010101001010000ULL, 0x0010101001010000ULL,
+        0x0010101000000100ULL, 0x0010101000000100ULL, 0x0010101001000100ULL, 0x0010101001000100ULL,
+        0x0010101000010100ULL, 0x0010101000010100ULL, 0x0010101001010100ULL, 0x0010101001010100ULL,
+        0x0010101010000000ULL, 0x0010101010000000ULL, 0x0010101011000000ULL, 0x0010101011000000ULL,
+        0x0010101010010000ULL, 0x0010101010010000ULL, 0x0010101011010000ULL, 0x0010101011010000ULL,
+        0x0010101010000100ULL, 0x0010101010000100ULL, 0x0010101011000100ULL, 0x0010101011000100ULL,
+        0x0010101010010100ULL, 0x0010101010010100ULL, 0x0010101011010100ULL, 0x0010101011010100ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000002000000ULL,
+        0x0000000000020000ULL, 0x0000000000020000ULL, 0x0000000002020000ULL, 0x0000000002020000ULL,
+        0x0000000000000200ULL, 0x0000000000000200ULL, 0x0000000002000200ULL, 0x0000000002000200ULL,
+        0x0000000000020200ULL, 0x0000000000020200ULL, 0x0000000002020200ULL, 0x0000000002020200ULL,
+        0x0000000020000000ULL, 0x0000000020000000ULL, 0x0000000022000000ULL, 0x0000000022000000ULL,
+        0x0000000020020000ULL, 0x0000000020020000ULL, 0x0000000022020000ULL, 0x0000000022020000ULL,
+        0x0000000020000200ULL, 0x0000000020000200ULL, 0x0000000022000200ULL, 0x0000000022000200ULL,
+        0x0000000020020200ULL, 0x0000000020020200ULL, 0x0000000022020200ULL, 0x0000000022020200ULL,
+        0x0000002000000000ULL, 0x0000002000000000ULL, 0x0000002002000000ULL, 0x0000002002000000ULL,
+        0x0000002000020000ULL, 0x0000002000020000ULL, 0x0000002002020000ULL, 0x0000002002020000ULL,
+        0x0000002000000200ULL, 0x0000002000000200ULL, 0x0000002002000200ULL, 0x0000002002000200ULL,
+        0x0000002000020200ULL, 0x0000002000020200ULL, 0x0000002002020200ULL, 0x0000002002020200ULL,
+        0x0000002020000000ULL, 0x0000002020000000ULL, 0x0000002022000000ULL, 0x0000002022000000ULL,
+        0x0000002020020000ULL, 0x0000002020020000ULL, 0x0000002022020000ULL, 0x0000002022020000ULL,
+        0x0000002020000200ULL, 0x0000002020000200ULL, 0x0000002022000200ULL, 0x0000002022000200ULL,
+        0x0000002020020200ULL, 0x0000002020020200ULL, 0x0000002022020200ULL, 0x0000002022020200ULL,
+        0x0000200000000000ULL, 0x0000200000000000ULL, 0x0000200002000000ULL, 0x0000200002000000ULL,
+        0x0000200000020000ULL, 0x0000200000020000ULL, 0x0000200002020000ULL, 0x0000200002020000ULL,
+        0x0000200000000200ULL, 0x0000200000000200ULL, 0x0000200002000200ULL, 0x0000200002000200ULL,
+        0x0000200000020200ULL, 0x0000200000020200ULL, 0x0000200002020200ULL, 0x0000200002020200ULL,
+        0x0000200020000000ULL, 0x0000200020000000ULL, 0x0000200022000000ULL, 0x0000200022000000ULL,
+        0x0000200020020000ULL, 0x0000200020020000ULL, 0x0000200022020000ULL, 0x0000200022020000ULL,
+        0x0000200020000200ULL, 0x0000200020000200ULL, 0x0000200022000200ULL, 0x0000200022000200ULL,
+        0x0000200020020200ULL, 0x0000200020020200ULL, 0x0000200022020200ULL, 0x0000200022020200ULL,
+        0x0000202000000000ULL, 0x0000202000000000ULL, 0x0000202002000000ULL, 0x0000202002000000ULL,
+        0x0000202000020000ULL, 0x0000202000020000ULL, 0x0000202002020000ULL, 0x0000202002020000ULL,
+        0x0000202000000200ULL, 0x0000202000000200ULL, 0x0000202002000200ULL, 0x0000202002000200ULL,
+        0x0000202000020200ULL, 0x0000202000020200ULL, 0x0000202002020200ULL, 0x0000202002020200ULL,
+        0x0000202020000000ULL, 0x0000202020000000ULL, 0x0000202022000000ULL, 0x0000202022000000ULL,
+        0x0000202020020000ULL, 0x0000202020020000ULL, 0x0000202022020000ULL, 0x0000202022020000ULL,
+        0x0000202020000200ULL, 0x0000202020000200ULL, 0x0000202022000200ULL, 0x0000202022000200ULL,
+        0x0000202020020200ULL, 0x0000202020020200ULL, 0x0000202022020200ULL, 0x0000202022020200ULL,
+        0x0020000000000000ULL, 0x0020000000000000ULL, 0x0020000002000000ULL, 0x0020000002000000ULL,
+        0x0020000000020000ULL, 0x0020000000020000ULL, 0x0020000002020000ULL, 0x0020000002020000ULL,
+        0x0020000000000200ULL, 0x0020000000000200ULL, 0x0020000002000200ULL, 0x0020000002000200ULL,
+        0x0020000000020200ULL, 0x0020000000020200ULL, 0x0020000002020200ULL, 0x0020000002020200ULL,
+        0x0020000020000000ULL, 0x0020000020000000ULL, 0x0020000022000000ULL, 0x0020000022000000ULL,
+        0x0020000020020000ULL, 0x0020000020020000ULL, 0x0020000022020000ULL, 0x0020000022020000ULL,
+        0x0020000020000200ULL, 0x0020000020000200ULL, 0x0020000022000200ULL, 0x0020000022000200ULL,
+        0x0020000020020200ULL, 0x0020000020020200ULL, 0x0020000022020200ULL, 0x0020000022020200ULL,
+        0x0020002000000000ULL, 0x0020002000000000ULL, 0x0020002002000000ULL, 0x0020002002000000ULL,
+        0x0020002000020000ULL, 0x0020002000020000ULL, 0x0020002002020000ULL, 0x0020002002020000ULL,
+        0x0020002000000200ULL, 0x0020002000000200ULL, 0x0020002002000200ULL, 0x0020002002000200ULL,
+        0x0020002000020200ULL, 0x0020002000020200ULL, 0x0020002002020200ULL, 0x0020002002020200ULL,
+        0x0020002020000000ULL, 0x0020002020000000ULL, 0x0020002022000000ULL, 0x0020002022000000ULL,
+        0x0020002020020000ULL, 0x0020002020020000ULL, 0x0020002022020000ULL, 0x0020002022020000ULL,
+        0x0020002020000200ULL, 0x0020002020000200ULL, 0x0020002022000200ULL, 0x0020002022000200ULL,
+        0x0020002020020200ULL, 0x0020002020020200ULL, 0x0020002022020200ULL, 0x0020002022020200ULL,
+        0x0020200000000000ULL, 0x0020200000000000ULL, 0x0020200002000000ULL, 0x0020200002000000ULL,
+        0x0020200000020000ULL, 0x0020200000020000ULL, 0x0020200002020000ULL, 0x0020200002020000ULL,
+        0x0020200000000200ULL, 0x0020200000000200ULL, 0x0020200002000200ULL, 0x0020200002000200ULL,
+        0x0020200000020200ULL, 0x0020200000020200ULL, 0x0020200002020200ULL, 0x0020200002020200ULL,
+        0x0020200020000000ULL, 0x0020200020000000ULL, 0x0020200022000000ULL, 0x0020200022000000ULL,
+        0x0020200020020000ULL, 0x0020200020020000ULL, 0x0020200022020000ULL, 0x0020200022020000ULL,
+        0x0020200020000200ULL, 0x0020200020000200ULL, 0x0020200022000200ULL, 0x0020200022000200ULL,
+        0x0020200020020200ULL, 0x0020200020020200ULL, 0x0020200022020200ULL, 0x0020200022020200ULL,
+        0x0020202000000000ULL, 0x0020202000000000ULL, 0x0020202002000000ULL, 0x0020202002000000ULL,
+        0x0020202000020000ULL, 0x0020202000020000ULL, 0x0020202002020000ULL, 0x0020202002020000ULL,
+        0x0020202000000200ULL, 0x0020202000000200ULL, 0x0020202002000200ULL, 0x0020202002000200ULL,
+        0x0020202000020200ULL, 0x0020202000020200ULL, 0x0020202002020200ULL, 0x0020202002020200ULL,
+        0x0020202020000000ULL, 0x0020202020000000ULL, 0x0020202022000000ULL, 0x0020202022000000ULL,
+        0x0020202020020000ULL, 0x0020202020020000ULL, 0x0020202022020000ULL, 0x0020202022020000ULL,
+        0x0020202020000200ULL, 0x0020202020000200ULL, 0x0020202022000200ULL, 0x0020202022000200ULL,
+        0x0020202020020200ULL, 0x0020202020020200ULL, 0x0020202022020200ULL, 0x0020202022020200ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000004000000ULL,
+        0x0000000000040000ULL, 0x0000000000040000ULL, 0x0000000004040000ULL, 0x0000000004040000ULL,
+        0x0000000000000400ULL, 0x0000000000000400ULL, 0x0000000004000400ULL, 0x0000000004000400ULL,
+        0x0000000000040400ULL, 0x0000000000040400ULL, 0x0000000004040400ULL, 0x0000000004040400ULL,
+        0x0000000040000000ULL, 0x0000000040000000ULL, 0x0000000044000000ULL, 0x0000000044000000ULL,
+        0x0000000040040000ULL, 0x0000000040040000ULL, 0x0000000044040000ULL, 0x0000000044040000ULL,
+        0x0000000040000400ULL, 0x0000000040000400ULL, 0x0000000044000400ULL, 0x0000000044000400ULL,
+        0x0000000040040400ULL, 0x0000000040040400ULL, 0x0000000044040400ULL, 0x0000000044040400ULL,
+        0x0000004000000000ULL, 0x0000004000000000ULL, 0x0000004004000000ULL, 0x0000004004000000ULL,
+        0x0000004000040000ULL, 0x0000004000040000ULL, 0x0000004004040000ULL, 0x0000004004040000ULL,
+        0x0000004000000400ULL, 0x0000004000000400ULL, 0x0000004004000400ULL, 0x0000004004000400ULL,
+        0x0000004000040400ULL, 0x0000004000040400ULL, 0x0000004004040400ULL, 0x0000004004040400ULL,
+        0x0000004040000000ULL, 0x0000004040000000ULL, 0x0000004044000000ULL, 0x0000004044000000ULL,
+        0x0000004040040000ULL, 0x0000004040040000ULL, 0x0000004044040000ULL, 0x0000004044040000ULL,
+        0x0000004040000400ULL, 0x0000004040000400ULL, 0x0000004044000400ULL, 0x0000004044000400ULL,
+        0x0000004040040400ULL, 0x0000004040040400ULL, 0x0000004044040400ULL, 0x0000004044040400ULL,
+        0x0000400000000000ULL, 0x0000400000000000ULL, 0x0000400004000000ULL, 0x0000400004000000ULL,
+        0x0000400000040000ULL, 0x0000400000040000ULL, 0x0000400004040000ULL, 0x0000400004040000ULL,
+        0x0000400000000400ULL, 0x0000400000000400ULL, 0x0000400004000400ULL, 0x0000400004000400ULL,
+        0x0000400000040400ULL, 0x0000400000040400ULL, 0x0000400004040400ULL, 0x0000400004040400ULL,
+        0x0000400040000000ULL, 0x0000400040000000ULL, 0x0000400044000000ULL, 0x0000400044000000ULL,
+        0x0000400040040000ULL, 0x0000400040040000ULL, 0x0000400044040000ULL, 0x0000400044040000ULL,
+        0x0000400040000400ULL, 0x0000400040000400ULL, 0x0000400044000400ULL, 0x0000400044000400ULL,
+        0x0000400040040400ULL, 0x0000400040040400ULL, 0x0000400044040400ULL, 0x0000400044040400ULL,
+        0x0000404000000000ULL, 0x0000404000000000ULL, 0x0000404004000000ULL, 0x0000404004000000ULL,
+        0x0000404000040000ULL, 0x0000404000040000ULL, 0x0000404004040000ULL, 0x0000404004040000ULL,
+        0x0000404000000400ULL, 0x0000404000000400ULL, 0x0000404004000400ULL, 0x0000404004000400ULL,
+        0x0000404000040400ULL, 0x0000404000040400ULL, 0x0000404004040400ULL, 0x0000404004040400ULL,
+        0x0000404040000000ULL, 0x0000404040000000ULL, 0x0000404044000000ULL, 0x0000404044000000ULL,
+        0x0000404040040000ULL, 0x0000404040040000ULL, 0x0000404044040000ULL, 0x0000404044040000ULL,
+        0x0000404040000400ULL, 0x0000404040000400ULL, 0x0000404044000400ULL, 0x0000404044000400ULL,
+        0x0000404040040400ULL, 0x0000404040040400ULL, 0x0000404044040400ULL, 0x0000404044040400ULL,
+        0x0040000000000000ULL, 0x0040000000000000ULL, 0x0040000004000000ULL, 0x0040000004000000ULL,
+        0x0040000000040000ULL, 0x0040000000040000ULL, 0x0040000004040000ULL, 0x0040000004040000ULL,
+        0x0040000000000400ULL, 0x0040000000000400ULL, 0x0040000004000400ULL, 0x0040000004000400ULL,
+        0x0040000000040400ULL, 0x0040000000040400ULL, 0x0040000004040400ULL, 0x0040000004040400ULL,
+        0x0040000040000000ULL, 0x0040000040000000ULL, 0x0040000044000000ULL, 0x0040000044000000ULL,
+        0x0040000040040000ULL, 0x0040000040040000ULL, 0x0040000044040000ULL, 0x0040000044040000ULL,
+        0x0040000040000400ULL, 0x0040000040000400ULL, 0x0040000044000400ULL, 0x0040000044000400ULL,
+        0x0040000040040400ULL, 0x0040000040040400ULL, 0x0040000044040400ULL, 0x0040000044040400ULL,
+        0x0040004000000000ULL, 0x0040004000000000ULL, 0x0040004004000000ULL, 0x0040004004000000ULL,
+        0x0040004000040000ULL, 0x0040004000040000ULL, 0x0040004004040000ULL, 0x0040004004040000ULL,
+        0x0040004000000400ULL, 0x0040004000000400ULL, 0x0040004004000400ULL, 0x0040004004000400ULL,
+        0x0040004000040400ULL, 0x0040004000040400ULL, 0x0040004004040400ULL, 0x0040004004040400ULL,
+        0x0040004040000000ULL, 0x0040004040000000ULL, 0x0040004044000000ULL, 0x0040004044000000ULL,
+        0x0040004040040000ULL, 0x0040004040040000ULL, 0x0040004044040000ULL, 0x0040004044040000ULL,
+        0x0040004040000400ULL, 0x0040004040000400ULL, 0x0040004044000400ULL, 0x0040004044000400ULL,
+        0x0040004040040400ULL, 0x0040004040040400ULL, 0x0040004044040400ULL, 0x0040004044040400ULL,
+        0x0040400000000000ULL, 0x0040400000000000ULL, 0x0040400004000000ULL, 0x0040400004000000ULL,
+        0x0040400000040000ULL, 0x0040400000040000ULL, 0x0040400004040000ULL, 0x0040400004040000ULL,
+        0x0040400000000400ULL, 0x0040400000000400ULL, 0x0040400004000400ULL, 0x0040400004000400ULL,
+        0x0040400000040400ULL, 0x0040400000040400ULL, 0x0040400004040400ULL, 0x0040400004040400ULL,
+        0x0040400040000000ULL, 0x0040400040000000ULL, 0x0040400044000000ULL, 0x0040400044000000ULL,
+        0x0040400040040000ULL, 0x0040400040040000ULL, 0x0040400044040000ULL, 0x0040400044040000ULL,
+        0x0040400040000400ULL, 0x0040400040000400ULL, 0x0040400044000400ULL, 0x0040400044000400ULL,
+        0x0040400040040400ULL, 0x0040400040040400ULL, 0x0040400044040400ULL, 0x0040400044040400ULL,
+        0x0040404000000000ULL, 0x0040404000000000ULL, 0x0040404004000000ULL, 0x0040404004000000ULL,
+        0x0040404000040000ULL, 0x0040404000040000ULL, 0x0040404004040000ULL, 0x0040404004040000ULL,
+        0x0040404000000400ULL, 0x0040404000000400ULL, 0x0040404004000400ULL, 0x0040404004000400ULL,
+        0x0040404000040400ULL, 0x0040404000040400ULL, 0x0040404004040400ULL, 0x0040404004040400ULL,
+        0x0040404040000000ULL, 0x0040404040000000ULL, 0x0040404044000000ULL, 0x0040404044000000ULL,
+        0x0040404040040000ULL, 0x0040404040040000ULL, 0x0040404044040000ULL, 0x0040404044040000ULL,
+        0x0040404040000400ULL, 0x0040404040000400ULL, 0x0040404044000400ULL, 0x0040404044000400ULL,
+        0x0040404040040400ULL, 0x0040404040040400ULL, 0x0040404044040400ULL, 0x0040404044040400ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000008000000ULL,
+        0x0000000000080000ULL, 0x0000000000080000ULL, 0x0000000008080000ULL, 0x0000000008080000ULL,
+        0x0000000000000800ULL, 0x0000000000000800ULL, 0x0000000008000800ULL, 0x0000000008000800ULL,
+        0x0000000000080800ULL, 0x0000000000080800ULL, 0x0000000008080800ULL, 0x0000000008080800ULL,
+        0x0000000080000000ULL, 0x0000000080000000ULL, 0x0000000088000000ULL, 0x0000000088000000ULL,
+        0x0000000080080000ULL, 0x0000000080080000ULL, 0x0000000088080000ULL, 0x0000000088080000ULL,
+        0x0000000080000800ULL, 0x0000000080000800ULL, 0x0000000088000800ULL, 0x0000000088000800ULL,
+        0x0000000080080800ULL, 0x0000000080080800ULL, 0x0000000088080800ULL, 0x0000000088080800ULL,
+        0x0000008000000000ULL, 0x0000008000000000ULL, 0x0000008008000000ULL, 0x0000008008000000ULL,
+        0x0000008000080000ULL, 0x0000008000080000ULL, 0x0000008008080000ULL, 0x0000008008080000ULL,
+        0x0000008000000800ULL, 0x0000008000000800ULL, 0x0000008008000800ULL, 0x0000008008000800ULL,
+        0x0000008000080800ULL, 0x0000008000080800ULL, 0x0000008008080800ULL, 0x0000008008080800ULL,
+        0x0000008080000000ULL, 0x0000008080000000ULL, 0x0000008088000000ULL, 0x0000008088000000ULL,
+        0x0000008080080000ULL, 0x0000008080080000ULL, 0x0000008088080000ULL, 0x0000008088080000ULL,
+        0x0000008080000800ULL, 0x0000008080000800ULL, 0x0000008088000800ULL, 0x0000008088000800ULL,
+        0x0000008080080800ULL, 0x0000008080080800ULL, 0x0000008088080800ULL, 0x0000008088080800ULL,
+        0x0000800000000000ULL, 0x0000800000000000ULL, 0x0000800008000000ULL, 0x0000800008000000ULL,
+        0x0000800000080000ULL, 0x0000800000080000ULL, 0x0000800008080000ULL, 0x0000800008080000ULL,
+        0x0000800000000800ULL, 0x0000800000000800ULL, 0x0000800008000800ULL, 0x0000800008000800ULL,
+        0x0000800000080800ULL, 0x0000800000080800ULL, 0x0000800008080800ULL, 0x0000800008080800ULL,
+        0x0000800080000000ULL, 0x0000800080000000ULL, 0x0000800088000000ULL, 0x0000800088000000ULL,
+        0x0000800080080000ULL, 0x0000800080080000ULL, 0x0000800088080000ULL, 0x0000800088080000ULL,
+        0x0000800080000800ULL, 0x0000800080000800ULL, 0x0000800088000800ULL, 0x0000800088000800ULL,
+        0x0000800080080800ULL, 0x0000800080080800ULL, 0x0000800088080800ULL, 0x0000800088080800ULL,
+        0x0000808000000000ULL, 0x0000808000000000ULL, 0x0000808008000000ULL, 0x0000808008000000ULL,
+        0x0000808000080000ULL, 0x0000808000080000ULL, 0x0000808008080000ULL, 0x0000808008080000ULL,
+        0x0000808000000800ULL, 0x0000808000000800ULL, 0x0000808008000800ULL, 0x0000808008000800ULL,
+        0x0000808000080800ULL, 0x0000808000080800ULL, 0x0000808008080800ULL, 0x0000808008080800ULL,
+        0x0000808080000000ULL, 0x0000808080000000ULL, 0x0000808088000000ULL, 0x0000808088000000ULL,
+        0x0000808080080000ULL, 0x0000808080080000ULL, 0x0000808088080000ULL, 0x0000808088080000ULL,
+        0x0000808080000800ULL, 0x0000808080000800ULL, 0x0000808088000800ULL, 0x0000808088000800ULL,
+        0x0000808080080800ULL, 0x0000808080080800ULL, 0x0000808088080800ULL, 0x0000808088080800ULL,
+        0x0080000000000000ULL, 0x0080000000000000ULL, 0x0080000008000000ULL, 0x0080000008000000ULL,
+        0x0080000000080000ULL, 0x0080000000080000ULL, 0x0080000008080000ULL, 0x0080000008080000ULL,
+        0x0080000000000800ULL, 0x0080000000000800ULL, 0x0080000008000800ULL, 0x0080000008000800ULL,
+        0x0080000000080800ULL, 0x0080000000080800ULL, 0x0080000008080800ULL, 0x0080000008080800ULL,
+        0x0080000080000000ULL, 0x0080000080000000ULL, 0x0080000088000000ULL, 0x0080000088000000ULL,
+        0x0080000080080000ULL, 0x0080000080080000ULL, 0x0080000088080000ULL, 0x0080000088080000ULL,
+        0x0080000080000800ULL, 0x0080000080000800ULL, 0x0080000088000800ULL, 0x0080000088000800ULL,
+        0x0080000080080800ULL, 0x0080000080080800ULL, 0x0080000088080800ULL, 0x0080000088080800ULL,
+        0x0080008000000000ULL, 0x0080008000000000ULL, 0x0080008008000000ULL, 0x0080008008000000ULL,
+        0x0080008000080000ULL, 0x0080008000080000ULL, 0x0080008008080000ULL, 0x0080008008080000ULL,
+        0x0080008000000800ULL, 0x0080008000000800ULL, 0x0080008008000800ULL, 0x0080008008000800ULL,
+        0x0080008000080800ULL, 0x0080008000080800ULL, 0x0080008008080800ULL, 0x0080008008080800ULL,
+        0x0080008080000000ULL, 0x0080008080000000ULL, 0x0080008088000000ULL, 0x0080008088000000ULL,
+        0x0080008080080000ULL, 0x0080008080080000ULL, 0x0080008088080000ULL, 0x0080008088080000ULL,
+        0x0080008080000800ULL, 0x0080008080000800ULL, 0x0080008088000800ULL, 0x0080008088000800ULL,
+        0x0080008080080800ULL, 0x0080008080080800ULL, 0x0080008088080800ULL, 0x0080008088080800ULL,
+        0x0080800000000000ULL, 0x0080800000000000ULL, 0x0080800008000000ULL, 0x0080800008000000ULL,
+        0x0080800000080000ULL, 0x0080800000080000ULL, 0x0080800008080000ULL, 0x0080800008080000ULL,
+        0x0080800000000800ULL, 0x0080800000000800ULL, 0x0080800008000800ULL, 0x0080800008000800ULL,
+        0x0080800000080800ULL, 0x0080800000080800ULL, 0x0080800008080800ULL, 0x0080800008080800ULL,
+        0x0080800080000000ULL, 0x0080800080000000ULL, 0x0080800088000000ULL, 0x0080800088000000ULL,
+        0x0080800080080000ULL, 0x0080800080080000ULL, 0x0080800088080000ULL, 0x0080800088080000ULL,
+        0x0080800080000800ULL, 0x0080800080000800ULL, 0x0080800088000800ULL, 0x0080800088000800ULL,
+        0x0080800080080800ULL, 0x0080800080080800ULL, 0x0080800088080800ULL, 0x0080800088080800ULL,
+        0x0080808000000000ULL, 0x0080808000000000ULL, 0x0080808008000000ULL, 0x0080808008000000ULL,
+        0x0080808000080000ULL, 0x0080808000080000ULL, 0x0080808008080000ULL, 0x0080808008080000ULL,
+        0x0080808000000800ULL, 0x0080808000000800ULL, 0x0080808008000800ULL, 0x0080808008000800ULL,
+        0x0080808000080800ULL, 0x0080808000080800ULL, 0x0080808008080800ULL, 0x0080808008080800ULL,
+        0x0080808080000000ULL, 0x0080808080000000ULL, 0x0080808088000000ULL, 0x0080808088000000ULL,
+        0x0080808080080000ULL, 0x0080808080080000ULL, 0x0080808088080000ULL, 0x0080808088080000ULL,
+        0x0080808080000800ULL, 0x0080808080000800ULL, 0x0080808088000800ULL, 0x0080808088000800ULL,
+        0x0080808080080800ULL, 0x0080808080080800ULL, 0x0080808088080800ULL, 0x0080808088080800ULL}
+};
+
+// 置换选择PC-2: 56位CD按字节查表(7组), 输出48位
+const BYTE DES_PC2_TABLE[7][256] DES_CACHE_ALIGNED = {
+    {
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000010000000ULL, 0x0000000050000000ULL,
+        0x0000004000000000ULL, 0x0000004040000000ULL, 0x0000004010000000ULL, 0x0000004050000000ULL,
+        0x0000040000000000ULL, 0x0000040040000000ULL, 0x0000040010000000ULL, 0x0000040050000000ULL,
+        0x0000044000000000ULL, 0x0000044040000000ULL, 0x0000044010000000ULL, 0x0000044050000000ULL,
+        0x0000000100000000ULL, 0x0000000140000000ULL, 0x0000000110000000ULL, 0x0000000150000000ULL,
+        0x0000004100000000ULL, 0x0000004140000000ULL, 0x0000004110000000ULL, 0x0000004150000000ULL,
+        0x0000040100000000ULL, 0x0000040140000000ULL, 0x0000040110000000ULL, 0x0000040150000000ULL,
+        0x0000044100000000ULL, 0x0000044140000000ULL, 0x0000044110000000ULL, 0x0000044150000000ULL,
+        0x0000020000000000ULL, 0x0000020040000000ULL, 0x0000020010000000ULL, 0x0000020050000000ULL,
+        0x0000024000000000ULL, 0x0000024040000000ULL, 0x0000024010000000ULL, 0x0000024050000000ULL,
+        0x0000060000000000ULL, 0x0000060040000000ULL, 0x0000060010000000ULL, 0x0000060050000000ULL,
+        0x0000064000000000ULL, 0x0000064040000000ULL, 0x0000064010000000ULL, 0x0000064050000000ULL,
+        0x0000020100000000ULL, 0x0000020140000000ULL, 0x0000020110000000ULL, 0x0000020150000000ULL,
+        0x0000024100000000ULL, 0x0000024140000000ULL, 0x0000024110000000ULL, 0x0000024150000000ULL,
+        0x0000060100000000ULL, 0x0000060140000000ULL, 0x0000060110000000ULL, 0x0000060150000000ULL,
+        0x0000064100000000ULL, 0x0000064140000000ULL, 0x0000064110000000ULL, 0x0000064150000000ULL,
+        0x0000000001000000ULL, 0x0000000041000000ULL, 0x0000000011000000ULL, 0x0000000051000000ULL,
+        0x0000004001000000ULL, 0x0000004041000000ULL, 0x0000004011000000ULL, 0x0000004051000000ULL,
+        0x0000040001000000ULL, 0x0000040041000000ULL, 0x0000040011000000ULL, 0x0000040051000000ULL,
+        0x0000044001000000ULL, 0x0000044041000000ULL, 0x0000044011000000ULL, 0x0000044051000000ULL,
+        0x0000000101000000ULL, 0x0000000141000000ULL, 0x0000000111000000ULL, 0x0000000151000000ULL,
+        0x0000004101000000ULL, 0x0000004141000000ULL, 0x0000004111000000ULL, 0x0000004151000000ULL,
+        0x0000040101000000ULL, 0x0000040141000000ULL, 0x0000040111000000ULL, 0x0000040151000000ULL,
+        0x0000044101000000ULL, 0x0000044141000000ULL, 0x0000044111000000ULL, 0x0000044151000000ULL,
+        0x0000020001000000ULL, 0x0000020041000000ULL, 0x0000020011000000ULL, 0x0000020051000000ULL,
+        0x0000024001000000ULL, 0x0000024041000000ULL, 0x0000024011000000ULL, 0x0000024051000000ULL,
+        0x0000060001000000ULL, 0x0000060041000000ULL, 0x0000060011000000ULL, 0x0000060051000000ULL,
+        0x0000064001000000ULL, 0x0000064041000000ULL, 0x0000064011000000ULL, 0x0000064051000000ULL,
+        0x0000020101000000ULL, 0x0000020141000000ULL, 0x0000020111000000ULL, 0x0000020151000000ULL,
+        0x0000024101000000ULL, 0x0000024141000000ULL, 0x0000024111000000ULL, 0x0000024151000000ULL,
+        0x0000060101000000ULL, 0x0000060141000000ULL, 0x0000060111000000ULL, 0x0000060151000000ULL,
+        0x0000064101000000ULL, 0x0000064141000000ULL, 0x0000064111000000ULL, 0x0000064151000000ULL,
+        0x0000080000000000ULL, 0x0000080040000000ULL, 0x0000080010000000ULL, 0x0000080050000000ULL,
+        0x0000084000000000ULL, 0x0000084040000000ULL, 0x0000084010000000ULL, 0x0000084050000000ULL,
+        0x00000C0000000000ULL, 0x00000C0040000000ULL, 0x00000C0010000000ULL, 0x00000C0050000000ULL,
+        0x00000C4000000000ULL, 0x00000C4040000000ULL, 0x00000C4010000000ULL, 0x00000C4050000000ULL,
+        0x0000080100000000ULL, 0x0000080140000000ULL, 0x0000080110000000ULL, 0x0000080150000000ULL,
+        0x0000084100000000ULL, 0x0000084140000000ULL, 0x0000084110000000ULL, 0x0000084150000000ULL,
+        0x00000C0100000000ULL, 0x00000C0140000000ULL, 0x00000C0110000000ULL, 0x00000C0150000000ULL,
+        0x00000C4100000000ULL, 0x00000C4140000000ULL, 0x00000C4110000000ULL, 0x00000C4150000000ULL,
+        0x00000A0000000000ULL, 0x00000A0040000000ULL, 0x00000A0010000000ULL, 0x00000A0050000000ULL,
+        0x00000A4000000000ULL, 0x00000A4040000000ULL, 0x00000A4010000000ULL, 0x00000A4050000000ULL,
+        0x00000E0000000000ULL, 0x00000E0040000000ULL, 0x00000E0010000000ULL, 0x00000E0050000000ULL,
+        0x00000E4000000000ULL, 0x00000E4040000000ULL, 0x00000E4010000000ULL, 0x00000E4050000000ULL,
+        0x00000A0100000000ULL, 0x00000A0140000000ULL, 0x00000A0110000000ULL, 0x00000A0150000000ULL,
+        0x00000A4100000000ULL, 0x00000A4140000000ULL, 0x00000A4110000000ULL, 0x00000A4150000000ULL,
+        0x00000E0100000000ULL, 0x00000E0140000000ULL, 0x00000E0110000000ULL, 0x00000E0150000000ULL,
+        0x00000E4100000000ULL, 0x00000E4140000000ULL, 0x00000E4110000000ULL, 0x00000E4150000000ULL,
+        0x0000080001000000ULL, 0x0000080041000000ULL, 0x0000080011000000ULL, 0x0000080051000000ULL,
+        0x0000084001000000ULL, 0x0000084041000000ULL, 0x0000084011000000ULL, 0x0000084051000000ULL,
+        0x00000C0001000000ULL, 0x00000C0041000000ULL, 0x00000C0011000000ULL, 0x00000C0051000000ULL,
+        0x00000C4001000000ULL, 0x00000C4041000000ULL, 0x00000C4011000000ULL, 0x00000C4051000000ULL,
+        0x0000080101000000ULL, 0x0000080141000000ULL, 0x0000080111000000ULL, 0x0000080151000000ULL,
+        0x0000084101000000ULL, 0x0000084141000000ULL, 0x0000084111000000ULL, 0x0000084151000000ULL,
+        0x00000C0101000000ULL, 0x00000C0141000000ULL, 0x00000C0111000000ULL, 0x00000C0151000000ULL,
+        0x00000C4101000000ULL, 0x00000C4141000000ULL, 0x00000C4111000000ULL, 0x00000C4151000000ULL,
+        0x00000A0001000000ULL, 0x00000A0041000000ULL, 0x00000A0011000000ULL, 0x00000A0051000000ULL,
+        0x00000A4001000000ULL, 0x00000A4041000000ULL, 0x00000A4011000000ULL, 0x00000A4051000000ULL,
+        0x00000E0001000000ULL, 0x00000E0041000000ULL, 0x00000E0011000000ULL, 0x00000E0051000000ULL,
+        0x00000E4001000000ULL, 0x00000E4041000000ULL, 0x00000E4011000000ULL, 0x00000E4051000000ULL,
+        0x00000A0101000000ULL, 0x00000A0141000000ULL, 0x00000A0111000000ULL, 0x00000A0151000000ULL,
+        0x00000A4101000000ULL, 0x00000A4141000000ULL, 0x00000A4111000000ULL, 0x00000A4151000000ULL,
+        0x00000E0101000000ULL, 0x00000E0141000000ULL, 0x00000E0111000000ULL, 0x00000E0151000000ULL,
+        0x00000E4101000000ULL, 0x00000E4141000000ULL, 0x00000E4111000000ULL, 0x00000E4151000000ULL},
+    {
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000008000000000ULL, 0x0000008020000000ULL,
+        0x0000800000000000ULL, 0x0000800020000000ULL, 0x0000808000000000ULL, 0x0000808020000000ULL,
+        0x0000000002000000ULL, 0x0000000022000000ULL, 0x0000008002000000ULL, 0x0000008022000000ULL,
+        0x0000800002000000ULL, 0x0000800022000000ULL, 0x0000808002000000ULL, 0x0000808022000000ULL,
+        0x0000000200000000ULL, 0x0000000220000000ULL, 0x0000008200000000ULL, 0x0000008220000000ULL,
+        0x0000800200000000ULL, 0x0000800220000000ULL, 0x0000808200000000ULL, 0x0000808220000000ULL,
+        0x0000000202000000ULL, 0x0000000222000000ULL, 0x0000008202000000ULL, 0x0000008222000000ULL,
+        0x0000800202000000ULL, 0x0000800222000000ULL, 0x0000808202000000ULL, 0x0000808222000000ULL,
+        0x0000200000000000ULL, 0x0000200020000000ULL, 0x0000208000000000ULL, 0x0000208020000000ULL,
+        0x0000A00000000000ULL, 0x0000A00020000000ULL, 0x0000A08000000000ULL, 0x0000A08020000000ULL,
+        0x0000200002000000ULL, 0x0000200022000000ULL, 0x0000208002000000ULL, 0x0000208022000000ULL,
+        0x0000A00002000000ULL, 0x0000A00022000000ULL, 0x0000A08002000000ULL, 0x0000A08022000000ULL,
+        0x0000200200000000ULL, 0x0000200220000000ULL, 0x0000208200000000ULL, 0x0000208220000000ULL,
+        0x0000A00200000000ULL, 0x0000A00220000000ULL, 0x0000A08200000000ULL, 0x0000A08220000000ULL,
+        0x0000200202000000ULL, 0x0000200222000000ULL, 0x0000208202000000ULL, 0x0000208222000000ULL,
+        0x0000A00202000000ULL, 0x0000A00222000000ULL, 0x0000A08202000000ULL, 0x0000A08222000000ULL,
+        0x0000001000000000ULL, 0x0000001020000000ULL, 0x0000009000000000ULL, 0x0000009020000000ULL,
+        0x0000801000000000ULL, 0x0000801020000000ULL, 0x0000809000000000ULL, 0x0000809020000000ULL,
+        0x0000001002000000ULL, 0x0000001022000000ULL, 0x0000009002000000ULL, 0x0000009022000000ULL,
+        0x0000801002000000ULL, 0x0000801022000000ULL, 0x0000809002000000ULL, 0x0000809022000000ULL,
+        0x0000001200000000ULL, 0x0000001220000000ULL, 0x0000009200000000ULL, 0x0000009220000000ULL,
+        0x0000801200000000ULL, 0x0000801220000000ULL, 0x0000809200000000ULL, 0x0000809220000000ULL,
+        0x0000001202000000ULL, 0x0000001222000000ULL, 0x0000009202000000ULL, 0x0000009222000000ULL,
+        0x0000801202000000ULL, 0x0000801222000000ULL, 0x0000809202000000ULL, 0x0000809222000000ULL,
+        0x0000201000000000ULL, 0x0000201020000000ULL, 0x0000209000000000ULL, 0x0000209020000000ULL,
+        0x0000A01000000000ULL, 0x0000A01020000000ULL, 0x0000A09000000000ULL, 0x0000A09020000000ULL,
+        0x0000201002000000ULL, 0x0000201022000000ULL, 0x0000209002000000ULL, 0x0000209022000000ULL,
+        0x0000A01002000000ULL, 0x0000A01022000000ULL, 0x0000A09002000000ULL, 0x0000A09022000000ULL,
+        0x0000201200000000ULL, 0x0000201220000000ULL, 0x0000209200000000ULL, 0x0000209220000000ULL,
+        0x0000A01200000000ULL, 0x0000A01220000000ULL, 0x0000A09200000000ULL, 0x0000A09220000000ULL,
+        0x0000201202000000ULL, 0x0000201222000000ULL, 0x0000209202000000ULL, 0x0000209222000000ULL,
+        0x0000A01202000000ULL, 0x0000A01222000000ULL, 0x0000A09202000000ULL, 0x0000A09222000000ULL,
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000008000000000ULL, 0x0000008020000000ULL,
+        0x0000800000000000ULL, 0x0000800020000000ULL, 0x0000808000000000ULL, 0x0000808020000000ULL,
+        0x0000000002000000ULL, 0x0000000022000000ULL, 0x0000008002000000ULL, 0x0000008022000000ULL,
+        0x0000800002000000ULL, 0x0000800022000000ULL, 0x0000808002000000ULL, 0x0000808022000000ULL,
+        0x0000000200000000ULL, 0x0000000220000000ULL, 0x0000008200000000ULL, 0x0000008220000000ULL,
+        0x0000800200000000ULL, 0x0000800220000000ULL, 0x0000808200000000ULL, 0x0000808220000000ULL,
+        0x0000000202000000ULL, 0x0000000222000000ULL, 0x0000008202000000ULL, 0x0000008222000000ULL,
+        0x0000800202000000ULL, 0x0000800222000000ULL, 0x0000808202000000ULL, 0x0000808222000000ULL,
+        0x0000200000000000ULL, 0x0000200020000000ULL, 0x0000208000000000ULL, 0x0000208020000000ULL,
+        0x0000A00000000000ULL, 0x0000A00020000000ULL, 0x0000A08000000000ULL, 0x0000A08020000000ULL,
+        0x0000200002000000ULL, 0x0000200022000000ULL, 0x0000208002000000ULL, 0x0000208022000000ULL,
+        0x0000A00002000000ULL, 0x0000A00022000000ULL, 0x0000A08002000000ULL, 0x0000A08022000000ULL,
+        0x0000200200000000ULL, 0x0000200220000000ULL, 0x0000208200000000ULL, 0x0000208220000000ULL,
+        0x0000A00200000000ULL, 0x0000A00220000000ULL, 0x0000A08200000000ULL, 0x0000A08220000000ULL,
+        0x0000200202000000ULL, 0x0000200222000000ULL, 0x0000208202000000ULL, 0x0000208222000000ULL,
+        0x0000A00202000000ULL, 0x0000A00222000000ULL, 0x0000A08202000000ULL, 0x0000A08222000000ULL,
+        0x0000001000000000ULL, 0x0000001020000000ULL, 0x0000009000000000ULL, 0x0000009020000000ULL,
+        0x0000801000000000ULL, 0x0000801020000000ULL, 0x0000809000000000ULL, 0x0000809020000000ULL,
+        0x0000001002000000ULL, 0x0000001022000000ULL, 0x0000009002000000ULL, 0x0000009022000000ULL,
+        0x0000801002000000ULL, 0x0000801022000000ULL, 0x0000809002000000ULL, 0x0000809022000000ULL,
+        0x0000001200000000ULL, 0x0000001220000000ULL, 0x0000009200000000ULL, 0x0000009220000000ULL,
+        0x0000801200000000ULL, 0x0000801220000000ULL, 0x0000809200000000ULL, 0x0000809220000000ULL,
+        0x0000001202000000ULL, 0x0000001222000000ULL, 0x0000009202000000ULL, 0x0000009222000000ULL,
+        0x0000801202000000ULL, 0x0000801222000000ULL, 0x0000809202000000ULL, 0x0000809222000000ULL,
+        0x0000201000000000ULL, 0x0000201020000000ULL, 0x0000209000000000ULL, 0x0000209020000000ULL,
+        0x0000A01000000000ULL, 0x0000A01020000000ULL, 0x0000A09000000000ULL, 0x0000A09020000000ULL,
+        0x0000201002000000ULL, 0x0000201022000000ULL, 0x0000209002000000ULL, 0x0000209022000000ULL,
+        0x0000A01002000000ULL, 0x0000A01022000000ULL, 0x0000A09002000000ULL, 0x0000A09022000000ULL,
+        0x0000201200000000ULL, 0x0000201220000000ULL, 0x0000209200000000ULL, 0x0000209220000000ULL,
+        0x0000A01200000000ULL, 0x0000A01220000000ULL, 0x0000A09200000000ULL, 0x0000A09220000000ULL,
+        0x0000201202000000ULL, 0x0000201222000000ULL, 0x0000209202000000ULL, 0x0000209222000000ULL,
+        0x0000A01202000000ULL, 0x0000A01222000000ULL, 0x0000A09202000000ULL, 0x0000A09222000000ULL},
+    {
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000800000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000800000000ULL, 0x0000100800000000ULL,
+        0x0000002000000000ULL, 0x0000102000000000ULL, 0x0000002800000000ULL, 0x0000102800000000ULL,
+        0x0000002000000000ULL, 0x0000102000000000ULL, 0x0000002800000000ULL, 0x0000102800000000ULL,
+        0x0000000004000000ULL, 0x0000100004000000ULL, 0x0000000804000000ULL, 0x0000100804000000ULL,
+        0x0000000004000000ULL, 0x0000100004000000ULL, 0x0000000804000000ULL, 0x0000100804000000ULL,
+        0x0000002004000000ULL, 0x0000102004000000ULL, 0x0000002804000000ULL, 0x0000102804000000ULL,
+        0x0000002004000000ULL, 0x0000102004000000ULL, 0x0000002804000000ULL, 0x0000102804000000ULL,
+        0x0000000400000000ULL, 0x0000100400000000ULL, 0x0000000C00000000ULL, 0x0000100C00000000ULL,
+        0x0000000400000000ULL, 0x0000100400000000ULL, 0x0000000C00000000ULL, 0x0000100C00000000ULL,
+        0x0000002400000000ULL, 0x0000102400000000ULL, 0x0000002C00000000ULL, 0x0000102C00000000ULL,
+        0x0000002400000000ULL, 0x0000102400000000ULL, 0x0000002C00000000ULL, 0x0000102C00000000ULL,
+        0x0000000404000000ULL, 0x0000100404000000ULL, 0x0000000C04000000ULL, 0x0000100C04000000ULL,
+        0x0000000404000000ULL, 0x0000100404000000ULL, 0x0000000C04000000ULL, 0x0000100C04000000ULL,
+        0x0000002404000000ULL, 0x0000102404000000ULL, 0x0000002C04000000ULL, 0x0000102C04000000ULL,
+        0x0000002404000000ULL, 0x0000102404000000ULL, 0x0000002C04000000ULL, 0x0000102C04000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000800000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000800000000ULL, 0x0000100800000000ULL,
+        0x0000002000000000ULL, 0x0000102000000000ULL, 0x0000002800000000ULL, 0x0000102800000000ULL,
+        0x0000002000000000ULL, 0x0000102000000000ULL, 0x0000002800000000ULL, 0x0000102800000000ULL,
+        0x0000000004000000ULL, 0x0000100004000000ULL, 0x0000000804000000ULL, 0x0000100804000000ULL,
+        0x0000000004000000ULL, 0x0000100004000000ULL, 0x0000000804000000ULL, 0x0000100804000000ULL,
+        0x0000002004000000ULL, 0x0000102004000000ULL, 0x0000002804000000ULL, 0x0000102804000000ULL,
+        0x0000002004000000ULL, 0x0000102004000000ULL, 0x0000002804000000ULL, 0x0000102804000000ULL,
+        0x0000000400000000ULL, 0x0000100400000000ULL, 0x0000000C00000000ULL, 0x0000100C00000000ULL,
+        0x0000000400000000ULL, 0x0000100400000000ULL, 0x0000000C00000000ULL, 0x0000100C00000000ULL,
+        0x0000002400000000ULL, 0x0000102400000000ULL, 0x0000002C00000000ULL, 0x0000102C00000000ULL,
+        0x0000002400000000ULL, 0x0000102400000000ULL, 0x0000002C00000000ULL, 0x0000102C00000000ULL,
+        0x0000000404000000ULL, 0x0000100404000000ULL, 0x0000000C04000000ULL, 0x0000100C04000000ULL,
+        0x0000000404000000ULL, 0x0000100404000000ULL, 0x0000000C04000000ULL, 0x0000100C04000000ULL,
+        0x0000002404000000ULL, 0x0000102404000000ULL, 0x0000002C04000000ULL, 0x0000102C04000000ULL,
+        0x0000002404000000ULL, 0x0000102404000000ULL, 0x0000002C04000000ULL, 0x0000102C04000000ULL,
+        0x0000400000000000ULL, 0x0000500000000000ULL, 0x0000400800000000ULL, 0x0000500800000000ULL,
+        0x0000400000000000ULL, 0x0000500000000000ULL, 0x0000400800000000ULL, 0x0000500800000000ULL,
+        0x0000402000000000ULL, 0x0000502000000000ULL, 0x0000402800000000ULL, 0x0000502800000000ULL,
+        0x0000402000000000ULL, 0x0000502000000000ULL, 0x0000402800000000ULL, 0x0000502800000000ULL,
+        0x0000400004000000ULL, 0x0000500004000000ULL, 0x0000400804000000ULL, 0x0000500804000000ULL,
+        0x0000400004000000ULL, 0x0000500004000000ULL, 0x0000400804000000ULL, 0x0000500804000000ULL,
+        0x0000402004000000ULL, 0x0000502004000000ULL, 0x0000402804000000ULL, 0x0000502804000000ULL,
+        0x0000402004000000ULL, 0x0000502004000000ULL, 0x0000402804000000ULL, 0x0000502804000000ULL,
+        0x0000400400000000ULL, 0x0000500400000000ULL, 0x0000400C00000000ULL, 0x0000500C00000000ULL,
+        0x0000400400000000ULL, 0x0000500400000000ULL, 0x0000400C00000000ULL, 0x0000500C00000000ULL,
+        0x0000402400000000ULL, 0x0000502400000000ULL, 0x0000402C00000000ULL, 0x0000502C00000000ULL,
+        0x0000402400000000ULL, 0x0000502400000000ULL, 0x0000402C00000000ULL, 0x0000502C00000000ULL,
+        0x0000400404000000ULL, 0x0000500404000000ULL, 0x0000400C04000000ULL, 0x0000500C04000000ULL,
+        0x0000400404000000ULL, 0x0000500404000000ULL, 0x0000400C04000000ULL, 0x0000500C04000000ULL,
+        0x0000402404000000ULL, 0x0000502404000000ULL, 0x0000402C04000000ULL, 0x0000502C04000000ULL,
+        0x0000402404000000ULL, 0x0000502404000000ULL, 0x0000402C04000000ULL, 0x0000502C04000000ULL,
+        0x0000400000000000ULL, 0x0000500000000000ULL, 0x0000400800000000ULL, 0x0000500800000000ULL,
+        0x0000400000000000ULL, 0x0000500000000000ULL, 0x0000400800000000ULL, 0x0000500800000000ULL,
+        0x0000402000000000ULL, 0x0000502000000000ULL, 0x0000402800000000ULL, 0x0000502800000000ULL,
+        0x0000402000000000ULL, 0x0000502000000000ULL, 0x0000402800000000ULL, 0x0000502800000000ULL,
+        0x0000400004000000ULL, 0x0000500004000000ULL, 0x0000400804000000ULL, 0x0000500804000000ULL,
+        0x0000400004000000ULL, 0x0000500004000000ULL, 0x0000400804000000ULL, 0x0000500804000000ULL,
+        0x0000402004000000ULL, 0x0000502004000000ULL, 0x0000402804000000ULL, 0x0000502804000000ULL,
+        0x0000402004000000ULL, 0x0000502004000000ULL, 0x0000402804000000ULL, 0x0000502804000000ULL,
+        0x0000400400000000ULL, 0x0000500400000000ULL, 0x0000400C00000000ULL, 0x0000500C00000000ULL,
+        0x0000400400000000ULL, 0x0000500400000000ULL, 0x0000400C00000000ULL, 0x0000500C00000000ULL,
+        0x0000402400000000ULL, 0x0000502400000000ULL, 0x0000402C00000000ULL, 0x0000502C00000000ULL,
+        0x0000402400000000ULL, 0x0000502400000000ULL, 0x0000402C00000000ULL, 0x0000502C00000000ULL,
+        0x0000400404000000ULL, 0x0000500404000000ULL, 0x0000400C04000000ULL, 0x0000500C04000000ULL,
+        0x0000400404000000ULL, 0x0000500404000000ULL, 0x0000400C04000000ULL, 0x0000500C04000000ULL,
+        0x0000402404000000ULL, 0x0000502404000000ULL, 0x0000402C04000000ULL, 0x0000502C04000000ULL,
+        0x0000402404000000ULL, 0x0000502404000000ULL, 0x0000402C04000000ULL, 0x0000502C04000000ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000200000ULL, 0x0000000000200001ULL,
+        0x0000000000020000ULL, 0x0000000000020001ULL, 0x0000000000220000ULL, 0x0000000000220001ULL,
+        0x0000000000000002ULL, 0x0000000000000003ULL, 0x0000000000200002ULL, 0x0000000000200003ULL,
+        0x0000000000020002ULL, 0x0000000000020003ULL, 0x0000000000220002ULL, 0x0000000000220003ULL,
+        0x0000010000000000ULL, 0x0000010000000001ULL, 0x0000010000200000ULL, 0x0000010000200001ULL,
+        0x0000010000020000ULL, 0x0000010000020001ULL, 0x0000010000220000ULL, 0x0000010000220001ULL,
+        0x0000010000000002ULL, 0x0000010000000003ULL, 0x0000010000200002ULL, 0x0000010000200003ULL,
+        0x0000010000020002ULL, 0x0000010000020003ULL, 0x0000010000220002ULL, 0x0000010000220003ULL,
+        0x0000000008000000ULL, 0x0000000008000001ULL, 0x0000000008200000ULL, 0x0000000008200001ULL,
+        0x0000000008020000ULL, 0x0000000008020001ULL, 0x0000000008220000ULL, 0x0000000008220001ULL,
+        0x0000000008000002ULL, 0x0000000008000003ULL, 0x0000000008200002ULL, 0x0000000008200003ULL,
+        0x0000000008020002ULL, 0x0000000008020003ULL, 0x0000000008220002ULL, 0x0000000008220003ULL,
+        0x0000010008000000ULL, 0x0000010008000001ULL, 0x0000010008200000ULL, 0x0000010008200001ULL,
+        0x0000010008020000ULL, 0x0000010008020001ULL, 0x0000010008220000ULL, 0x0000010008220001ULL,
+        0x0000010008000002ULL, 0x0000010008000003ULL, 0x0000010008200002ULL, 0x0000010008200003ULL,
+        0x0000010008020002ULL, 0x0000010008020003ULL, 0x0000010008220002ULL, 0x0000010008220003ULL,
+        0x0000000080000000ULL, 0x0000000080000001ULL, 0x0000000080200000ULL, 0x0000000080200001ULL,
+        0x0000000080020000ULL, 0x0000000080020001ULL, 0x0000000080220000ULL, 0x0000000080220001ULL,
+        0x0000000080000002ULL, 0x0000000080000003ULL, 0x0000000080200002ULL, 0x0000000080200003ULL,
+        0x0000000080020002ULL, 0x0000000080020003ULL, 0x0000000080220002ULL, 0x0000000080220003ULL,
+        0x0000010080000000ULL, 0x0000010080000001ULL, 0x0000010080200000ULL, 0x0000010080200001ULL,
+        0x0000010080020000ULL, 0x0000010080020001ULL, 0x0000010080220000ULL, 0x0000010080220001ULL,
+        0x0000010080000002ULL, 0x0000010080000003ULL, 0x0000010080200002ULL, 0x0000010080200003ULL,
+        0x0000010080020002ULL, 0x0000010080020003ULL, 0x0000010080220002ULL, 0x0000010080220003ULL,
+        0x0000000088000000ULL, 0x0000000088000001ULL, 0x0000000088200000ULL, 0x0000000088200001ULL,
+        0x0000000088020000ULL, 0x0000000088020001ULL, 0x0000000088220000ULL, 0x0000000088220001ULL,
+        0x0000000088000002ULL, 0x0000000088000003ULL, 0x0000000088200002ULL, 0x0000000088200003ULL,
+        0x0000000088020002ULL, 0x0000000088020003ULL, 0x0000000088220002ULL, 0x0000000088220003ULL,
+        0x0000010088000000ULL, 0x0000010088000001ULL, 0x0000010088200000ULL, 0x0000010088200001ULL,
+        0x0000010088020000ULL, 0x0000010088020001ULL, 0x0000010088220000ULL, 0x0000010088220001ULL,
+        0x0000010088000002ULL, 0x0000010088000003ULL, 0x0000010088200002ULL, 0x0000010088200003ULL,
+        0x0000010088020002ULL, 0x0000010088020003ULL, 0x0000010088220002ULL, 0x0000010088220003ULL,
+        0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000200000ULL, 0x0000000000200001ULL,
+        0x0000000000020000ULL, 0x0000000000020001ULL, 0x0000000000220000ULL, 0x0000000000220001ULL,
+        0x0000000000000002ULL, 0x0000000000000003ULL, 0x0000000000200002ULL, 0x0000000000200003ULL,
+        0x0000000000020002ULL, 0x0000000000020003ULL, 0x0000000000220002ULL, 0x0000000000220003ULL,
+        0x0000010000000000ULL, 0x0000010000000001ULL, 0x0000010000200000ULL, 0x0000010000200001ULL,
+        0x0000010000020000ULL, 0x0000010000020001ULL, 0x0000010000220000ULL, 0x0000010000220001ULL,
+        0x0000010000000002ULL, 0x0000010000000003ULL, 0x0000010000200002ULL, 0x0000010000200003ULL,
+        0x0000010000020002ULL, 0x0000010000020003ULL, 0x0000010000220002ULL, 0x0000010000220003ULL,
+        0x0000000008000000ULL, 0x0000000008000001ULL, 0x0000000008200000ULL, 0x0000000008200001ULL,
+        0x0000000008020000ULL, 0x0000000008020001ULL, 0x0000000008220000ULL, 0x0000000008220001ULL,
+        0x0000000008000002ULL, 0x0000000008000003ULL, 0x0000000008200002ULL, 0x0000000008200003ULL,
+        0x0000000008020002ULL, 0x0000000008020003ULL, 0x0000000008220002ULL, 0x0000000008220003ULL,
+        0x0000010008000000ULL, 0x0000010008000001ULL, 0x0000010008200000ULL, 0x0000010008200001ULL,
+        0x0000010008020000ULL, 0x0000010008020001ULL, 0x0000010008220000ULL, 0x0000010008220001ULL,
+        0x0000010008000002ULL, 0x0000010008000003ULL, 0x0000010008200002ULL, 0x0000010008200003ULL,
+        0x0000010008020002ULL, 0x0000010008020003ULL, 0x0000010008220002ULL, 0x0000010008220003ULL,
+        0x0000000080000000ULL, 0x0000000080000001ULL, 0x0000000080200000ULL, 0x0000000080200001ULL,
+        0x0000000080020000ULL, 0x0000000080020001ULL, 0x0000000080220000ULL, 0x0000000080220001ULL,
+        0x0000000080000002ULL, 0x0000000080000003ULL, 0x0000000080200002ULL, 0x0000000080200003ULL,
+        0x0000000080020002ULL, 0x0000000080020003ULL, 0x0000000080220002ULL, 0x0000000080220003ULL,
+        0x0000010080000000ULL, 0x0000010080000001ULL, 0x0000010080200000ULL, 0x0000010080200001ULL,
+        0x0000010080020000ULL, 0x0000010080020001ULL, 0x0000010080220000ULL, 0x0000010080220001ULL,
+        0x0000010080000002ULL, 0x0000010080000003ULL, 0x0000010080200002ULL, 0x0000010080200003ULL,
+        0x0000010080020002ULL, 0x0000010080020003ULL, 0x0000010080220002ULL, 0x0000010080220003ULL,
+        0x0000000088000000ULL, 0x0000000088000001ULL, 0x0000000088200000ULL, 0x0000000088200001ULL,
+        0x0000000088020000ULL, 0x0000000088020001ULL, 0x0000000088220000ULL, 0x0000000088220001ULL,
+        0x0000000088000002ULL, 0x0000000088000003ULL, 0x0000000088200002ULL, 0x0000000088200003ULL,
+        0x0000000088020002ULL, 0x0000000088020003ULL, 0x0000000088220002ULL, 0x0000000088220003ULL,
+        0x0000010088000000ULL, 0x0000010088000001ULL, 0x0000010088200000ULL, 0x0000010088200001ULL,
+        0x0000010088020000ULL, 0x0000010088020001ULL, 0x0000010088220000ULL, 0x0000010088220001ULL,
+        0x0000010088000002ULL, 0x0000010088000003ULL, 0x0000010088200002ULL, 0x0000010088200003ULL,
+        0x0000010088020002ULL, 0x0000010088020003ULL, 0x0000010088220002ULL, 0x0000010088220003ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000200ULL, 0x0000000000010200ULL,
+        0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000200ULL, 0x0000000000010200ULL,
+        0x0000000000100000ULL, 0x0000000000110000ULL, 0x0000000000100200ULL, 0x0000000000110200ULL,
+        0x0000000000100000ULL, 0x0000000000110000ULL, 0x0000000000100200ULL, 0x0000000000110200ULL,
+        0x0000000000000004ULL, 0x0000000000010004ULL, 0x0000000000000204ULL, 0x0000000000010204ULL,
+        0x0000000000000004ULL, 0x0000000000010004ULL, 0x0000000000000204ULL, 0x0000000000010204ULL,
+        0x0000000000100004ULL, 0x0000000000110004ULL, 0x0000000000100204ULL, 0x0000000000110204ULL,
+        0x0000000000100004ULL, 0x0000000000110004ULL, 0x0000000000100204ULL, 0x0000000000110204ULL,
+        0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000200ULL, 0x0000000000010200ULL,
+        0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000200ULL, 0x0000000000010200ULL,
+        0x0000000000100000ULL, 0x0000000000110000ULL, 0x0000000000100200ULL, 0x0000000000110200ULL,
+        0x0000000000100000ULL, 0x0000000000110000ULL, 0x0000000000100200ULL, 0x0000000000110200ULL,
+        0x0000000000000004ULL, 0x0000000000010004ULL, 0x0000000000000204ULL, 0x0000000000010204ULL,
+        0x0000000000000004ULL, 0x0000000000010004ULL, 0x0000000000000204ULL, 0x0000000000010204ULL,
+        0x0000000000100004ULL, 0x0000000000110004ULL, 0x0000000000100204ULL, 0x0000000000110204ULL,
+        0x0000000000100004ULL, 0x0000000000110004ULL, 0x0000000000100204ULL, 0x0000000000110204ULL,
+        0x0000000000000080ULL, 0x0000000000010080ULL, 0x0000000000000280ULL, 0x0000000000010280ULL,
+        0x0000000000000080ULL, 0x0000000000010080ULL, 0x0000000000000280ULL, 0x0000000000010280ULL,
+        0x0000000000100080ULL, 0x0000000000110080ULL, 0x0000000000100280ULL, 0x0000000000110280ULL,
+        0x0000000000100080ULL, 0x0000000000110080ULL, 0x0000000000100280ULL, 0x0000000000110280ULL,
+        0x0000000000000084ULL, 0x0000000000010084ULL, 0x0000000000000284ULL, 0x0000000000010284ULL,
+        0x0000000000000084ULL, 0x0000000000010084ULL, 0x0000000000000284ULL, 0x0000000000010284ULL,
+        0x0000000000100084ULL, 0x0000000000110084ULL, 0x0000000000100284ULL, 0x0000000000110284ULL,
+        0x0000000000100084ULL, 0x0000000000110084ULL, 0x0000000000100284ULL, 0x0000000000110284ULL,
+        0x0000000000000080ULL, 0x0000000000010080ULL, 0x0000000000000280ULL, 0x0000000000010280ULL,
+        0x0000000000000080ULL, 0x0000000000010080ULL, 0x0000000000000280ULL, 0x0000000000010280ULL,
+        0x0000000000100080ULL, 0x0000000000110080ULL, 0x0000000000100280ULL, 0x0000000000110280ULL,
+        0x0000000000100080ULL, 0x0000000000110080ULL, 0x0000000000100280ULL, 0x0000000000110280ULL,
+        0x0000000000000084ULL, 0x0000000000010084ULL, 0x0000000000000284ULL, 0x0000000000010284ULL,
+        0x0000000000000084ULL, 0x0000000000010084ULL, 0x0000000000000284ULL, 0x0000000000010284ULL,
+        0x0000000000100084ULL, 0x0000000000110084ULL, 0x0000000000100284ULL, 0x0000000000110284ULL,
+        0x0000000000100084ULL, 0x0000000000110084ULL, 0x0000000000100284ULL, 0x0000000000110284ULL,
+        0x0000000000002000ULL, 0x0000000000012000ULL, 0x0000000000002200ULL, 0x0000000000012200ULL,
+        0x0000000000002000ULL, 0x0000000000012000ULL, 0x0000000000002200ULL, 0x0000000000012200ULL,
+        0x0000000000102000ULL, 0x0000000000112000ULL, 0x0000000000102200ULL, 0x0000000000112200ULL,
+        0x0000000000102000ULL, 0x0000000000112000ULL, 0x0000000000102200ULL, 0x0000000000112200ULL,
+        0x0000000000002004ULL, 0x0000000000012004ULL, 0x0000000000002204ULL, 0x0000000000012204ULL,
+        0x0000000000002004ULL, 0x0000000000012004ULL, 0x0000000000002204ULL, 0x0000000000012204ULL,
+        0x0000000000102004ULL, 0x0000000000112004ULL, 0x0000000000102204ULL, 0x0000000000112204ULL,
+        0x0000000000102004ULL, 0x0000000000112004ULL, 0x0000000000102204ULL, 0x0000000000112204ULL,
+        0x0000000000002000ULL, 0x0000000000012000ULL, 0x0000000000002200ULL, 0x0000000000012200ULL,
+        0x0000000000002000ULL, 0x0000000000012000ULL, 0x0000000000002200ULL, 0x0000000000012200ULL,
+        0x0000000000102000ULL, 0x0000000000112000ULL, 0x0000000000102200ULL, 0x0000000000112200ULL,
+        0x0000000000102000ULL, 0x0000000000112000ULL, 0x0000000000102200ULL, 0x0000000000112200ULL,
+        0x0000000000002004ULL, 0x0000000000012004ULL, 0x0000000000002204ULL, 0x0000000000012204ULL,
+        0x0000000000002004ULL, 0x0000000000012004ULL, 0x0000000000002204ULL, 0x0000000000012204ULL,
+        0x0000000000102004ULL, 0x0000000000112004ULL, 0x0000000000102204ULL, 0x0000000000112204ULL,
+        0x0000000000102004ULL, 0x0000000000112004ULL, 0x0000000000102204ULL, 0x0000000000112204ULL,
+        0x0000000000002080ULL, 0x0000000000012080ULL, 0x0000000000002280ULL, 0x0000000000012280ULL,
+        0x0000000000002080ULL, 0x0000000000012080ULL, 0x0000000000002280ULL, 0x0000000000012280ULL,
+        0x0000000000102080ULL, 0x0000000000112080ULL, 0x0000000000102280ULL, 0x0000000000112280ULL,
+        0x0000000000102080ULL, 0x0000000000112080ULL, 0x0000000000102280ULL, 0x0000000000112280ULL,
+        0x0000000000002084ULL, 0x0000000000012084ULL, 0x0000000000002284ULL, 0x0000000000012284ULL,
+        0x0000000000002084ULL, 0x0000000000012084ULL, 0x0000000000002284ULL, 0x0000000000012284ULL,
+        0x0000000000102084ULL, 0x0000000000112084ULL, 0x0000000000102284ULL, 0x0000000000112284ULL,
+        0x0000000000102084ULL, 0x0000000000112084ULL, 0x0000000000102284ULL, 0x0000000000112284ULL,
+        0x0000000000002080ULL, 0x0000000000012080ULL, 0x0000000000002280ULL, 0x0000000000012280ULL,
+        0x0000000000002080ULL, 0x0000000000012080ULL, 0x0000000000002280ULL, 0x0000000000012280ULL,
+        0x0000000000102080ULL, 0x0000000000112080ULL, 0x0000000000102280ULL, 0x0000000000112280ULL,
+        0x0000000000102080ULL, 0x0000000000112080ULL, 0x0000000000102280ULL, 0x0000000000112280ULL,
+        0x0000000000002084ULL, 0x0000000000012084ULL, 0x0000000000002284ULL, 0x0000000000012284ULL,
+        0x0000000000002084ULL, 0x0000000000012084ULL, 0x0000000000002284ULL, 0x0000000000012284ULL,
+        0x0000000000102084ULL, 0x0000000000112084ULL, 0x0000000000102284ULL, 0x0000000000112284ULL,
+        0x0000000000102084ULL, 0x0000000000112084ULL, 0x0000000000102284ULL, 0x0000000000112284ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000080000ULL, 0x0000000000081000ULL,
+        0x0000000000000020ULL, 0x0000000000001020ULL, 0x0000000000080020ULL, 0x0000000000081020ULL,
+        0x0000000000004000ULL, 0x0000000000005000ULL, 0x0000000000084000ULL, 0x0000000000085000ULL,
+        0x0000000000004020ULL, 0x0000000000005020ULL, 0x0000000000084020ULL, 0x0000000000085020ULL,
+        0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000080800ULL, 0x0000000000081800ULL,
+        0x0000000000000820ULL, 0x0000000000001820ULL, 0x0000000000080820ULL, 0x0000000000081820ULL,
+        0x0000000000004800ULL, 0x0000000000005800ULL, 0x0000000000084800ULL, 0x0000000000085800ULL,
+        0x0000000000004820ULL, 0x0000000000005820ULL, 0x0000000000084820ULL, 0x0000000000085820ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000080000ULL, 0x0000000000081000ULL,
+        0x0000000000000020ULL, 0x0000000000001020ULL, 0x0000000000080020ULL, 0x0000000000081020ULL,
+        0x0000000000004000ULL, 0x0000000000005000ULL, 0x0000000000084000ULL, 0x0000000000085000ULL,
+        0x0000000000004020ULL, 0x0000000000005020ULL, 0x0000000000084020ULL, 0x0000000000085020ULL,
+        0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000080800ULL, 0x0000000000081800ULL,
+        0x0000000000000820ULL, 0x0000000000001820ULL, 0x0000000000080820ULL, 0x0000000000081820ULL,
+        0x0000000000004800ULL, 0x0000000000005800ULL, 0x0000000000084800ULL, 0x0000000000085800ULL,
+        0x0000000000004820ULL, 0x0000000000005820ULL, 0x0000000000084820ULL, 0x0000000000085820ULL,
+        0x0000000000000010ULL, 0x0000000000001010ULL, 0x0000000000080010ULL, 0x0000000000081010ULL,
+        0x0000000000000030ULL, 0x0000000000001030ULL, 0x0000000000080030ULL, 0x0000000000081030ULL,
+        0x0000000000004010ULL, 0x0000000000005010ULL, 0x0000000000084010ULL, 0x0000000000085010ULL,
+        0x0000000000004030ULL, 0x0000000000005030ULL, 0x0000000000084030ULL, 0x0000000000085030ULL,
+        0x0000000000000810ULL, 0x0000000000001810ULL, 0x0000000000080810ULL, 0x0000000000081810ULL,
+        0x0000000000000830ULL, 0x0000000000001830ULL, 0x0000000000080830ULL, 0x0000000000081830ULL,
+        0x0000000000004810ULL, 0x0000000000005810ULL, 0x0000000000084810ULL, 0x0000000000085810ULL,
+        0x0000000000004830ULL, 0x0000000000005830ULL, 0x0000000000084830ULL, 0x0000000000085830ULL,
+        0x0000000000000010ULL, 0x0000000000001010ULL, 0x0000000000080010ULL, 0x0000000000081010ULL,
+        0x0000000000000030ULL, 0x0000000000001030ULL, 0x0000000000080030ULL, 0x0000000000081030ULL,
+        0x0000000000004010ULL, 0x0000000000005010ULL, 0x0000000000084010ULL, 0x0000000000085010ULL,
+        0x0000000000004030ULL, 0x0000000000005030ULL, 0x0000000000084030ULL, 0x0000000000085030ULL,
+        0x0000000000000810ULL, 0x0000000000001810ULL, 0x0000000000080810ULL, 0x0000000000081810ULL,
+        0x0000000000000830ULL, 0x0000000000001830ULL, 0x0000000000080830ULL, 0x0000000000081830ULL,
+        0x0000000000004810ULL, 0x0000000000005810ULL, 0x0000000000084810ULL, 0x0000000000085810ULL,
+        0x0000000000004830ULL, 0x0000000000005830ULL, 0x0000000000084830ULL, 0x0000000000085830ULL,
+        0x0000000000800000ULL, 0x0000000000801000ULL, 0x0000000000880000ULL, 0x0000000000881000ULL,
+        0x0000000000800020ULL, 0x0000000000801020ULL, 0x0000000000880020ULL, 0x0000000000881020ULL,
+        0x0000000000804000ULL, 0x0000000000805000ULL, 0x0000000000884000ULL, 0x0000000000885000ULL,
+        0x0000000000804020ULL, 0x0000000000805020ULL, 0x0000000000884020ULL, 0x0000000000885020ULL,
+        0x0000000000800800ULL, 0x0000000000801800ULL, 0x0000000000880800ULL, 0x0000000000881800ULL,
+        0x0000000000800820ULL, 0x0000000000801820ULL, 0x0000000000880820ULL, 0x0000000000881820ULL,
+        0x0000000000804800ULL, 0x0000000000805800ULL, 0x0000000000884800ULL, 0x0000000000885800ULL,
+        0x0000000000804820ULL, 0x0000000000805820ULL, 0x0000000000884820ULL, 0x0000000000885820ULL,
+        0x0000000000800000ULL, 0x0000000000801000ULL, 0x0000000000880000ULL, 0x0000000000881000ULL,
+        0x0000000000800020ULL, 0x0000000000801020ULL, 0x0000000000880020ULL, 0x0000000000881020ULL,
+        0x0000000000804000ULL, 0x0000000000805000ULL, 0x0000000000884000ULL, 0x0000000000885000ULL,
+        0x0000000000804020ULL, 0x0000000000805020ULL, 0x0000000000884020ULL, 0x0000000000885020ULL,
+        0x0000000000800800ULL, 0x0000000000801800ULL, 0x0000000000880800ULL, 0x0000000000881800ULL,
+        0x0000000000800820ULL, 0x0000000000801820ULL, 0x0000000000880820ULL, 0x0000000000881820ULL,
+        0x0000000000804800ULL, 0x0000000000805800ULL, 0x0000000000884800ULL, 0x0000000000885800ULL,
+        0x0000000000804820ULL, 0x0000000000805820ULL, 0x0000000000884820ULL, 0x0000000000885820ULL,
+        0x0000000000800010ULL, 0x0000000000801010ULL, 0x0000000000880010ULL, 0x0000000000881010ULL,
+        0x0000000000800030ULL, 0x0000000000801030ULL, 0x0000000000880030ULL, 0x0000000000881030ULL,
+        0x0000000000804010ULL, 0x0000000000805010ULL, 0x0000000000884010ULL, 0x0000000000885010ULL,
+        0x0000000000804030ULL, 0x0000000000805030ULL, 0x0000000000884030ULL, 0x0000000000885030ULL,
+        0x0000000000800810ULL, 0x0000000000801810ULL, 0x0000000000880810ULL, 0x0000000000881810ULL,
+        0x0000000000800830ULL, 0x0000000000801830ULL, 0x0000000000880830ULL, 0x0000000000881830ULL,
+        0x0000000000804810ULL, 0x0000000000805810ULL, 0x0000000000884810ULL, 0x0000000000885810ULL,
+        0x0000000000804830ULL, 0x0000000000805830ULL, 0x0000000000884830ULL, 0x0000000000885830ULL,
+        0x0000000000800010ULL, 0x0000000000801010ULL, 0x0000000000880010ULL, 0x0000000000881010ULL,
+        0x0000000000800030ULL, 0x0000000000801030ULL, 0x0000000000880030ULL, 0x0000000000881030ULL,
+        0x0000000000804010ULL, 0x0000000000805010ULL, 0x0000000000884010ULL, 0x0000000000885010ULL,
+        0x0000000000804030ULL, 0x0000000000805030ULL, 0x0000000000884030ULL, 0x0000000000885030ULL,
+        0x0000000000800810ULL, 0x0000000000801810ULL, 0x0000000000880810ULL, 0x0000000000881810ULL,
+        0x0000000000800830ULL, 0x0000000000801830ULL, 0x0000000000880830ULL, 0x0000000000881830ULL,
+        0x0000000000804810ULL, 0x0000000000805810ULL, 0x0000000000884810ULL, 0x0000000000885810ULL,
+        0x0000000000804830ULL, 0x0000000000805830ULL, 0x0000000000884830ULL, 0x0000000000885830ULL},
+    {
+        0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000040000ULL, 0x0000000000040100ULL,
+        0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000040000ULL, 0x0000000000040100ULL,
+        0x0000000000000040ULL, 0x0000000000000140ULL, 0x0000000000040040ULL, 0x0000000000040140ULL,
+        0x0000000000000040ULL, 0x0000000000000140ULL, 0x0000000000040040ULL, 0x0000000000040140ULL,
+        0x0000000000400000ULL, 0x0000000000400100ULL, 0x0000000000440000ULL, 0x0000000000440100ULL,
+        0x0000000000400000ULL, 0x0000000000400100ULL, 0x0000000000440000ULL, 0x0000000000440100ULL,
+        0x0000000000400040ULL, 0x0000000000400140ULL, 0x0000000000440040ULL, 0x0000000000440140ULL,
+        0x0000000000400040ULL, 0x0000000000400140ULL, 0x0000000000440040ULL, 0x0000000000440140ULL,
+        0x0000000000008000ULL, 0x0000000000008100ULL, 0x0000000000048000ULL, 0x0000000000048100ULL,
+        0x0000000000008000ULL, 0x0000000000008100ULL, 0x0000000000048000ULL, 0x0000000000048100ULL,
+        0x0000000000008040ULL, 0x0000000000008140ULL, 0x0000000000048040ULL, 0x0000000000048140ULL,
+        0x0000000000008040ULL, 0x0000000000008140ULL, 0x0000000000048040ULL, 0x0000000000048140ULL,
+        0x0000000000408000ULL, 0x0000000000408100ULL, 0x0000000000448000ULL, 0x0000000000448100ULL,
+        0x0000000000408000ULL, 0x0000000000408100ULL, 0x0000000000448000ULL, 0x0000000000448100ULL,
+        0x0000000000408040ULL, 0x0000000000408140ULL, 0x0000000000448040ULL, 0x0000000000448140ULL,
+        0x0000000000408040ULL, 0x0000000000408140ULL, 0x0000000000448040ULL, 0x0000000000448140ULL,
+        0x0000000000000008ULL, 0x0000000000000108ULL, 0x0000000000040008ULL, 0x0000000000040108ULL,
+        0x0000000000000008ULL, 0x0000000000000108ULL, 0x0000000000040008ULL, 0x0000000000040108ULL,
+        0x0000000000000048ULL, 0x0000000000000148ULL, 0x0000000000040048ULL, 0x0000000000040148ULL,
+        0x0000000000000048ULL, 0x0000000000000148ULL, 0x0000000000040048ULL, 0x0000000000040148ULL,
+        0x0000000000400008ULL, 0x0000000000400108ULL, 0x0000000000440008ULL, 0x0000000000440108ULL,
+        0x0000000000400008ULL, 0x0000000000400108ULL, 0x0000000000440008ULL, 0x0000000000440108ULL,
+        0x0000000000400048ULL, 0x0000000000400148ULL, 0x0000000000440048ULL, 0x0000000000440148ULL,
+        0x0000000000400048ULL, 0x0000000000400148ULL, 0x0000000000440048ULL, 0x0000000000440148ULL,
+        0x0000000000008008ULL, 0x0000000000008108ULL, 0x0000000000048008ULL, 0x0000000000048108ULL,
+        0x0000000000008008ULL, 0x0000000000008108ULL, 0x0000000000048008ULL, 0x0000000000048108ULL,
+        0x0000000000008048ULL, 0x0000000000008148ULL, 0x0000000000048048ULL, 0x0000000000048148ULL,
+        0x0000000000008048ULL, 0x0000000000008148ULL, 0x0000000000048048ULL, 0x0000000000048148ULL,
+        0x0000000000408008ULL, 0x0000000000408108ULL, 0x0000000000448008ULL, 0x0000000000448108ULL,
+        0x0000000000408008ULL, 0x0000000000408108ULL, 0x0000000000448008ULL, 0x0000000000448108ULL,
+        0x0000000000408048ULL, 0x0000000000408148ULL, 0x0000000000448048ULL, 0x0000000000448148ULL,
+        0x0000000000408048ULL, 0x0000000000408148ULL, 0x0000000000448048ULL, 0x0000000000448148ULL,
+        0x0000000000000400ULL, 0x0000000000000500ULL, 0x0000000000040400ULL, 0x0000000000040500ULL,
+        0x0000000000000400ULL, 0x0000000000000500ULL, 0x0000000000040400ULL, 0x0000000000040500ULL,
+        0x0000000000000440ULL, 0x0000000000000540ULL, 0x0000000000040440ULL, 0x0000000000040540ULL,
+        0x0000000000000440ULL, 0x0000000000000540ULL, 0x0000000000040440ULL, 0x0000000000040540ULL,
+        0x0000000000400400ULL, 0x0000000000400500ULL, 0x0000000000440400ULL, 0x0000000000440500ULL,
+        0x0000000000400400ULL, 0x0000000000400500ULL, 0x0000000000440400ULL, 0x0000000000440500ULL,
+        0x0000000000400440ULL, 0x0000000000400540ULL, 0x0000000000440440ULL, 0x0000000000440540ULL,
+        0x0000000000400440ULL, 0x0000000000400540ULL, 0x0000000000440440ULL, 0x0000000000440540ULL,
+        0x0000000000008400ULL, 0x0000000000008500ULL, 0x0000000000048400ULL, 0x0000000000048500ULL,
+        0x0000000000008400ULL, 0x0000000000008500ULL, 0x0000000000048400ULL, 0x0000000000048500ULL,
+        0x0000000000008440ULL, 0x0000000000008540ULL, 0x0000000000048440ULL, 0x0000000000048540ULL,
+        0x0000000000008440ULL, 0x0000000000008540ULL, 0x0000000000048440ULL, 0x0000000000048540ULL,
+        0x0000000000408400ULL, 0x0000000000408500ULL, 0x0000000000448400ULL, 0x0000000000448500ULL,
+        0x0000000000408400ULL, 0x0000000000408500ULL, 0x0000000000448400ULL, 0x0000000000448500ULL,
+        0x0000000000408440ULL, 0x0000000000408540ULL, 0x0000000000448440ULL, 0x0000000000448540ULL,
+        0x0000000000408440ULL, 0x0000000000408540ULL, 0x0000000000448440ULL, 0x0000000000448540ULL,
+        0x0000000000000408ULL, 0x0000000000000508ULL, 0x0000000000040408ULL, 0x0000000000040508ULL,
+        0x0000000000000408ULL, 0x0000000000000508ULL, 0x0000000000040408ULL, 0x0000000000040508ULL,
+        0x0000000000000448ULL, 0x0000000000000548ULL, 0x0000000000040448ULL, 0x0000000000040548ULL,
+        0x0000000000000448ULL, 0x0000000000000548ULL, 0x0000000000040448ULL, 0x0000000000040548ULL,
+        0x0000000000400408ULL, 0x0000000000400508ULL, 0x0000000000440408ULL, 0x0000000000440508ULL,
+        0x0000000000400408ULL, 0x0000000000400508ULL, 0x0000000000440408ULL, 0x0000000000440508ULL,
+        0x0000000000400448ULL, 0x0000000000400548ULL, 0x0000000000440448ULL, 0x0000000000440548ULL,
+        0x0000000000400448ULL, 0x0000000000400548ULL, 0x0000000000440448ULL, 0x0000000000440548ULL,
+        0x0000000000008408ULL, 0x0000000000008508ULL, 0x0000000000048408ULL, 0x0000000000048508ULL,
+        0x0000000000008408ULL, 0x0000000000008508ULL, 0x0000000000048408ULL, 0x0000000000048508ULL,
+        0x0000000000008448ULL, 0x0000000000008548ULL, 0x0000000000048448ULL, 0x0000000000048548ULL,
+        0x0000000000008448ULL, 0x0000000000008548ULL, 0x0000000000048448ULL, 0x0000000000048548ULL,
+        0x0000000000408408ULL, 0x0000000000408508ULL, 0x0000000000448408ULL, 0x0000000000448508ULL,
+        0x0000000000408408ULL, 0x0000000000408508ULL, 0x0000000000448408ULL, 0x0000000000448508ULL,
+        0x0000000000408448ULL, 0x0000000000408548ULL, 0x0000000000448448ULL, 0x0000000000448548ULL,
+        0x0000000000408448ULL, 0x0000000000408548ULL, 0x0000000000448448ULL, 0x0000000000448548ULL}
+};
+
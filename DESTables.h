@@ -0,0 +1,19 @@
+#ifndef DES_TABLES_H
+#define DES_TABLES_H
+
+#include "DES.h"
+
+// 构建时由 gentables.c 生成的只读查表 (定义见 DESTables.c), 按缓存行对齐
+// 进程启动时无需任何初始化, 各进程共享同一份只读页面
+// 字节分组均从高位开始: 第0组为最高字节
+
+extern const BYTE DES_IP_TABLE[8][256];
+extern const BYTE DES_IP_INV_TABLE[8][256];
+extern const BYTE DES_E_TABLE[4][256];
+extern const unsigned int DES_SP_TABLE[8][64];
+extern const unsigned char DES_SBOX_TABLE[8][64];
+extern const unsigned int DES_P4_TABLE[8][16];
+extern const BYTE DES_PC1_TABLE[8][256];
+extern const BYTE DES_PC2_TABLE[7][256];
+
+#endif // DES_TABLES_H
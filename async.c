@@ -0,0 +1,431 @@
+#include "async.h"
+#include "workMode.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+struct AsyncJob
+{
+    AsyncRequest req;
+    DES des; // 绑定到请求的密钥编排与IV, 不取得所有权
+    AsyncPool *pool;
+    AsyncStatus status; // 在线程池的锁内修改, 锁外用原子操作读取
+    int cancel;         // 原子: 处理中请求取消
+    int refs;           // 原子: 调用者与线程池各一个引用
+    AsyncJob *next;     // 排队或完成队列中的下一个
+};
+
+struct AsyncPool
+{
+    pthread_mutex_t lock;
+    pthread_cond_t workAvailable;  // 有排队任务或正在关闭
+    pthread_cond_t spaceAvailable; // 有任务交付, 背压可能解除
+    pthread_cond_t jobFinished;    // 有任务结束, 唤醒 asyncWait
+    AsyncJob *pendingHead, *pendingTail;
+    AsyncJob *doneHead, *doneTail;
+    size_t outstandingJobs;  // 已提交未交付的任务数
+    size_t outstandingBytes; // 及其数据字节数
+    AsyncOptions opts;
+    int stopping; // 原子: asyncPoolDestroy 已开始
+    int refs;     // 原子: 创建者一个, 每个尚未释放的任务一个; 任务句柄在关闭后仍可安全使用
+    int notifyFd[2]; // 完成通知: eventfd 时两项相同; 其他平台为管道的读端与写端
+    int threadCount;
+    pthread_t threads[];
+};
+
+void asyncDefaults(AsyncOptions *opts)
+{
+    opts->threads = 0;
+    opts->maxJobs = 1024;
+    opts->maxBytes = 256u << 20;
+    opts->blockWhenFull = false;
+}
+
+static void closeNotifyFd(int fds[2]);
+
+// 释放线程池的一个引用, 最后一个引用释放时回收锁、描述符与内存
+static void poolUnref(AsyncPool *pool)
+{
+    if (__atomic_sub_fetch(&pool->refs, 1, __ATOMIC_ACQ_REL) != 0)
+        return;
+    closeNotifyFd(pool->notifyFd);
+    pthread_cond_destroy(&pool->workAvailable);
+    pthread_cond_destroy(&pool->spaceAvailable);
+    pthread_cond_destroy(&pool->jobFinished);
+    pthread_mutex_destroy(&pool->lock);
+    poolFree(pool);
+}
+
+static void jobUnref(AsyncJob *job)
+{
+    if (__atomic_sub_fetch(&job->refs, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        AsyncPool *pool = job->pool;
+        poolFree(job);
+        poolUnref(pool);
+    }
+}
+
+// 完成队列由空变为非空时发出通知, 变为空时清除; 两者都在锁内, 描述符可读当且仅当队列非空
+static void notifySet(AsyncPool *pool)
+{
+    uint64_t one = 1;
+    ssize_t n = write(pool->notifyFd[1], &one, sizeof(one));
+    (void)n; // 计数已非零或管道已满时写入失败, 描述符仍然可读
+}
+
+static void notifyClear(AsyncPool *pool)
+{
+    char buf[64];
+    while (read(pool->notifyFd[0], buf, sizeof(buf)) > 0)
+    {
+    }
+}
+
+// 任务交付完毕: 不再计入背压上限, 释放线程池的引用
+static void retireJob(AsyncPool *pool, AsyncJob *job)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->outstandingJobs--;
+    pool->outstandingBytes -= job->req.blocks * sizeof(BYTE);
+    pthread_cond_broadcast(&pool->spaceAvailable);
+    pthread_mutex_unlock(&pool->lock);
+    jobUnref(job);
+}
+
+// 任务结束: 设置最终状态后调用回调, 或放入完成队列. 调用时不持有锁
+static void finishJob(AsyncPool *pool, AsyncJob *job, AsyncStatus status)
+{
+    pthread_mutex_lock(&pool->lock);
+    __atomic_store_n(&job->status, status, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&pool->jobFinished);
+    // 关闭过程中不再放入完成队列, 直接交付
+    if (job->req.callback == NULL && !__atomic_load_n(&pool->stopping, __ATOMIC_RELAXED))
+    {
+        job->next = NULL;
+        if (pool->doneTail)
+            pool->doneTail->next = job;
+        else
+            pool->doneHead = job;
+        if (pool->doneHead == job)
+            notifySet(pool);
+        pool->doneTail = job;
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    if (job->req.callback)
+        job->req.callback(job, job->req.arg);
+    retireJob(pool, job);
+}
+
+// 分段处理, 每段之间检查取消请求与线程池关闭
+static AsyncStatus runJob(AsyncPool *pool, AsyncJob *job)
+{
+    const AsyncRequest *r = &job->req;
+    BYTE state = r->iv;
+    for (size_t off = 0; off < r->blocks; off += ASYNC_SLICE_BLOCKS)
+    {
+        if (__atomic_load_n(&job->cancel, __ATOMIC_RELAXED) || __atomic_load_n(&pool->stopping, __ATOMIC_RELAXED))
+            return ASYNC_CANCELLED;
+        size_t n = r->blocks - off < ASYNC_SLICE_BLOCKS ? r->blocks - off : ASYNC_SLICE_BLOCKS;
+        if (r->out != r->in)
+            memcpy(r->out + off, r->in + off, n * sizeof(BYTE));
+        int ok = r->decrypt ? DES_decryptInPlace(&job->des, r->out + off, n, r->mode, &state)
+                            : DES_encryptInPlace(&job->des, r->out + off, n, r->mode, &state);
+        if (!ok)
+            return ASYNC_FAILED;
+    }
+    return ASYNC_DONE;
+}
+
+static void *asyncWorker(void *arg)
+{
+    AsyncPool *pool = (AsyncPool *)arg;
+    for (;;)
+    {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->pendingHead && !__atomic_load_n(&pool->stopping, __ATOMIC_RELAXED))
+        {
+            pthread_cond_wait(&pool->workAvailable, &pool->lock);
+        }
+        AsyncJob *job = pool->pendingHead;
+        if (!job)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        pool->pendingHead = job->next;
+        if (!pool->pendingHead)
+            pool->pendingTail = NULL;
+        __atomic_store_n(&job->status, ASYNC_RUNNING, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&pool->lock);
+
+        finishJob(pool, job, runJob(pool, job));
+    }
+}
+
+static int openNotifyFd(int fds[2])
+{
+#ifdef __linux__
+    fds[0] = fds[1] = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    return fds[0] >= 0;
+#else
+    if (pipe(fds) != 0)
+        return 0;
+    for (int i = 0; i < 2; i++)
+    {
+        fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+        fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    return 1;
+#endif
+}
+
+static void closeNotifyFd(int fds[2])
+{
+    close(fds[0]);
+    if (fds[1] != fds[0])
+        close(fds[1]);
+}
+
+AsyncPool *asyncPoolCreate(const AsyncOptions *opts)
+{
+    AsyncOptions o;
+    if (opts)
+        o = *opts;
+    else
+        asyncDefaults(&o);
+    if (o.threads <= 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        o.threads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    AsyncPool *pool = (AsyncPool *)poolAlloc(sizeof(AsyncPool) + o.threads * sizeof(pthread_t));
+    if (!pool)
+        return NULL;
+    memset(pool, 0, sizeof(AsyncPool));
+    pool->opts = o;
+    pool->refs = 1;
+    if (!openNotifyFd(pool->notifyFd))
+    {
+        fprintf(stderr, "Error: Unable to create the completion notification descriptor\n");
+        poolFree(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workAvailable, NULL);
+    pthread_cond_init(&pool->spaceAvailable, NULL);
+    pthread_cond_init(&pool->jobFinished, NULL);
+    for (; pool->threadCount < o.threads; pool->threadCount++)
+    {
+        if (pthread_create(&pool->threads[pool->threadCount], NULL, asyncWorker, pool) != 0)
+            break;
+    }
+    // 部分线程创建失败时用已有的线程继续
+    if (pool->threadCount == 0)
+    {
+        fprintf(stderr, "Error: Unable to start async worker threads\n");
+        asyncPoolDestroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void asyncPoolDestroy(AsyncPool *pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    __atomic_store_n(&pool->stopping, 1, __ATOMIC_RELAXED);
+    AsyncJob *pending = pool->pendingHead;
+    AsyncJob *done = pool->doneHead;
+    // 摘下的任务在锁内就标记为已取消: 同时调用的 asyncCancel 不会再到已清空的排队队列中查找
+    for (AsyncJob *job = pending; job; job = job->next)
+    {
+        __atomic_store_n(&job->status, ASYNC_CANCELLED, __ATOMIC_RELEASE);
+    }
+    pool->pendingHead = pool->pendingTail = NULL;
+    pool->doneHead = pool->doneTail = NULL;
+    pthread_cond_broadcast(&pool->workAvailable);
+    pthread_cond_broadcast(&pool->spaceAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    while (pending)
+    {
+        AsyncJob *next = pending->next;
+        finishJob(pool, pending, ASYNC_CANCELLED);
+        pending = next;
+    }
+    // 正在处理的任务在当前分段结束后停止并直接交付
+    for (int i = 0; i < pool->threadCount; i++)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+    while (done)
+    {
+        AsyncJob *next = done->next;
+        retireJob(pool, done);
+        done = next;
+    }
+    // 调用者仍持有的任务句柄各占一个引用, 全部释放后才回收
+    poolUnref(pool);
+}
+
+int asyncPollFd(const AsyncPool *pool)
+{
+    return pool->notifyFd[0];
+}
+
+// 背压: 没有未交付的任务时总是接受, 否则两项上限都不能超过
+static bool overLimit(const AsyncPool *pool, size_t bytes)
+{
+    if (pool->outstandingJobs == 0)
+        return false;
+    return (pool->opts.maxJobs && pool->outstandingJobs >= pool->opts.maxJobs) ||
+           (pool->opts.maxBytes && pool->outstandingBytes + bytes > pool->opts.maxBytes);
+}
+
+AsyncJob *asyncSubmit(AsyncPool *pool, const AsyncRequest *req)
+{
+    if (!pool || !req || !req->des || !req->des->schedule || (req->blocks > 0 && (!req->in || !req->out)) ||
+        (req->mode != ECB && req->mode != CBC && req->mode != CFB && req->mode != OFB))
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+    AsyncJob *job = (AsyncJob *)poolAlloc(sizeof(AsyncJob));
+    if (!job)
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+    job->req = *req;
+    DES_bind(&job->des, req->des->schedule, req->iv);
+    job->pool = pool;
+    job->status = ASYNC_PENDING;
+    job->cancel = 0;
+    job->refs = 2;
+    job->next = NULL;
+
+    size_t bytes = req->blocks * sizeof(BYTE);
+    pthread_mutex_lock(&pool->lock);
+    while (!__atomic_load_n(&pool->stopping, __ATOMIC_RELAXED) && overLimit(pool, bytes))
+    {
+        if (!pool->opts.blockWhenFull)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            poolFree(job);
+            errno = EAGAIN;
+            return NULL;
+        }
+        pthread_cond_wait(&pool->spaceAvailable, &pool->lock);
+    }
+    if (__atomic_load_n(&pool->stopping, __ATOMIC_RELAXED))
+    {
+        pthread_mutex_unlock(&pool->lock);
+        poolFree(job);
+        errno = ECANCELED;
+        return NULL;
+    }
+    pool->outstandingJobs++;
+    pool->outstandingBytes += bytes;
+    __atomic_add_fetch(&pool->refs, 1, __ATOMIC_RELAXED);
+    if (pool->pendingTail)
+        pool->pendingTail->next = job;
+    else
+        pool->pendingHead = job;
+    pool->pendingTail = job;
+    pthread_cond_signal(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+    return job;
+}
+
+size_t asyncPoll(AsyncPool *pool, AsyncJob **jobs, size_t max)
+{
+    size_t count = 0;
+    pthread_mutex_lock(&pool->lock);
+    while (count < max && pool->doneHead)
+    {
+        AsyncJob *job = pool->doneHead;
+        pool->doneHead = job->next;
+        jobs[count++] = job;
+    }
+    if (!pool->doneHead)
+    {
+        pool->doneTail = NULL;
+        notifyClear(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    // 取回即交付: 调用者的引用继续有效
+    for (size_t i = 0; i < count; i++)
+    {
+        retireJob(pool, jobs[i]);
+    }
+    return count;
+}
+
+AsyncStatus asyncWait(AsyncJob *job)
+{
+    AsyncPool *pool = job->pool;
+    pthread_mutex_lock(&pool->lock);
+    while (job->status < ASYNC_DONE)
+    {
+        pthread_cond_wait(&pool->jobFinished, &pool->lock);
+    }
+    AsyncStatus status = job->status;
+    pthread_mutex_unlock(&pool->lock);
+    return status;
+}
+
+int asyncCancel(AsyncJob *job)
+{
+    AsyncPool *pool = job->pool;
+    pthread_mutex_lock(&pool->lock);
+    if (job->status == ASYNC_PENDING)
+    {
+        // 从排队队列中摘除后直接交付
+        AsyncJob **link = &pool->pendingHead, *prev = NULL;
+        while (*link != job)
+        {
+            prev = *link;
+            link = &(*link)->next;
+        }
+        *link = job->next;
+        if (pool->pendingTail == job)
+            pool->pendingTail = prev;
+        pthread_mutex_unlock(&pool->lock);
+        finishJob(pool, job, ASYNC_CANCELLED);
+        return 1;
+    }
+    int running = job->status == ASYNC_RUNNING;
+    if (running)
+        __atomic_store_n(&job->cancel, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&pool->lock);
+    return running;
+}
+
+AsyncStatus asyncJobStatus(const AsyncJob *job)
+{
+    return __atomic_load_n(&job->status, __ATOMIC_ACQUIRE);
+}
+
+void *asyncJobArg(const AsyncJob *job)
+{
+    return job->req.arg;
+}
+
+void asyncJobRelease(AsyncJob *job)
+{
+    if (job)
+        jobUnref(job);
+}
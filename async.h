@@ -0,0 +1,90 @@
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "DES.h"
+#include "enum.h"
+
+// 异步加解密: 任务提交给库内部的工作线程池, 调用线程(如事件循环)不必等待几MB的加解密完成
+// 完成通知三选一或组合: 工作线程上的回调; 可读即有完成任务的文件描述符(Linux 为 eventfd) + asyncPoll 取回;
+// asyncWait 阻塞等待某个任务. 未取回的完成任务与在途任务一起计入背压上限
+
+// 数据分段处理, 每段之间检查取消请求; 链接状态跨段保持, 结果与一次处理整个数组相同
+#define ASYNC_SLICE_BLOCKS 8192
+
+typedef enum
+{
+    ASYNC_PENDING,   // 排队中
+    ASYNC_RUNNING,   // 正在处理
+    ASYNC_DONE,      // 完成, out 中为结果
+    ASYNC_FAILED,    // 模式不支持
+    ASYNC_CANCELLED  // 已取消, 开始处理后取消时 out 中只有部分结果
+} AsyncStatus;
+
+typedef struct AsyncPool AsyncPool;
+typedef struct AsyncJob AsyncJob;
+
+// 完成回调, 在工作线程上调用, 应尽快返回; 可在回调中调用 asyncJobRelease
+// 排队中的任务被取消(asyncCancel 或 asyncPoolDestroy)时在调用取消的线程上调用
+typedef void (*AsyncCallback)(AsyncJob *job, void *arg);
+
+typedef struct
+{
+    int threads;        // 工作线程数, <=0 时取CPU核数
+    size_t maxJobs;     // 已提交但未交付(回调返回或被 asyncPoll 取回)的任务数上限, 0 表示不限
+    size_t maxBytes;    // 这些任务的数据总字节数上限, 0 表示不限; 单个任务超过上限时只在没有其他任务时接受
+    bool blockWhenFull; // 达到上限时 asyncSubmit 等待, 否则立即返回NULL并置 errno 为 EAGAIN
+                        // 提交线程自己用 asyncPoll 取回时不要等待: 完成队列不取回, 上限永远不会解除
+} AsyncOptions;
+
+// 一个任务: 用 des 的密钥编排(只引用, 须在任务交付前保持有效)与 iv 处理 blocks 个块
+// in 与 out 可以相同(原地处理), 在任务交付前不得修改或释放
+typedef struct
+{
+    const DES *des;
+    EncryptionMode mode; // ECB/CBC/CFB/OFB, 64位分组, 同 DES_encryptInPlace
+    bool decrypt;
+    BYTE iv;
+    const BYTE *in;
+    BYTE *out;
+    size_t blocks;
+    AsyncCallback callback; // 非NULL时完成后调用, 任务不进入完成队列
+    void *arg;
+} AsyncRequest;
+
+// 默认: CPU核数个线程, 至多1024个任务、256MB, 达到上限时返回EAGAIN
+void asyncDefaults(AsyncOptions *opts);
+
+// 创建线程池, 失败返回NULL
+AsyncPool *asyncPoolCreate(const AsyncOptions *opts);
+
+// 取消所有排队的任务, 等待正在处理的任务结束(已请求取消), 然后释放线程池
+// 未交付的完成通知被丢弃; 调用者仍须对持有的任务句柄调用 asyncJobRelease.
+// 可与其他线程对这些句柄的 asyncCancel/asyncWait 同时进行, 返回后对句柄调用它们也是安全的 (任务均已结束)
+void asyncPoolDestroy(AsyncPool *pool);
+
+// 完成队列非空时可读的文件描述符, 可加入 epoll/poll. 由线程池拥有, 不要关闭
+int asyncPollFd(const AsyncPool *pool);
+
+// 提交任务, 返回句柄(须用 asyncJobRelease 释放). 达到背压上限且不等待时返回NULL, errno 为 EAGAIN;
+// 参数无效时返回NULL, errno 为 EINVAL
+AsyncJob *asyncSubmit(AsyncPool *pool, const AsyncRequest *req);
+
+// 从完成队列取回至多 max 个任务(不阻塞), 返回个数. 取回后任务不再计入背压上限
+size_t asyncPoll(AsyncPool *pool, AsyncJob **jobs, size_t max);
+
+// 阻塞等待任务结束, 返回最终状态. 不从完成队列中取回
+AsyncStatus asyncWait(AsyncJob *job);
+
+// 请求取消. 排队中的任务立即以 ASYNC_CANCELLED 交付; 正在处理的任务在当前分段结束后停止
+// 任务已结束时返回0, 否则返回1
+int asyncCancel(AsyncJob *job);
+
+AsyncStatus asyncJobStatus(const AsyncJob *job);
+// 任务的用户参数 (AsyncRequest.arg)
+void *asyncJobArg(const AsyncJob *job);
+// 释放句柄. 任务尚未交付时由线程池在交付后释放
+void asyncJobRelease(AsyncJob *job);
+
+#endif // ASYNC_H
@@ -0,0 +1,401 @@
+#include "autotune.h"
+#include "DES.h"
+#include "jit.h"
+#include "util.h"
+#include "pool.h"
+#include "workMode.h"
+#include "iopipe.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// 合成数据大小: 分块CBC与密钥专用代码试验用内存中的数据, I/O 试验用临时文件(十六进制文本)
+#define TUNE_DATA_BYTES (8u << 20)
+#define TUNE_JIT_BYTES (256u << 10)
+#define TUNE_FILE_BYTES (4u << 20)
+// 每个候选值重复试验取最好成绩, 抵消调度抖动
+#define TUNE_REPEATS 3
+// 与最好成绩相差不到3%的候选值视为一样快, 取其中占用资源最少的(线程少、缓冲区小)
+#define TUNE_TOLERANCE 0.03
+#define TUNE_MB (1024.0 * 1024.0)
+
+// 试验用的固定密钥与IV
+#define TUNE_KEY 0x133457799BBCDFF1ULL
+#define TUNE_IV 0x5072656E74696365ULL
+
+void tuneProfileDefaults(TuneProfile *profile)
+{
+    profile->threads = 0;
+    profile->chunkedBytes = 0;
+    profile->ioChunk = 0;
+    profile->queueDepth = 0;
+    profile->jit = false;
+}
+
+const char *tuneProfilePath(char *buf, size_t size)
+{
+    const char *env = getenv("E1DES_PROFILE");
+    if (env && *env)
+    {
+        snprintf(buf, size, "%s", env);
+        return buf;
+    }
+    const char *home = getenv("HOME");
+    char host[256];
+    if (!home || !*home || gethostname(host, sizeof(host)) != 0)
+        return NULL;
+    host[sizeof(host) - 1] = '\0';
+    snprintf(buf, size, "%s/.config/e1des/%s.profile", home, host);
+    return buf;
+}
+
+int tuneProfileLoad(const char *path, TuneProfile *profile)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return 0;
+    char line[256];
+    int lineNo = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        lineNo++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0')
+            continue;
+        char *eq = strchr(line, '=');
+        char *end = NULL;
+        unsigned long long value = 0;
+        if (eq)
+        {
+            *eq = '\0';
+            errno = 0;
+            value = strtoull(eq + 1, &end, 10);
+        }
+        if (!eq || end == eq + 1 || *end != '\0' || errno != 0)
+        {
+            fprintf(stderr, "Warning: Ignoring malformed line %d in profile %s\n", lineNo, path);
+            continue;
+        }
+        if (strcmp(line, "threads") == 0 && value <= 1024)
+            profile->threads = (int)value;
+        else if (strcmp(line, "chunked") == 0 && value % 8 == 0)
+            profile->chunkedBytes = value;
+        else if (strcmp(line, "io-chunk") == 0 && value % IOPIPE_ALIGN == 0)
+            profile->ioChunk = value;
+        else if (strcmp(line, "queue-depth") == 0 && value <= 1024)
+            profile->queueDepth = (int)value;
+        else if (strcmp(line, "jit") == 0 && value <= 1)
+            profile->jit = value == 1;
+        else
+            fprintf(stderr, "Warning: Ignoring unknown setting '%s' in profile %s\n", line, path);
+    }
+    fclose(fp);
+    return 1;
+}
+
+static double wallSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 在升序排列的候选值中取不比最好成绩慢 TUNE_TOLERANCE 以上的第一个
+static int pickCandidate(const double *rates, int count)
+{
+    double best = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (rates[i] > best)
+            best = rates[i];
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (rates[i] >= best * (1 - TUNE_TOLERANCE))
+            return i;
+    }
+    return 0;
+}
+
+// 分块CBC加密整个合成数据, 返回最好的 MB/s, 失败返回负数
+static double trialChunked(DES *des, const BYTE *data, size_t blocks, size_t chunkBytes, int threads)
+{
+    double best = -1;
+    for (int r = 0; r < TUNE_REPEATS; r++)
+    {
+        ChunkedContainer container;
+        double start = wallSeconds();
+        if (!CBC_encryptChunked(des, data, blocks, TUNE_IV, chunkBytes / 8, threads, &container))
+            return -1;
+        double rate = blocks * sizeof(BYTE) / (wallSeconds() - start) / TUNE_MB;
+        freeChunkedContainer(&container);
+        if (rate > best)
+            best = rate;
+    }
+    return best;
+}
+
+// 批量加密 TUNE_JIT_BYTES, 返回最好的 MB/s
+static double trialBlocks(DES *des, BYTE *data, size_t blocks)
+{
+    double best = 0;
+    for (int r = 0; r < TUNE_REPEATS; r++)
+    {
+        double start = wallSeconds();
+        for (int k = 0; k < 8; k++)
+        {
+            DES_encryptBlocks(des, data, data, blocks);
+        }
+        double rate = 8 * blocks * sizeof(BYTE) / (wallSeconds() - start) / TUNE_MB;
+        if (rate > best)
+            best = rate;
+    }
+    return best;
+}
+
+// 经 I/O 流水线(线程后端)加密临时文件, 返回最好的 MB/s(按输入文件大小), 失败返回负数
+static double trialPipeline(DES *des, const char *inPath, const char *outPath, size_t chunk, int depth)
+{
+    IoPipelineOptions opts;
+    ioPipelineDefaults(&opts);
+    opts.backend = IO_BACKEND_THREADS;
+    opts.chunkSize = chunk;
+    opts.queueDepth = depth;
+    double best = -1;
+    for (int r = 0; r < TUNE_REPEATS; r++)
+    {
+        double start = wallSeconds();
+        if (!pipelineProcessFile(des, CBC, false, inPath, outPath, &opts))
+            return -1;
+        double rate = TUNE_FILE_BYTES / (wallSeconds() - start) / TUNE_MB;
+        if (rate > best)
+            best = rate;
+    }
+    return best;
+}
+
+// 线程数: 1, 2, 4, ... 直到CPU核数(含核数本身), 分块固定为默认大小
+static int tuneThreads(DES *des, const BYTE *data, size_t blocks, TuneProfile *profile)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1)
+        cpus = 1;
+    int candidates[32], count = 0;
+    for (long t = 1; t < cpus && count < 31; t *= 2)
+    {
+        candidates[count++] = (int)t;
+    }
+    candidates[count++] = (int)cpus;
+
+    double rates[32];
+    for (int i = 0; i < count; i++)
+    {
+        rates[i] = trialChunked(des, data, blocks, CHUNKED_DEFAULT_BYTES, candidates[i]);
+        if (rates[i] < 0)
+            return 0;
+        printf("  threads=%-4d %10.2f MB/s\n", candidates[i], rates[i]);
+    }
+    profile->threads = candidates[pickCandidate(rates, count)];
+    return 1;
+}
+
+// 分块CBC的分块大小, 用上一步选出的线程数
+static int tuneChunked(DES *des, const BYTE *data, size_t blocks, TuneProfile *profile)
+{
+    static const size_t candidates[] = {16384, 65536, 262144, 1048576};
+    const int count = sizeof(candidates) / sizeof(candidates[0]);
+    double rates[sizeof(candidates) / sizeof(candidates[0])];
+    for (int i = 0; i < count; i++)
+    {
+        rates[i] = trialChunked(des, data, blocks, candidates[i], profile->threads);
+        if (rates[i] < 0)
+            return 0;
+        printf("  chunked=%-8zu %10.2f MB/s\n", candidates[i], rates[i]);
+    }
+    profile->chunkedBytes = candidates[pickCandidate(rates, count)];
+    return 1;
+}
+
+// 通用实现与密钥专用代码, 后者必须明显更快才启用
+static void tuneJit(BYTE *data, size_t blocks, TuneProfile *profile)
+{
+    DES generic, special;
+    const DES_KeySchedule *gs = DES_scheduleCreate(TUNE_KEY);
+    bool available = jitSetEnabled(true);
+    const DES_KeySchedule *js = available ? DES_scheduleCreate(TUNE_KEY) : NULL;
+    jitSetEnabled(false);
+    profile->jit = false;
+    if (!gs || !js || !js->jitEncrypt)
+    {
+        printf("  jit unavailable\n");
+    }
+    else
+    {
+        DES_bind(&generic, gs, 0);
+        DES_bind(&special, js, 0);
+        double g = trialBlocks(&generic, data, blocks);
+        double j = trialBlocks(&special, data, blocks);
+        printf("  generic %10.2f MB/s\n  jit     %10.2f MB/s\n", g, j);
+        profile->jit = j > g * (1 + TUNE_TOLERANCE);
+    }
+    DES_scheduleFree(gs);
+    DES_scheduleFree(js);
+}
+
+// I/O 流水线的读取大小与队列深度, 在临时文件上试验
+static int tunePipeline(DES *des, TuneProfile *profile)
+{
+    static const size_t chunks[] = {262144, 1048576, 4194304};
+    static const int depths[] = {2, 4, 8};
+    const int chunkCount = sizeof(chunks) / sizeof(chunks[0]);
+    const int depthCount = sizeof(depths) / sizeof(depths[0]);
+
+    const char *dir = getenv("TMPDIR");
+    char inPath[512], outPath[512];
+    snprintf(inPath, sizeof(inPath), "%s/e1des-tune-in-XXXXXX", dir && *dir ? dir : "/tmp");
+    snprintf(outPath, sizeof(outPath), "%s/e1des-tune-out-XXXXXX", dir && *dir ? dir : "/tmp");
+    int inFd = mkstemp(inPath);
+    int outFd = inFd >= 0 ? mkstemp(outPath) : -1;
+    if (outFd < 0)
+    {
+        fprintf(stderr, "Error: Unable to create temporary files for the I/O trial\n");
+        if (inFd >= 0)
+        {
+            close(inFd);
+            unlink(inPath);
+        }
+        return 0;
+    }
+    close(outFd);
+
+    // 伪随机的十六进制文本
+    FILE *fp = fdopen(inFd, "w");
+    unsigned long long x = TUNE_KEY;
+    for (size_t i = 0; fp && i < TUNE_FILE_BYTES; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        fputc("0123456789ABCDEF"[x & 0x0F], fp);
+    }
+    int ok = fp && fclose(fp) == 0;
+    if (!fp)
+        close(inFd);
+
+    double rates[9];
+    int best = 0;
+    for (int c = 0; ok && c < chunkCount; c++)
+    {
+        for (int d = 0; ok && d < depthCount; d++)
+        {
+            int i = c * depthCount + d;
+            rates[i] = trialPipeline(des, inPath, outPath, chunks[c], depths[d]);
+            ok = rates[i] >= 0;
+            if (ok)
+                printf("  io-chunk=%-8zu queue-depth=%-2d %10.2f MB/s\n", chunks[c], depths[d], rates[i]);
+        }
+    }
+    if (ok)
+    {
+        // 候选值按读取大小、再按深度升序排列, 取最省内存的
+        best = pickCandidate(rates, chunkCount * depthCount);
+        profile->ioChunk = chunks[best / depthCount];
+        profile->queueDepth = depths[best % depthCount];
+    }
+    unlink(inPath);
+    unlink(outPath);
+    return ok;
+}
+
+// 逐级创建配置文件所在目录
+static int makeParentDirs(const char *path)
+{
+    char dir[1024];
+    snprintf(dir, sizeof(dir), "%s", path);
+    for (char *p = dir + 1; *p; p++)
+    {
+        if (*p != '/')
+            continue;
+        *p = '\0';
+        if (mkdir(dir, 0755) != 0 && errno != EEXIST)
+            return 0;
+        *p = '/';
+    }
+    return 1;
+}
+
+static int tuneProfileSave(const char *path, const TuneProfile *profile)
+{
+    if (!makeParentDirs(path))
+        return 0;
+    FILE *fp = fopen(path, "w");
+    if (!fp)
+        return 0;
+    char host[256] = "unknown";
+    gethostname(host, sizeof(host));
+    host[sizeof(host) - 1] = '\0';
+    time_t now = time(NULL);
+    char date[32];
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    fprintf(fp, "# e1des --autotune profile for %s (%ld CPUs), %s\n", host, sysconf(_SC_NPROCESSORS_ONLN), date);
+    fprintf(fp, "threads=%d\n", profile->threads);
+    fprintf(fp, "chunked=%zu\n", profile->chunkedBytes);
+    fprintf(fp, "io-chunk=%zu\n", profile->ioChunk);
+    fprintf(fp, "queue-depth=%d\n", profile->queueDepth);
+    fprintf(fp, "jit=%d\n", profile->jit ? 1 : 0);
+    return fclose(fp) == 0;
+}
+
+int runAutotune(const char *path)
+{
+    size_t blocks = TUNE_DATA_BYTES / sizeof(BYTE);
+    BYTE *data = (BYTE *)poolAlloc(TUNE_DATA_BYTES);
+    DES *des = DES_create();
+    if (!data || !des || !DES_init(des, TUNE_KEY))
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        poolFree(data);
+        DES_destroy(des);
+        return 0;
+    }
+    des->iv = TUNE_IV;
+    for (size_t i = 0; i < blocks; i++)
+    {
+        data[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+
+    TuneProfile profile;
+    tuneProfileDefaults(&profile);
+    printf("Thread count (chunked CBC, %u MB):\n", TUNE_DATA_BYTES >> 20);
+    int ok = tuneThreads(des, data, blocks, &profile);
+    if (ok)
+    {
+        printf("Chunk size (chunked CBC, %d threads):\n", profile.threads);
+        ok = tuneChunked(des, data, blocks, &profile);
+    }
+    if (ok)
+    {
+        printf("Key-specialized code (%u KB batches):\n", TUNE_JIT_BYTES >> 10);
+        tuneJit(data, TUNE_JIT_BYTES / sizeof(BYTE), &profile);
+        printf("I/O pipeline (thread backend, %u MB hex file):\n", TUNE_FILE_BYTES >> 20);
+        ok = tunePipeline(des, &profile);
+    }
+    poolFree(data);
+    DES_destroy(des);
+    if (!ok)
+        return 0;
+
+    printf("Selected: threads=%d chunked=%zu io-chunk=%zu queue-depth=%d jit=%d\n", profile.threads,
+           profile.chunkedBytes, profile.ioChunk, profile.queueDepth, profile.jit ? 1 : 0);
+    if (!tuneProfileSave(path, &profile))
+    {
+        fprintf(stderr, "Error: Unable to write profile: %s\n", path);
+        return 0;
+    }
+    printf("Profile written to: %s\n", path);
+    return 1;
+}
@@ -0,0 +1,32 @@
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 本机调优: e1des --autotune 在合成数据上对各个可调参数做短时试验, 结果写入本机的配置文件;
+// 之后每次运行自动加载, 命令行显式给出的参数优先
+// 配置文件默认为 $E1DES_PROFILE, 未设置时为 ~/.config/e1des/<主机名>.profile (家目录共享时各主机互不覆盖)
+
+typedef struct
+{
+    int threads;         // 批量、服务与分块CBC的线程数, 0 表示未调优(取CPU核数)
+    size_t chunkedBytes; // --chunked 不带参数时的分块字节数, 0 表示未调优
+    size_t ioChunk;      // --io=threads|uring 每次读取的字节数, 0 表示未调优
+    int queueDepth;      // --io=threads|uring 同时在途的读请求数, 0 表示未调优
+    bool jit;            // 密钥专用代码在本机更快
+} TuneProfile;
+
+// 全部参数为未调优
+void tuneProfileDefaults(TuneProfile *profile);
+
+// 默认配置文件路径写入buf, 无法确定(没有 HOME)时返回NULL
+const char *tuneProfilePath(char *buf, size_t size);
+
+// 读取配置文件, 文件不存在返回0且 profile 保持默认; 无法识别的行给出警告后忽略
+int tuneProfileLoad(const char *path, TuneProfile *profile);
+
+// 运行全部试验并把结果写入 path (目录不存在时创建), 试验过程打印到标准输出. 成功返回1
+int runAutotune(const char *path);
+
+#endif // AUTOTUNE_H
@@ -0,0 +1,344 @@
+#include "batch.h"
+#include "util.h"
+#include "workMode.h"
+#include "mac.h"
+#include "stream.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 清单中单行路径的最大长度
+#define MANIFEST_LINE_MAX 4096
+
+// 处理单个文件: 读入的文本按小块融合解码、加解密、编码后写出, 见 stream.c
+int processFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                const char *inPath, const char *outPath)
+{
+    return streamProcessFile(des, mode, decrypt, binary, binaryOut, inPath, outPath);
+}
+
+int processChunkedFile(DES *des, bool decrypt, const char *inPath, const char *outPath,
+                       size_t chunkBytes, int numThreads)
+{
+    ChunkedContainer container;
+    int ok;
+    if (decrypt)
+    {
+        if (!readChunkedFile(inPath, &container))
+            return 0;
+        size_t outSize = 0;
+        BYTE *out = CBC_decryptChunked(des, &container, des->iv, numThreads, &outSize);
+        ok = out && writeHexFile(outPath, out, outSize);
+        poolFree(out);
+    }
+    else
+    {
+        if (chunkBytes == 0 || chunkBytes % 8 != 0)
+        {
+            fprintf(stderr, "Error: Chunk size must be a positive multiple of 8 bytes\n");
+            return 0;
+        }
+        size_t inSize;
+        BYTE *in = readHexFile(inPath, &inSize);
+        if (!in)
+        {
+            fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+            return 0;
+        }
+        ok = CBC_encryptChunked(des, in, inSize, des->iv, chunkBytes / 8, numThreads, &container) &&
+             writeChunkedFile(outPath, &container);
+        poolFree(in);
+    }
+    freeChunkedContainer(&container);
+    return ok;
+}
+
+int processMacFile(DES *k1, DES *k2, const char *inPath, int pad, const char *outPath)
+{
+    size_t size = 0;
+    unsigned char *data = readHexFile8(inPath, &size);
+    if (!data)
+    {
+        fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+        return 0;
+    }
+    BYTE tag = k2 ? DES_retailMac(k1, k2, data, size, (MacPadding)pad)
+                  : DES_cbcMac(k1, data, size, (MacPadding)pad);
+    poolFree(data);
+    return writeHexFile(outPath, &tag, 1);
+}
+
+// 一个批量任务: 输入/输出路径对
+typedef struct
+{
+    char *inPath;
+    char *outPath;
+    long long size; // 输入文件大小, 用于初始分配
+} BatchJob;
+
+// 每个工作线程拥有一个双端队列, 自己从尾部取任务, 空闲线程从其他队列头部窃取
+typedef struct
+{
+    pthread_mutex_t lock;
+    size_t *items;
+    size_t head, tail; // 有效区间 [head, tail)
+} JobDeque;
+
+typedef struct
+{
+    DES *des;
+    EncryptionMode mode;
+    bool decrypt;
+    BatchJob *jobs;
+    JobDeque *deques;
+    int numWorkers;
+    pthread_mutex_t statLock;
+    size_t failed;
+} BatchContext;
+
+typedef struct
+{
+    BatchContext *ctx;
+    int id;
+} BatchWorker;
+
+// 从自己的队列尾部取任务
+static int dequePop(JobDeque *dq, size_t *job)
+{
+    int ok = 0;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->tail > dq->head)
+    {
+        *job = dq->items[--dq->tail];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+// 从其他线程队列头部窃取任务
+static int dequeSteal(JobDeque *dq, size_t *job)
+{
+    int ok = 0;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->tail > dq->head)
+    {
+        *job = dq->items[dq->head++];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+static void *batchWorkerMain(void *arg)
+{
+    BatchWorker *w = (BatchWorker *)arg;
+    BatchContext *ctx = w->ctx;
+    size_t job;
+
+    for (;;)
+    {
+        int found = dequePop(&ctx->deques[w->id], &job);
+        // 自己的队列为空时, 依次尝试从其他线程窃取
+        for (int k = 1; !found && k < ctx->numWorkers; k++)
+        {
+            found = dequeSteal(&ctx->deques[(w->id + k) % ctx->numWorkers], &job);
+        }
+        // 任务在启动前已全部入队, 所有队列都为空即可退出
+        if (!found)
+            break;
+
+        BatchJob *j = &ctx->jobs[job];
+        if (processFile(ctx->des, ctx->mode, ctx->decrypt, false, false, j->inPath, j->outPath))
+        {
+            printf("%s complete: %s -> %s\n", ctx->decrypt ? "Decryption" : "Encryption",
+                   j->inPath, j->outPath);
+        }
+        else
+        {
+            fprintf(stderr, "Error: Failed to process %s\n", j->inPath);
+            pthread_mutex_lock(&ctx->statLock);
+            ctx->failed++;
+            pthread_mutex_unlock(&ctx->statLock);
+        }
+    }
+    return NULL;
+}
+
+// 按文件大小降序排列, 大文件先分配
+static int compareJobSize(const void *a, const void *b)
+{
+    long long sa = ((const BatchJob *)a)->size;
+    long long sb = ((const BatchJob *)b)->size;
+    return (sa < sb) - (sa > sb);
+}
+
+// 读取清单, 每行"输入路径 输出路径", 忽略空行和以#开头的注释行
+static BatchJob *readManifest(const char *manifestPath, size_t *jobCount)
+{
+    FILE *file = strcmp(manifestPath, "-") == 0 ? stdin : fopen(manifestPath, "r");
+    if (!file)
+    {
+        fprintf(stderr, "Error: Unable to open manifest: %s\n", manifestPath);
+        return NULL;
+    }
+
+    size_t count = 0, capacity = 16;
+    BatchJob *jobs = (BatchJob *)malloc(capacity * sizeof(BatchJob));
+    char line[MANIFEST_LINE_MAX];
+    size_t lineNo = 0;
+    int ok = jobs != NULL;
+
+    while (ok && fgets(line, sizeof(line), file))
+    {
+        lineNo++;
+        char *inPath = strtok(line, " \t\r\n");
+        if (!inPath || inPath[0] == '#')
+            continue;
+        char *outPath = strtok(NULL, " \t\r\n");
+        if (!outPath)
+        {
+            fprintf(stderr, "Error: Manifest line %zu has no output path\n", lineNo);
+            ok = 0;
+            break;
+        }
+        if (count == capacity)
+        {
+            capacity *= 2;
+            BatchJob *grown = (BatchJob *)realloc(jobs, capacity * sizeof(BatchJob));
+            if (!grown)
+            {
+                ok = 0;
+                break;
+            }
+            jobs = grown;
+        }
+        struct stat st;
+        jobs[count].inPath = strdup(inPath);
+        jobs[count].outPath = strdup(outPath);
+        if (!jobs[count].inPath || !jobs[count].outPath)
+        {
+            free(jobs[count].inPath);
+            free(jobs[count].outPath);
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            ok = 0;
+            break;
+        }
+        jobs[count].size = stat(inPath, &st) == 0 ? (long long)st.st_size : 0;
+        count++;
+    }
+
+    if (file != stdin)
+        fclose(file);
+
+    if (!ok)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            free(jobs[i].inPath);
+            free(jobs[i].outPath);
+        }
+        free(jobs);
+        return NULL;
+    }
+
+    *jobCount = count;
+    return jobs;
+}
+
+int runBatch(DES *des, EncryptionMode mode, bool decrypt,
+             const char *manifestPath, int numThreads)
+{
+    size_t jobCount = 0;
+    BatchJob *jobs = readManifest(manifestPath, &jobCount);
+    if (!jobs)
+        return 1;
+
+    if (numThreads <= 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = cpus > 0 ? (int)cpus : 1;
+    }
+    if ((size_t)numThreads > jobCount)
+        numThreads = jobCount > 0 ? (int)jobCount : 1;
+
+    // 按大小降序排列后轮流分配, 大文件分散到不同线程
+    qsort(jobs, jobCount, sizeof(BatchJob), compareJobSize);
+
+    BatchContext ctx;
+    ctx.des = des;
+    ctx.mode = mode;
+    ctx.decrypt = decrypt;
+    ctx.jobs = jobs;
+    ctx.numWorkers = numThreads;
+    ctx.failed = 0;
+    pthread_mutex_init(&ctx.statLock, NULL);
+    ctx.deques = (JobDeque *)calloc(numThreads, sizeof(JobDeque));
+    BatchWorker *workers = (BatchWorker *)malloc(numThreads * sizeof(BatchWorker));
+    pthread_t *threads = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    // 所有队列共用一块槽位数组, 每个线程占其中连续的一段
+    size_t perWorker = (jobCount + numThreads - 1) / numThreads;
+    size_t *slots = (size_t *)malloc((perWorker ? perWorker : 1) * numThreads * sizeof(size_t));
+    if (!ctx.deques || !workers || !threads || !slots)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        ctx.failed = jobCount;
+        goto cleanup;
+    }
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        pthread_mutex_init(&ctx.deques[t].lock, NULL);
+        ctx.deques[t].items = slots + t * perWorker;
+        ctx.deques[t].head = ctx.deques[t].tail = 0;
+    }
+    // 倒序入队: 队列尾部是大文件, 由所属线程先处理; 空闲线程从头部窃取剩余的小文件
+    for (size_t i = jobCount; i-- > 0;)
+    {
+        JobDeque *dq = &ctx.deques[i % numThreads];
+        dq->items[dq->tail++] = i;
+    }
+
+    int started = 0;
+    for (; started < numThreads; started++)
+    {
+        workers[started].ctx = &ctx;
+        workers[started].id = started;
+        if (pthread_create(&threads[started], NULL, batchWorkerMain, &workers[started]) != 0)
+            break;
+    }
+    // 线程创建失败时, 已启动的线程会窃取剩余队列中的任务; 一个都没启动则在当前线程执行
+    if (started == 0)
+    {
+        BatchWorker self = {&ctx, 0};
+        batchWorkerMain(&self);
+    }
+    for (int t = 0; t < started; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        pthread_mutex_destroy(&ctx.deques[t].lock);
+    }
+    printf("Batch complete: %zu files, %zu failed\n", jobCount, ctx.failed);
+
+cleanup:
+    pthread_mutex_destroy(&ctx.statLock);
+    free(ctx.deques);
+    free(slots);
+    free(workers);
+    free(threads);
+    for (size_t i = 0; i < jobCount; i++)
+    {
+        free(jobs[i].inPath);
+        free(jobs[i].outPath);
+    }
+    free(jobs);
+    return ctx.failed == 0 ? 0 : 1;
+}
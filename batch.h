@@ -0,0 +1,29 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+#include "DES.h"
+#include "enum.h"
+
+// 处理单个文件: 读取十六进制(binary为真时为原始字节)输入, 按模式加/解密后写出
+// 十六进制(binaryOut为真时为原始字节)输出. 路径为 "-" 时使用标准输入/输出
+// des(含其中的IV)只读使用, 可被多个线程同时共享. 成功返回1, 失败返回0
+int processFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                const char *inPath, const char *outPath);
+
+// 分块CBC容器: 加密时把十六进制明文按chunkBytes字节分块并行加密, 写出容器;
+// 解密时读取容器并行解密, 写出十六进制明文. 使用des->iv派生各块IV. 成功返回1
+int processChunkedFile(DES *des, bool decrypt, const char *inPath, const char *outPath,
+                       size_t chunkBytes, int numThreads);
+
+// 计算十六进制输入文件的MAC, 把16个十六进制字符的标签写入 outPath
+// k2 为NULL时为CBC-MAC, 否则为零售MAC. pad 为 ISO/IEC 9797-1 填充方法(1或2). 成功返回1
+int processMacFile(DES *k1, DES *k2, const char *inPath, int pad, const char *outPath);
+
+// 批量模式: 从清单文件(路径为"-"时读取标准输入)逐行读取"输入路径 输出路径",
+// 共用同一个已设置密钥的DES实例, 在numThreads个工作线程上处理(<=0时取CPU核数)
+// 全部成功返回0, 否则返回1
+int runBatch(DES *des, EncryptionMode mode, bool decrypt,
+             const char *manifestPath, int numThreads);
+
+#endif // BATCH_H
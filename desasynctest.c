@@ -0,0 +1,327 @@
+// 异步任务接口 (async.h) 的自检: 结果与同步处理一致, 完成通知描述符, 取消, 背压 (EAGAIN 与等待),
+// 以及关闭线程池时与 asyncCancel 同时进行. 任一检查失败时返回1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "DES.h"
+#include "workMode.h"
+#include "async.h"
+#include "pool.h"
+
+#define TEST_KEY 0x133457799BBCDFF1ULL
+#define TEST_IV 0x0123456789ABCDEFULL
+// 单个长任务的块数: 分成多个 ASYNC_SLICE_BLOCKS 分段, 处理期间足以完成排队、取消等操作
+#define LONG_BLOCKS (64 * ASYNC_SLICE_BLOCKS)
+
+static int failures = 0;
+
+static void check(int ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "OK" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+static AsyncRequest makeRequest(const DES *des, EncryptionMode mode, const BYTE *in, BYTE *out, size_t blocks)
+{
+    AsyncRequest req;
+    memset(&req, 0, sizeof(req));
+    req.des = des;
+    req.mode = mode;
+    req.iv = TEST_IV;
+    req.in = in;
+    req.out = out;
+    req.blocks = blocks;
+    return req;
+}
+
+static int fdReadable(int fd, int timeoutMs)
+{
+    struct pollfd p = {fd, POLLIN, 0};
+    return poll(&p, 1, timeoutMs) == 1 && (p.revents & POLLIN);
+}
+
+// 各模式的异步结果与 DES_encryptInPlace 一次处理相同, 完成后通知描述符可读, 取回后不再可读
+static void testResults(DES *des, const BYTE *data, size_t blocks)
+{
+    AsyncOptions opts;
+    asyncDefaults(&opts);
+    opts.threads = 2;
+    AsyncPool *pool = asyncPoolCreate(&opts);
+    BYTE *expect = (BYTE *)poolAlloc(blocks * sizeof(BYTE));
+    BYTE *out = (BYTE *)poolAlloc(blocks * sizeof(BYTE));
+    if (!pool || !expect || !out)
+    {
+        check(0, "create pool and buffers");
+        asyncPoolDestroy(pool);
+        poolFree(expect);
+        poolFree(out);
+        return;
+    }
+    const EncryptionMode modes[] = {ECB, CBC, CFB, OFB};
+    const char *names[] = {"ECB", "CBC", "CFB", "OFB"};
+    for (int m = 0; m < 4; m++)
+    {
+        for (int decrypt = 0; decrypt < 2; decrypt++)
+        {
+            memcpy(expect, data, blocks * sizeof(BYTE));
+            BYTE state = TEST_IV;
+            if (decrypt)
+                DES_decryptInPlace(des, expect, blocks, modes[m], &state);
+            else
+                DES_encryptInPlace(des, expect, blocks, modes[m], &state);
+
+            AsyncRequest req = makeRequest(des, modes[m], data, out, blocks);
+            req.decrypt = decrypt;
+            AsyncJob *job = asyncSubmit(pool, &req);
+            char what[80];
+            snprintf(what, sizeof(what), "%s %s matches DES_%sInPlace", names[m], decrypt ? "decrypt" : "encrypt",
+                     decrypt ? "decrypt" : "encrypt");
+            int readable = job && fdReadable(asyncPollFd(pool), 5000);
+            AsyncJob *done = NULL;
+            size_t n = asyncPoll(pool, &done, 1);
+            check(job && readable && n == 1 && done == job && asyncJobStatus(job) == ASYNC_DONE &&
+                      memcmp(out, expect, blocks * sizeof(BYTE)) == 0,
+                  what);
+            asyncJobRelease(job);
+        }
+    }
+    check(!fdReadable(asyncPollFd(pool), 0), "notification fd cleared after asyncPoll");
+
+    // 原地处理
+    memcpy(out, data, blocks * sizeof(BYTE));
+    memcpy(expect, data, blocks * sizeof(BYTE));
+    BYTE state = TEST_IV;
+    DES_encryptInPlace(des, expect, blocks, CBC, &state);
+    AsyncRequest req = makeRequest(des, CBC, out, out, blocks);
+    AsyncJob *job = asyncSubmit(pool, &req);
+    check(job && asyncWait(job) == ASYNC_DONE && memcmp(out, expect, blocks * sizeof(BYTE)) == 0,
+          "in-place CBC via asyncWait");
+    asyncJobRelease(job);
+
+    asyncPoolDestroy(pool);
+    poolFree(expect);
+    poolFree(out);
+}
+
+typedef struct
+{
+    int calls;
+    AsyncStatus status;
+} CallbackRecord;
+
+static void recordCallback(AsyncJob *job, void *arg)
+{
+    CallbackRecord *r = (CallbackRecord *)arg;
+    r->status = asyncJobStatus(job);
+    __atomic_add_fetch(&r->calls, 1, __ATOMIC_RELAXED);
+}
+
+// 单线程池: 长任务占住线程时, 排队的任务可立即取消, 正在处理的任务在分段之间停止
+static void testCancel(DES *des, const BYTE *data, BYTE *scratch)
+{
+    AsyncOptions opts;
+    asyncDefaults(&opts);
+    opts.threads = 1;
+    AsyncPool *pool = asyncPoolCreate(&opts);
+    if (!pool)
+    {
+        check(0, "create pool");
+        return;
+    }
+    AsyncRequest longReq = makeRequest(des, CBC, data, scratch, LONG_BLOCKS);
+    AsyncJob *running = asyncSubmit(pool, &longReq);
+    CallbackRecord record = {0, ASYNC_PENDING};
+    BYTE small[8];
+    AsyncRequest queuedReq = makeRequest(des, ECB, data, small, 8);
+    queuedReq.callback = recordCallback;
+    queuedReq.arg = &record;
+    AsyncJob *queued = asyncSubmit(pool, &queuedReq);
+
+    while (running && asyncJobStatus(running) == ASYNC_PENDING)
+        usleep(100);
+    check(queued && asyncCancel(queued) == 1 && asyncJobStatus(queued) == ASYNC_CANCELLED &&
+              record.calls == 1 && record.status == ASYNC_CANCELLED,
+          "cancel queued job delivers ASYNC_CANCELLED via callback");
+    check(asyncCancel(queued) == 0, "cancel of a finished job returns 0");
+    check(running && asyncCancel(running) == 1 && asyncWait(running) == ASYNC_CANCELLED,
+          "cancel running job stops between slices");
+    asyncJobRelease(queued);
+    asyncJobRelease(running);
+    asyncPoolDestroy(pool);
+}
+
+// 背压: 不等待时达到上限返回 EAGAIN, 取回后恢复; 等待时 asyncSubmit 在另一线程取回后返回
+typedef struct
+{
+    AsyncPool *pool;
+    int delivered;
+} Drainer;
+
+static void *drainLater(void *arg)
+{
+    Drainer *d = (Drainer *)arg;
+    usleep(50 * 1000);
+    AsyncJob *jobs[4];
+    while (d->delivered < 1)
+    {
+        size_t n = asyncPoll(d->pool, jobs, 4);
+        for (size_t i = 0; i < n; i++)
+            asyncJobRelease(jobs[i]);
+        d->delivered += (int)n;
+        if (n == 0)
+            usleep(1000);
+    }
+    return NULL;
+}
+
+static void testBackpressure(DES *des, const BYTE *data)
+{
+    AsyncOptions opts;
+    asyncDefaults(&opts);
+    opts.threads = 1;
+    opts.maxJobs = 2;
+    AsyncPool *pool = asyncPoolCreate(&opts);
+    if (!pool)
+    {
+        check(0, "create pool");
+        return;
+    }
+    BYTE out[3][8];
+    AsyncJob *jobs[3];
+    for (int i = 0; i < 2; i++)
+    {
+        AsyncRequest req = makeRequest(des, ECB, data, out[i], 8);
+        jobs[i] = asyncSubmit(pool, &req);
+    }
+    AsyncRequest req = makeRequest(des, ECB, data, out[2], 8);
+    errno = 0;
+    jobs[2] = asyncSubmit(pool, &req);
+    check(jobs[0] && jobs[1] && jobs[2] == NULL && errno == EAGAIN, "submit over maxJobs fails with EAGAIN");
+    // 完成但未取回的任务仍计入上限
+    asyncWait(jobs[0]);
+    asyncWait(jobs[1]);
+    errno = 0;
+    jobs[2] = asyncSubmit(pool, &req);
+    check(jobs[2] == NULL && errno == EAGAIN, "undelivered completions still count");
+    AsyncJob *done[2];
+    size_t n = asyncPoll(pool, done, 2);
+    for (size_t i = 0; i < n; i++)
+        asyncJobRelease(done[i]);
+    jobs[2] = asyncSubmit(pool, &req);
+    check(n == 2 && jobs[2] != NULL, "submit succeeds after asyncPoll");
+    asyncWait(jobs[2]);
+    n = asyncPoll(pool, done, 2);
+    for (size_t i = 0; i < n; i++)
+        asyncJobRelease(done[i]);
+    asyncPoolDestroy(pool);
+
+    // 等待模式: 另一线程稍后取回, 被阻塞的提交随之返回
+    opts.maxJobs = 1;
+    opts.blockWhenFull = true;
+    pool = asyncPoolCreate(&opts);
+    if (!pool)
+    {
+        check(0, "create blocking pool");
+        return;
+    }
+    AsyncRequest first = makeRequest(des, ECB, data, out[0], 8);
+    AsyncJob *a = asyncSubmit(pool, &first);
+    Drainer drainer = {pool, 0};
+    pthread_t tid;
+    pthread_create(&tid, NULL, drainLater, &drainer);
+    AsyncRequest second = makeRequest(des, ECB, data, out[1], 8);
+    AsyncJob *b = asyncSubmit(pool, &second);
+    pthread_join(tid, NULL);
+    check(a && b && drainer.delivered >= 1, "blocking submit returns after a delivery");
+    asyncWait(b);
+    asyncJobRelease(a);
+    asyncJobRelease(b);
+    asyncPoolDestroy(pool);
+}
+
+// 关闭线程池的同时取消其中的任务 (事件循环在退出时取消在途任务)
+typedef struct
+{
+    AsyncJob **jobs;
+    size_t count;
+} CancelAll;
+
+static void *cancelAll(void *arg)
+{
+    CancelAll *c = (CancelAll *)arg;
+    for (size_t i = 0; i < c->count; i++)
+        asyncCancel(c->jobs[i]);
+    return NULL;
+}
+
+static void testDestroyRace(DES *des, const BYTE *data, BYTE *scratch)
+{
+    enum
+    {
+        ROUNDS = 200,
+        JOBS = 64
+    };
+    AsyncOptions opts;
+    asyncDefaults(&opts);
+    opts.threads = 1;
+    int ok = 1;
+    for (int round = 0; round < ROUNDS && ok; round++)
+    {
+        AsyncPool *pool = asyncPoolCreate(&opts);
+        AsyncJob *jobs[JOBS];
+        size_t count = 0;
+        for (int i = 0; pool && i < JOBS; i++)
+        {
+            AsyncRequest req = makeRequest(des, CBC, data, scratch, ASYNC_SLICE_BLOCKS);
+            jobs[count] = asyncSubmit(pool, &req);
+            if (jobs[count])
+                count++;
+        }
+        CancelAll c = {jobs, count};
+        pthread_t tid;
+        pthread_create(&tid, NULL, cancelAll, &c);
+        asyncPoolDestroy(pool);
+        pthread_join(tid, NULL);
+        for (size_t i = 0; i < count; i++)
+        {
+            AsyncStatus s = asyncJobStatus(jobs[i]);
+            ok &= s == ASYNC_DONE || s == ASYNC_CANCELLED;
+            asyncJobRelease(jobs[i]);
+        }
+        ok &= pool != NULL && count == JOBS;
+    }
+    check(ok, "asyncPoolDestroy concurrent with asyncCancel");
+}
+
+int main(void)
+{
+    size_t blocks = 3 * ASYNC_SLICE_BLOCKS + 17; // 不是分段的整数倍
+    size_t total = blocks > LONG_BLOCKS ? blocks : LONG_BLOCKS;
+    BYTE *data = (BYTE *)poolAlloc(total * sizeof(BYTE));
+    BYTE *scratch = (BYTE *)poolAlloc(total * sizeof(BYTE));
+    DES *des = DES_create();
+    if (!data || !scratch || !des || !DES_init(des, TEST_KEY))
+    {
+        fprintf(stderr, "Error: Unable to set up the test\n");
+        return 1;
+    }
+    srand(1);
+    for (size_t i = 0; i < total; i++)
+        data[i] = ((BYTE)rand() << 40) ^ ((BYTE)rand() << 20) ^ (BYTE)rand();
+
+    testResults(des, data, blocks);
+    testCancel(des, data, scratch);
+    testBackpressure(des, data);
+    testDestroyRace(des, data, scratch);
+
+    DES_destroy(des);
+    poolFree(data);
+    poolFree(scratch);
+    printf("%s\n", failures ? "async tests FAILED" : "async tests passed");
+    return failures ? 1 : 0;
+}
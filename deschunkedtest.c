@@ -0,0 +1,154 @@
+// 分块CBC容器 (workMode.h / util.h) 的自检: 块长不整除数据时的加解密往返, 单独解密一块,
+// 以及拒绝截断的块索引和块长之和溢出的伪造索引. 任一检查失败时返回1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "DES.h"
+#include "workMode.h"
+#include "util.h"
+#include "pool.h"
+
+#define TEST_KEY 0x133457799BBCDFF1ULL
+#define TEST_IV 0x0123456789ABCDEFULL
+// 数据块数与每块的块数: 1000 不是 7 的整数倍, 最后一块只有 6 个BYTE
+#define DATA_BLOCKS 1000
+#define CHUNK_BLOCKS 7
+
+static int failures = 0;
+static char path[64];
+
+static void check(int ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "OK" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+// 写入后读回: 往返后与原容器一致
+static int writeAndRead(const ChunkedContainer *container, ChunkedContainer *loaded)
+{
+    if (!writeChunkedFile(path, container) || !readChunkedFile(path, loaded))
+        return 0;
+    int same = loaded->chunkBlocks == container->chunkBlocks && loaded->chunkCount == container->chunkCount &&
+               loaded->totalBlocks == container->totalBlocks &&
+               memcmp(loaded->chunkSizes, container->chunkSizes, container->chunkCount * sizeof(size_t)) == 0 &&
+               memcmp(loaded->data, container->data, container->totalBlocks * sizeof(BYTE)) == 0;
+    if (!same)
+        freeChunkedContainer(loaded);
+    return same;
+}
+
+// 并行加密, 经文件往返后并行解密; 每一块单独解密, 并与用派生IV做普通CBC的结果比较
+static void testRoundTrip(DES *des, const BYTE *data)
+{
+    ChunkedContainer container, loaded;
+    if (!CBC_encryptChunked(des, data, DATA_BLOCKS, TEST_IV, CHUNK_BLOCKS, 3, &container))
+    {
+        check(0, "CBC_encryptChunked");
+        return;
+    }
+    check(container.chunkCount == (DATA_BLOCKS + CHUNK_BLOCKS - 1) / CHUNK_BLOCKS &&
+              container.chunkSizes[container.chunkCount - 1] == DATA_BLOCKS % CHUNK_BLOCKS,
+          "chunk index when the chunk size does not divide the data");
+
+    int ok = writeAndRead(&container, &loaded);
+    check(ok, "writeChunkedFile/readChunkedFile round trip");
+    if (ok)
+    {
+        size_t size = 0;
+        BYTE *plain = CBC_decryptChunked(des, &loaded, TEST_IV, 3, &size);
+        check(plain && size == DATA_BLOCKS && memcmp(plain, data, DATA_BLOCKS * sizeof(BYTE)) == 0,
+              "CBC_decryptChunked restores the plaintext");
+        poolFree(plain);
+        freeChunkedContainer(&loaded);
+    }
+
+    BYTE out[CHUNK_BLOCKS], expect[CHUNK_BLOCKS];
+    int chunkOk = 1, cbcOk = 1;
+    for (size_t i = 0; i < container.chunkCount; i++)
+    {
+        size_t n = container.chunkSizes[i];
+        chunkOk &= CBC_decryptChunk(des, &container, TEST_IV, i, out) &&
+                   memcmp(out, data + i * CHUNK_BLOCKS, n * sizeof(BYTE)) == 0;
+        BYTE state = chunkedDeriveIV(des, TEST_IV, i);
+        memcpy(expect, data + i * CHUNK_BLOCKS, n * sizeof(BYTE));
+        cbcOk &= DES_encryptInPlace(des, expect, n, CBC, &state) &&
+                 memcmp(expect, container.data + i * CHUNK_BLOCKS, n * sizeof(BYTE)) == 0;
+    }
+    check(chunkOk, "CBC_decryptChunk on each chunk, including the short one");
+    check(cbcOk, "each chunk is CBC under E_K(IV ^ index)");
+    check(!CBC_decryptChunk(des, &container, TEST_IV, container.chunkCount, out), "CBC_decryptChunk rejects an index past the end");
+    freeChunkedContainer(&container);
+}
+
+// 把伪造的原始BYTE写成容器文件, readChunkedFile 应拒绝
+static int rejects(const BYTE *raw, size_t count)
+{
+    ChunkedContainer container;
+    if (!writeHexFile(path, raw, count))
+        return 0;
+    if (readChunkedFile(path, &container))
+    {
+        freeChunkedContainer(&container);
+        return 0;
+    }
+    return 1;
+}
+
+static void testCorrupted(DES *des, const BYTE *data)
+{
+    // 合法容器: 3块, 每块2个BYTE, 最后一块1个
+    BYTE raw[4 + 3 + 5] = {CHUNKED_MAGIC, 2, 3, 5, 2, 2, 1};
+    memcpy(raw + 7, data, 5 * sizeof(BYTE));
+    ChunkedContainer container;
+    int ok = writeHexFile(path, raw, 12) && readChunkedFile(path, &container);
+    if (ok)
+    {
+        BYTE out[2];
+        ok = CBC_decryptChunk(des, &container, TEST_IV, 2, out);
+        freeChunkedContainer(&container);
+    }
+    check(ok, "hand-built container is accepted");
+
+    check(rejects(raw, 11), "truncated ciphertext is rejected");
+    check(rejects(raw, 5), "truncated chunk index is rejected");
+    BYTE shortIndex[4 + 2 + 5] = {CHUNKED_MAGIC, 2, 3, 5, 2, 2};
+    memcpy(shortIndex + 6, data, 5 * sizeof(BYTE));
+    check(rejects(shortIndex, 11), "index with a missing entry is rejected");
+    BYTE unevenIndex[4 + 3 + 5] = {CHUNKED_MAGIC, 2, 3, 5, 1, 2, 2};
+    memcpy(unevenIndex + 7, data, 5 * sizeof(BYTE));
+    check(rejects(unevenIndex, 12), "short chunk before the last one is rejected");
+
+    // 块长之和按64位回绕后恰好等于总长
+    BYTE wrap[4 + 2 + 1] = {CHUNKED_MAGIC, 1ULL << 62, 2, 1, 1ULL << 62, 1ULL << 62, data[0]};
+    check(rejects(wrap, 7), "chunk sizes near 2^62 are rejected");
+    BYTE wrap2[4 + 3 + 1] = {CHUNKED_MAGIC, 1ULL << 63, 3, 1, 1ULL << 63, 1ULL << 63, 1, data[0]};
+    check(rejects(wrap2, 8), "chunk sizes that wrap to the total are rejected");
+    BYTE hugeCount[4 + 1] = {CHUNKED_MAGIC, 1, ~0ULL, 0, 1};
+    check(rejects(hugeCount, 5), "chunk count larger than the file is rejected");
+}
+
+int main(void)
+{
+    snprintf(path, sizeof(path), "/tmp/deschunkedtest-%d.txt", (int)getpid());
+    BYTE *data = (BYTE *)poolAlloc(DATA_BLOCKS * sizeof(BYTE));
+    DES *des = DES_create();
+    if (!data || !des || !DES_init(des, TEST_KEY))
+    {
+        fprintf(stderr, "Error: Unable to set up the test\n");
+        return 1;
+    }
+    srand(1);
+    for (size_t i = 0; i < DATA_BLOCKS; i++)
+        data[i] = ((BYTE)rand() << 40) ^ ((BYTE)rand() << 20) ^ (BYTE)rand();
+
+    testRoundTrip(des, data);
+    testCorrupted(des, data);
+
+    unlink(path);
+    DES_destroy(des);
+    poolFree(data);
+    printf("%s\n", failures ? "chunked tests FAILED" : "chunked tests passed");
+    return failures ? 1 : 0;
+}
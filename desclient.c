@@ -0,0 +1,447 @@
+// 服务模式的本地客户端与压测工具
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "DES.h"
+#include "enum.h"
+#include "util.h"
+#include "pool.h"
+#include "service.h"
+#include "shmring.h"
+
+static void printClientUsage()
+{
+    printf("Usage: desclient -s socket -m mode [-i keyid] [-v ivfile] [-d] -p infile -c outfile\n");
+    printf("       desclient -s socket -S\n");
+    printf("       desclient -s socket -B -m mode [-i keyid] [-j connections] [-n requests] [-l bytes] [-d]\n");
+    printf("       desclient -r ringname -B -m mode [-j producers] [-n requests] [-l bytes] [-d]\n");
+    printf("Options:\n");
+    printf("  -s socket      Path of the e1des service socket\n");
+    printf("  -r ringname    Benchmark the shared-memory ring of e1des -r instead\n");
+    printf("  -m mode        Encryption mode (ECB, CBC, CFB, OFB)\n");
+    printf("  -i keyid       Key id registered in the service (default 0)\n");
+    printf("  -v ivfile      IV file (16 hex chars)\n");
+    printf("  -p infile      Input file (hex text)\n");
+    printf("  -c outfile     Output file (hex text)\n");
+    printf("  -d             Decrypt\n");
+    printf("  -S             Print service statistics\n");
+    printf("  -B             Run the load generator\n");
+    printf("  -j connections Concurrent connections for -B (default 4)\n");
+    printf("  -n requests    Requests per connection for -B (default 10000)\n");
+    printf("  -l bytes       Payload size for -B (default 64)\n");
+}
+
+static int connectService(const char *socketPath)
+{
+    struct sockaddr_un addr;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || strlen(socketPath) >= sizeof(addr.sun_path))
+    {
+        if (fd >= 0)
+            close(fd);
+        fprintf(stderr, "Error: Unable to create socket\n");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socketPath);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+    {
+        fprintf(stderr, "Error: Unable to connect to %s\n", socketPath);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 发送一个请求并接收响应. 结果写入 out (调用者释放), 返回响应状态, 通信失败返回-1
+static int serviceCall(int fd, const ServiceRequest *req, const unsigned char *payload,
+                       unsigned char **out, uint32_t *outLen)
+{
+    ServiceResponse resp;
+    if (!serviceWriteFull(fd, req, sizeof(*req)) || !serviceWriteFull(fd, payload, req->length) ||
+        !serviceReadFull(fd, &resp, sizeof(resp)) || resp.magic != SERVICE_RESPONSE_MAGIC)
+        return -1;
+    unsigned char *buf = (unsigned char *)malloc(resp.length ? resp.length : 1);
+    if (!buf || !serviceReadFull(fd, buf, resp.length))
+    {
+        free(buf);
+        return -1;
+    }
+    *out = buf;
+    *outLen = resp.length;
+    return resp.status;
+}
+
+typedef struct
+{
+    const char *socketPath;
+    ShmRing *ring; // 非空时通过共享内存环提交
+    ServiceRequest req;
+    size_t requests;
+    uint64_t *latencies; // 每个请求的往返时间(纳秒)
+    size_t completed;
+    int failed;
+} BenchThread;
+
+static uint64_t nowNanos()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#ifdef __linux__
+// 共享内存环压测: 每次把负载写入槽位, 提交后等待原地处理完成
+static void *ringBenchMain(void *arg)
+{
+    BenchThread *bt = (BenchThread *)arg;
+    unsigned char *payload = (unsigned char *)malloc(bt->req.length ? bt->req.length : 1);
+    if (!payload)
+    {
+        bt->failed = 1;
+        return NULL;
+    }
+    for (size_t i = 0; i < bt->req.length; i++)
+        payload[i] = (unsigned char)rand();
+
+    for (size_t i = 0; i < bt->requests; i++)
+    {
+        uint64_t start = nowNanos(), ticket;
+        void *data;
+        ShmRingSlot *slot = shmRingAcquire(bt->ring, &ticket, &data);
+        memcpy(data, payload, bt->req.length);
+        slot->mode = bt->req.mode;
+        slot->decrypt = bt->req.decrypt;
+        // CFB/OFB 与命令行一致使用8位反馈
+        slot->flags = (bt->req.mode == CFB || bt->req.mode == OFB) ? SHMRING_FLAG_FEEDBACK8 : 0;
+        slot->length = bt->req.length;
+        slot->iv = bt->req.iv;
+        if (!shmRingSubmit(bt->ring, ticket))
+        {
+            bt->failed = 1;
+            break;
+        }
+        int status = shmRingWait(bt->ring, ticket);
+        shmRingRelease(bt->ring, ticket);
+        bt->latencies[i] = nowNanos() - start;
+        if (status != 0)
+        {
+            bt->failed = 1;
+            break;
+        }
+        bt->completed++;
+    }
+    free(payload);
+    return NULL;
+}
+#endif
+
+static void *benchMain(void *arg)
+{
+    BenchThread *bt = (BenchThread *)arg;
+#ifdef __linux__
+    if (bt->ring)
+        return ringBenchMain(arg);
+#endif
+    int fd = connectService(bt->socketPath);
+    unsigned char *payload = (unsigned char *)malloc(bt->req.length ? bt->req.length : 1);
+    if (fd < 0 || !payload)
+    {
+        bt->failed = 1;
+        free(payload);
+        if (fd >= 0)
+            close(fd);
+        return NULL;
+    }
+    for (size_t i = 0; i < bt->req.length; i++)
+        payload[i] = (unsigned char)rand();
+
+    for (size_t i = 0; i < bt->requests; i++)
+    {
+        unsigned char *out = NULL;
+        uint32_t outLen = 0;
+        uint64_t start = nowNanos();
+        int status = serviceCall(fd, &bt->req, payload, &out, &outLen);
+        bt->latencies[i] = nowNanos() - start;
+        free(out);
+        if (status != SERVICE_OK)
+        {
+            bt->failed = 1;
+            break;
+        }
+        bt->completed++;
+    }
+    free(payload);
+    close(fd);
+    return NULL;
+}
+
+static int compareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int runBench(const char *socketPath, ShmRing *ring, const ServiceRequest *req, int connections, size_t requests)
+{
+    BenchThread *bts = (BenchThread *)calloc(connections, sizeof(BenchThread));
+    pthread_t *threads = (pthread_t *)malloc(connections * sizeof(pthread_t));
+    uint64_t *latencies = (uint64_t *)malloc((size_t)connections * requests * sizeof(uint64_t));
+    if (!bts || !threads || !latencies)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        free(bts);
+        free(threads);
+        free(latencies);
+        return 1;
+    }
+
+    uint64_t start = nowNanos();
+    int started = 0;
+    for (; started < connections; started++)
+    {
+        bts[started].socketPath = socketPath;
+        bts[started].ring = ring;
+        bts[started].req = *req;
+        bts[started].requests = requests;
+        bts[started].latencies = latencies + (size_t)started * requests;
+        if (pthread_create(&threads[started], NULL, benchMain, &bts[started]) != 0)
+            break;
+    }
+    for (int t = 0; t < started; t++)
+        pthread_join(threads[t], NULL);
+    double seconds = (nowNanos() - start) / 1e9;
+
+    // 汇总各连接已完成请求的延迟
+    size_t total = 0;
+    int failed = started < connections;
+    for (int t = 0; t < started; t++)
+    {
+        memmove(latencies + total, bts[t].latencies, bts[t].completed * sizeof(uint64_t));
+        total += bts[t].completed;
+        failed |= bts[t].failed;
+    }
+    qsort(latencies, total, sizeof(uint64_t), compareU64);
+
+    printf("Connections: %d, payload: %u bytes, requests: %zu\n", started, req->length, total);
+    if (total > 0)
+    {
+        printf("Throughput: %.0f req/s, %.2f MB/s\n", total / seconds,
+               (double)total * req->length / seconds / (1024 * 1024));
+        printf("Latency (us): p50 %.1f, p90 %.1f, p99 %.1f, max %.1f\n",
+               latencies[total / 2] / 1e3, latencies[total * 9 / 10] / 1e3,
+               latencies[total * 99 / 100] / 1e3, latencies[total - 1] / 1e3);
+    }
+    if (failed)
+        fprintf(stderr, "Error: Some requests failed\n");
+
+    free(bts);
+    free(threads);
+    free(latencies);
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    char *socketPath = NULL, *ringName = NULL, *modeName = NULL, *ivFilePath = NULL;
+    char *inPath = NULL, *outPath = NULL;
+    bool decrypt = false, stats = false, bench = false;
+    uint32_t keyId = 0;
+    int connections = 4;
+    size_t requests = 10000;
+    uint32_t payloadSize = 64;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:r:m:i:v:p:c:dSBj:n:l:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            socketPath = optarg;
+            break;
+        case 'r':
+            ringName = optarg;
+            break;
+        case 'm':
+            modeName = optarg;
+            break;
+        case 'i':
+            keyId = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'v':
+            ivFilePath = optarg;
+            break;
+        case 'p':
+            inPath = optarg;
+            break;
+        case 'c':
+            outPath = optarg;
+            break;
+        case 'd':
+            decrypt = true;
+            break;
+        case 'S':
+            stats = true;
+            break;
+        case 'B':
+            bench = true;
+            break;
+        case 'j':
+            connections = atoi(optarg);
+            break;
+        case 'n':
+            requests = strtoull(optarg, NULL, 10);
+            break;
+        case 'l':
+            payloadSize = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'h':
+            printClientUsage();
+            return 0;
+        default:
+            printClientUsage();
+            return 1;
+        }
+    }
+
+    // 共享内存环只用于压测
+    bool ringBench = ringName != NULL && bench;
+    if ((socketPath == NULL && !ringBench) || (!stats && (modeName == NULL || (!bench && (inPath == NULL || outPath == NULL)))))
+    {
+        fprintf(stderr, "Error: Missing required arguments\n");
+        printClientUsage();
+        return 1;
+    }
+
+    ServiceRequest req;
+    memset(&req, 0, sizeof(req));
+    req.magic = SERVICE_REQUEST_MAGIC;
+
+    if (stats)
+    {
+        int fd = connectService(socketPath);
+        if (fd < 0)
+            return 1;
+        unsigned char *out = NULL;
+        uint32_t outLen = 0;
+        req.op = SERVICE_OP_STATS;
+        int status = serviceCall(fd, &req, NULL, &out, &outLen);
+        close(fd);
+        if (status != SERVICE_OK)
+        {
+            fprintf(stderr, "Error: Stats request failed\n");
+            free(out);
+            return 1;
+        }
+        fwrite(out, 1, outLen, stdout);
+        free(out);
+        return 0;
+    }
+
+    int parsedMode = parseMode(modeName);
+    if (parsedMode < 0)
+    {
+        fprintf(stderr, "Error: Unsupported encryption mode: %s\n", modeName);
+        return 1;
+    }
+    EncryptionMode mode = (EncryptionMode)parsedMode;
+    req.op = SERVICE_OP_CRYPT;
+    req.mode = (uint8_t)mode;
+    req.decrypt = decrypt;
+    req.keyId = keyId;
+    if (ivFilePath != NULL)
+    {
+        size_t ivSize = 0;
+        BYTE *iv = readHexFile(ivFilePath, &ivSize);
+        if (!iv || ivSize != 1)
+        {
+            fprintf(stderr, "Error: IV must be 16 hexadecimal characters (64 bits)\n");
+            poolFree(iv);
+            return 1;
+        }
+        req.iv = iv[0];
+        poolFree(iv);
+    }
+
+    if (bench)
+    {
+        if (connections <= 0 || requests == 0 || ((mode == ECB || mode == CBC) && payloadSize % 8 != 0))
+        {
+            fprintf(stderr, "Error: Invalid benchmark parameters\n");
+            return 1;
+        }
+        req.length = payloadSize;
+        if (ringName == NULL)
+            return runBench(socketPath, NULL, &req, connections, requests);
+        ShmRing *ring = shmRingAttach(ringName);
+        if (!ring)
+            return 1;
+        if (payloadSize > shmRingSlotBytes(ring))
+        {
+            fprintf(stderr, "Error: Payload exceeds ring slot size (%u bytes)\n", shmRingSlotBytes(ring));
+            shmRingClose(ring);
+            return 1;
+        }
+        int benchRet = runBench(NULL, ring, &req, connections, requests);
+        shmRingClose(ring);
+        return benchRet;
+    }
+
+    size_t inSize = 0;
+    unsigned char *in = readHexFile8(inPath, &inSize);
+    if (!in)
+    {
+        fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+        return 1;
+    }
+    // ECB/CBC 与 e1des 一致: 最后不足8字节的块补0
+    size_t sendSize = inSize;
+    if ((mode == ECB || mode == CBC) && sendSize % 8 != 0)
+    {
+        sendSize += 8 - sendSize % 8;
+        unsigned char *padded = (unsigned char *)poolRealloc(in, sendSize);
+        if (!padded)
+        {
+            poolFree(in);
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            return 1;
+        }
+        memset(padded + inSize, 0, sendSize - inSize);
+        in = padded;
+    }
+    req.length = (uint32_t)sendSize;
+
+    int fd = connectService(socketPath);
+    if (fd < 0)
+    {
+        poolFree(in);
+        return 1;
+    }
+    unsigned char *out = NULL;
+    uint32_t outLen = 0;
+    int status = serviceCall(fd, &req, in, &out, &outLen);
+    close(fd);
+    poolFree(in);
+
+    int ret = 1;
+    if (status == SERVICE_OK && writeHexByteFile(outPath, out, outLen))
+    {
+        printf("%s complete, output written to: %s\n", decrypt ? "Decryption" : "Encryption", outPath);
+        ret = 0;
+    }
+    else
+    {
+        fprintf(stderr, "Error: Service request failed (status %d)\n", status);
+    }
+    free(out);
+    return ret;
+}
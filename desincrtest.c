@@ -0,0 +1,201 @@
+// 增量加密 (incr.h) 的自检: ECB 与分块CBC在修改一个字节、变长、变短(截断密文文件)、
+// 清单过期或损坏之后, 输出都与完整加密逐字节相同, 且只有应当重写的分块被重写. 任一检查失败时返回1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "DES.h"
+#include "workMode.h"
+#include "util.h"
+#include "pool.h"
+#include "incr.h"
+
+#define TEST_KEY 0x133457799BBCDFF1ULL
+#define OTHER_KEY 0x0E329232EA6D0D73ULL
+#define TEST_IV 0x0123456789ABCDEFULL
+// 分块大小与初始明文长度: 10个整块加一个不满8字节对齐的尾块
+#define CHUNK_BYTES 4096
+#define DATA_BYTES (10 * CHUNK_BYTES + 1003)
+#define MAX_BYTES (DATA_BYTES + 2 * CHUNK_BYTES)
+
+static int failures = 0;
+static char plainPath[64], outPath[64], refPath[64], manifestPath[96];
+
+static void check(int ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "OK" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+static int sameFile(const char *a, const char *b)
+{
+    FILE *fa = fopen(a, "rb");
+    FILE *fb = fopen(b, "rb");
+    int same = fa && fb;
+    while (same)
+    {
+        int ca = fgetc(fa), cb = fgetc(fb);
+        same = ca == cb;
+        if (ca == EOF)
+            break;
+    }
+    if (fa)
+        fclose(fa);
+    if (fb)
+        fclose(fb);
+    return same;
+}
+
+// 完整加密到 refPath: ECB 密文或分块CBC容器
+static int writeReference(DES *des, bool chunked, const unsigned char *plain, size_t length)
+{
+    size_t n = (length + 7) / 8;
+    BYTE *blocks = (BYTE *)poolAlloc((n ? n : 1) * sizeof(BYTE));
+    if (!blocks)
+        return 0;
+    bytesToBlocks(plain, length, blocks);
+    int ok;
+    if (chunked)
+    {
+        ChunkedContainer container;
+        ok = CBC_encryptChunked(des, blocks, n, des->iv, CHUNK_BYTES / 8, 2, &container) &&
+             writeChunkedFile(refPath, &container);
+        freeChunkedContainer(&container);
+    }
+    else
+    {
+        BYTE state = 0;
+        ok = DES_encryptInPlace(des, blocks, n, ECB, &state) && writeHexFile(refPath, blocks, n);
+    }
+    poolFree(blocks);
+    return ok;
+}
+
+// 写入明文后增量加密, 输出须与完整加密相同, 重写的分块数与是否整体重写须符合预期
+static int step(DES *des, bool chunked, const unsigned char *plain, size_t length, size_t rewritten, bool full)
+{
+    IncrStats stats;
+    if (!writeHexByteFile(plainPath, plain, length) ||
+        !incrementalProcessFile(des, chunked, false, CHUNK_BYTES, plainPath, outPath, NULL, &stats) ||
+        !writeReference(des, chunked, plain, length))
+        return 0;
+    return sameFile(outPath, refPath) && stats.rewritten == rewritten && stats.full == full &&
+           stats.chunks == (length + CHUNK_BYTES - 1) / CHUNK_BYTES;
+}
+
+static void testFormat(DES *des, DES *other, bool chunked, unsigned char *plain)
+{
+    const char *name = chunked ? "chunked CBC" : "ECB";
+    char what[96];
+    unlink(outPath);
+    unlink(manifestPath);
+    size_t length = DATA_BYTES;
+    size_t chunks = (length + CHUNK_BYTES - 1) / CHUNK_BYTES;
+
+    snprintf(what, sizeof(what), "%s: first run encrypts everything", name);
+    check(step(des, chunked, plain, length, chunks, true), what);
+    snprintf(what, sizeof(what), "%s: unchanged input rewrites nothing", name);
+    check(step(des, chunked, plain, length, 0, false), what);
+
+    plain[3 * CHUNK_BYTES + 17] ^= 0x5A;
+    snprintf(what, sizeof(what), "%s: one-byte edit rewrites one chunk", name);
+    check(step(des, chunked, plain, length, 1, false), what);
+
+    // 修改一个字节并在最后一块内变长: 块数不变
+    plain[CHUNK_BYTES + 1] ^= 0xA5;
+    length += 500;
+    snprintf(what, sizeof(what), "%s: edit plus growth inside the last chunk", name);
+    check(step(des, chunked, plain, length, 2, false), what);
+
+    // 跨过分块边界变长: ECB 只写新分块, 分块CBC的块索引变长, 整体重写
+    length += 2 * CHUNK_BYTES;
+    chunks = (length + CHUNK_BYTES - 1) / CHUNK_BYTES;
+    snprintf(what, sizeof(what), "%s: growth across chunk boundaries", name);
+    check(chunked ? step(des, chunked, plain, length, chunks, true) : step(des, chunked, plain, length, 3, false), what);
+
+    // 在最后一块内变短: 密文文件被截断
+    length -= 777;
+    snprintf(what, sizeof(what), "%s: shrink inside the last chunk truncates", name);
+    check(step(des, chunked, plain, length, 1, false), what);
+
+    // 跨过分块边界变短
+    length -= CHUNK_BYTES + 5;
+    chunks = (length + CHUNK_BYTES - 1) / CHUNK_BYTES;
+    snprintf(what, sizeof(what), "%s: shrink across a chunk boundary", name);
+    check(chunked ? step(des, chunked, plain, length, chunks, true) : step(des, chunked, plain, length, 1, false), what);
+
+    // 过期清单: 用另一个密钥加密后, 再用原密钥加密相同明文
+    IncrStats stats;
+    int ok = incrementalProcessFile(other, chunked, false, CHUNK_BYTES, plainPath, outPath, NULL, &stats);
+    snprintf(what, sizeof(what), "%s: manifest from another key is not reused", name);
+    check(ok && step(des, chunked, plain, length, chunks, true), what);
+
+    // 过期清单: 密文文件被别的内容覆盖, 大小与清单不符
+    FILE *fp = fopen(outPath, "w");
+    ok = fp && fputs("0123456789ABCDEF", fp) >= 0;
+    if (fp)
+        fclose(fp);
+    snprintf(what, sizeof(what), "%s: ciphertext size mismatch forces a rewrite", name);
+    check(ok && step(des, chunked, plain, length, chunks, true), what);
+
+    // 损坏的清单: 丢掉最后一行散列, 再追加一行无法识别的内容
+    char text[64 * 1024];
+    size_t size = 0;
+    fp = fopen(manifestPath, "r");
+    if (fp)
+    {
+        size = fread(text, 1, sizeof(text), fp);
+        fclose(fp);
+    }
+    ok = size > 0 && size < sizeof(text);
+    if (ok)
+    {
+        size_t end = size - 1;
+        while (end > 0 && text[end - 1] != '\n')
+            end--;
+        fp = fopen(manifestPath, "w");
+        ok = fp && fwrite(text, 1, end, fp) == end && fputs("hash ???\n", fp) >= 0;
+        if (fp)
+            fclose(fp);
+    }
+    snprintf(what, sizeof(what), "%s: damaged manifest forces a rewrite", name);
+    check(ok && step(des, chunked, plain, length, chunks, true), what);
+
+    plain[CHUNK_BYTES + 1] ^= 0xA5;
+    plain[3 * CHUNK_BYTES + 17] ^= 0x5A;
+}
+
+int main(void)
+{
+    snprintf(plainPath, sizeof(plainPath), "/tmp/desincrtest-%d-plain.txt", (int)getpid());
+    snprintf(outPath, sizeof(outPath), "/tmp/desincrtest-%d-out.txt", (int)getpid());
+    snprintf(refPath, sizeof(refPath), "/tmp/desincrtest-%d-ref.txt", (int)getpid());
+    snprintf(manifestPath, sizeof(manifestPath), "%s%s", outPath, INCR_MANIFEST_SUFFIX);
+    unsigned char *plain = (unsigned char *)poolAlloc(MAX_BYTES);
+    DES *des = DES_create();
+    DES *other = DES_create();
+    if (!plain || !des || !other || !DES_init(des, TEST_KEY) || !DES_init(other, OTHER_KEY))
+    {
+        fprintf(stderr, "Error: Unable to set up the test\n");
+        return 1;
+    }
+    des->iv = TEST_IV;
+    other->iv = TEST_IV;
+    srand(1);
+    for (size_t i = 0; i < MAX_BYTES; i++)
+        plain[i] = (unsigned char)rand();
+
+    testFormat(des, other, false, plain);
+    testFormat(des, other, true, plain);
+
+    unlink(plainPath);
+    unlink(outPath);
+    unlink(refPath);
+    unlink(manifestPath);
+    DES_destroy(des);
+    DES_destroy(other);
+    poolFree(plain);
+    printf("%s\n", failures ? "incremental tests FAILED" : "incremental tests passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,173 @@
+// 已知明文攻击的DES密钥穷举搜索工具
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <getopt.h>
+#include "DES.h"
+#include "util.h"
+#include "pool.h"
+#include "keysearch.h"
+
+// -a 时最多报告的候选密钥数
+#define MAX_CANDIDATES 16
+
+static void printSearchUsage()
+{
+    printf("Usage: deskeysearch -p plainfile -c cipherfile [-s start] [-e end] [-t threads] [-o checkpoint] [-i seconds] [-a]\n");
+    printf("       deskeysearch -p plainfile -c cipherfile -k hintkeyfile -w bits [...]\n");
+    printf("Options:\n");
+    printf("  -p plainfile   Known plaintext (hex, first 64-bit block is used)\n");
+    printf("  -c cipherfile  Matching ciphertext (hex, ECB, first 64-bit block is used)\n");
+    printf("  -s start       First key index to test (hex, 56-bit, default 0)\n");
+    printf("  -e end         End of the key index range, exclusive (hex, default 100000000000000)\n");
+    printf("  -k keyfile     Hint key: search the aligned 2^bits window that contains it\n");
+    printf("  -w bits        Window width for -k (1-56)\n");
+    printf("  -t threads     Search threads (default: all cores)\n");
+    printf("  -o checkpoint  Checkpoint file; resumed automatically when it exists\n");
+    printf("  -i seconds     Progress interval (default 5, 0 = quiet)\n");
+    printf("  -a             Keep searching after the first match\n");
+    printf("Key indices number the 56 non-parity key bits, most significant first.\n");
+}
+
+static volatile sig_atomic_t searchStop = 0;
+
+static void searchSignal(int sig)
+{
+    (void)sig;
+    searchStop = 1;
+}
+
+// 读取文件中的第一个64位块
+static int readFirstBlock(const char *path, BYTE *block)
+{
+    size_t size;
+    BYTE *data = readHexFile(path, &size);
+    if (!data || size == 0)
+    {
+        fprintf(stderr, "Error: Unable to read a block from %s\n", path);
+        poolFree(data);
+        return 0;
+    }
+    *block = data[0];
+    poolFree(data);
+    return 1;
+}
+
+static int parseIndex(const char *text, uint64_t *value)
+{
+    char *end;
+    unsigned long long v = strtoull(text, &end, 16);
+    if (*text == '\0' || *end != '\0' || v > KEYSEARCH_SPACE)
+    {
+        fprintf(stderr, "Error: Invalid key index: %s\n", text);
+        return 0;
+    }
+    *value = v;
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *plainPath = NULL, *cipherPath = NULL, *hintPath = NULL;
+    KeySearchParams params;
+    memset(&params, 0, sizeof(params));
+    params.end = KEYSEARCH_SPACE;
+    params.progressInterval = 5;
+    int windowBits = 0, all = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "p:c:s:e:k:w:t:o:i:ah")) != -1)
+    {
+        switch (opt)
+        {
+        case 'p':
+            plainPath = optarg;
+            break;
+        case 'c':
+            cipherPath = optarg;
+            break;
+        case 's':
+            if (!parseIndex(optarg, &params.start))
+                return 1;
+            break;
+        case 'e':
+            if (!parseIndex(optarg, &params.end))
+                return 1;
+            break;
+        case 'k':
+            hintPath = optarg;
+            break;
+        case 'w':
+            windowBits = atoi(optarg);
+            break;
+        case 't':
+            params.threads = atoi(optarg);
+            break;
+        case 'o':
+            params.checkpointPath = optarg;
+            break;
+        case 'i':
+            params.progressInterval = atoi(optarg);
+            break;
+        case 'a':
+            all = 1;
+            break;
+        case 'h':
+            printSearchUsage();
+            return 0;
+        default:
+            printSearchUsage();
+            return 1;
+        }
+    }
+    if (!plainPath || !cipherPath)
+    {
+        printSearchUsage();
+        return 1;
+    }
+    if (!readFirstBlock(plainPath, &params.plaintext) || !readFirstBlock(cipherPath, &params.ciphertext))
+        return 1;
+
+    if (hintPath)
+    {
+        BYTE hint;
+        if (windowBits < 1 || windowBits > 56)
+        {
+            fprintf(stderr, "Error: -k requires -w between 1 and 56\n");
+            return 1;
+        }
+        if (!readFirstBlock(hintPath, &hint))
+            return 1;
+        uint64_t size = 1ULL << windowBits;
+        params.start = keyToIndex(hint) & ~(size - 1);
+        params.end = params.start + size;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = searchSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    params.stop = &searchStop;
+
+    printf("Searching key indices %014llX - %014llX\n",
+           (unsigned long long)params.start, (unsigned long long)params.end);
+    fflush(stdout);
+    BYTE found[MAX_CANDIDATES];
+    int count = keySearch(&params, found, all ? MAX_CANDIDATES : 1);
+    if (count < 0)
+        return 1;
+    for (int i = 0; i < count; i++)
+    {
+        printf("Found key: %016llX (index %014llX)\n", found[i], (unsigned long long)keyToIndex(found[i]));
+    }
+    if (searchStop)
+    {
+        printf("Interrupted%s\n", params.checkpointPath ? ", checkpoint saved" : "");
+        return 2;
+    }
+    if (count == 0)
+        printf("No key found in range\n");
+    return count > 0 ? 0 : 3;
+}
@@ -0,0 +1,164 @@
+// 密钥搜索 (keysearch.h) 的自检: 位切片批量测试与 DES_encryptBlock 一致, 索引与密钥互转,
+// 以及检查点的写入与恢复. 任一检查失败时返回1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "DES.h"
+#include "keysearch.h"
+
+// 随机抽查的密钥个数
+#define RANDOM_KEYS 16
+// 检查点测试的区间大小, 目标密钥位于中间
+#define CHECKPOINT_SPAN (1ULL << 18)
+
+static int failures = 0;
+
+static void check(int ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "OK" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+static BYTE randomBlock()
+{
+    return ((BYTE)rand() << 42) ^ ((BYTE)rand() << 21) ^ (BYTE)rand();
+}
+
+static BYTE encryptWith(DES *des, BYTE key, BYTE plain)
+{
+    DES_init(des, key);
+    return DES_encryptBlock(des, plain);
+}
+
+// 对随机密钥, keySearchBatch 在该密钥所在的64个一批中置位; 每个置位的密钥确实把明文加密为密文
+static void testBatch(DES *des)
+{
+    int indexOk = 1, hitOk = 1, exactOk = 1, missOk = 1;
+    for (int i = 0; i < RANDOM_KEYS; i++)
+    {
+        uint64_t index = randomBlock() & (KEYSEARCH_SPACE - 1);
+        BYTE key = keyIndexToKey(index);
+        indexOk &= keyToIndex(key) == index && keyToIndex(key ^ 0x0101010101010101ULL) == index;
+
+        BYTE plain = randomBlock();
+        BYTE cipher = encryptWith(des, key, plain);
+        uint64_t base = index & ~63ULL;
+        uint64_t mask = keySearchBatch(plain, cipher, base);
+        hitOk &= (mask >> (index - base)) & 1;
+        for (uint64_t m = mask; m; m &= m - 1)
+        {
+            uint64_t hit = base + __builtin_ctzll(m);
+            exactOk &= encryptWith(des, keyIndexToKey(hit), plain) == cipher;
+        }
+        // 相邻一批不含该密钥
+        uint64_t other = base ^ 64;
+        uint64_t otherMask = keySearchBatch(plain, cipher, other);
+        for (uint64_t m = otherMask; m; m &= m - 1)
+        {
+            missOk &= encryptWith(des, keyIndexToKey(other + __builtin_ctzll(m)), plain) == cipher;
+        }
+    }
+    check(indexOk, "keyIndexToKey/keyToIndex round trip, parity ignored");
+    check(hitOk, "keySearchBatch flags the key used by DES_encryptBlock");
+    check(exactOk, "every keySearchBatch match encrypts plain to cipher");
+    check(missOk, "keySearchBatch on a neighbouring batch has no false match");
+}
+
+static int writeText(const char *path, const char *text)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp)
+        return 0;
+    int ok = fputs(text, fp) >= 0;
+    return fclose(fp) == 0 && ok;
+}
+
+// 读取检查点中的 next 行, 失败返回 UINT64_MAX
+static uint64_t checkpointNext(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return UINT64_MAX;
+    char line[256];
+    unsigned long long next;
+    uint64_t result = UINT64_MAX;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (sscanf(line, "next %llx", &next) == 1)
+            result = next;
+    }
+    fclose(fp);
+    return result;
+}
+
+// 中断后写入检查点, 恢复后找到同一密钥; 已完成的检查点直接给出结果;
+// 恢复点越过密钥时不再重复搜索; 与本次搜索不符的检查点被拒绝
+static void testCheckpoint(DES *des)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/deskeysearchtest-%d.ckpt", (int)getpid());
+    unlink(path);
+
+    uint64_t index = randomBlock() & (KEYSEARCH_SPACE - 1) & ~(CHECKPOINT_SPAN - 1);
+    index += CHECKPOINT_SPAN / 2 + 5;
+    BYTE key = keyIndexToKey(index);
+    BYTE plain = randomBlock();
+
+    volatile sig_atomic_t stop = 1;
+    KeySearchParams params;
+    memset(&params, 0, sizeof(params));
+    params.plaintext = plain;
+    params.ciphertext = encryptWith(des, key, plain);
+    params.start = index - CHECKPOINT_SPAN / 2;
+    params.end = index + CHECKPOINT_SPAN / 2;
+    params.threads = 2;
+    params.checkpointPath = path;
+    params.stop = &stop;
+
+    BYTE found[4];
+    int n = keySearch(&params, found, 4);
+    check(n == 0 && checkpointNext(path) == params.start, "stopped search writes a checkpoint at its start");
+
+    stop = 0;
+    n = keySearch(&params, found, 4);
+    check(n >= 1 && found[0] == key && checkpointNext(path) == params.end,
+          "resumed search finds the key and completes the checkpoint");
+
+    memset(found, 0, sizeof(found));
+    n = keySearch(&params, found, 4);
+    check(n >= 1 && found[0] == key, "completed checkpoint reports the key again");
+
+    // 手写一个恢复点已越过密钥且未记录结果的检查点: 恢复后只搜索剩余部分
+    char text[512];
+    snprintf(text, sizeof(text),
+             "# e1des key search checkpoint\nplaintext %016llX\nciphertext %016llX\nrange %014llX %014llX\nnext %014llX\n",
+             params.plaintext, params.ciphertext, (unsigned long long)params.start, (unsigned long long)params.end,
+             (unsigned long long)((index + 64) & ~63ULL));
+    n = writeText(path, text) ? keySearch(&params, found, 4) : -1;
+    check(n == 0 && checkpointNext(path) == params.end, "resume skips the range before the checkpoint");
+
+    snprintf(text, sizeof(text), "# e1des key search checkpoint\nplaintext %016llX\nciphertext %016llX\nrange %014llX %014llX\nnext %014llX\n",
+             params.plaintext, params.ciphertext, (unsigned long long)params.start,
+             (unsigned long long)params.end + 64, (unsigned long long)params.start);
+    n = writeText(path, text) ? keySearch(&params, found, 4) : 0;
+    check(n == -1, "checkpoint for another range is rejected");
+    unlink(path);
+}
+
+int main(void)
+{
+    DES *des = DES_create();
+    if (!des)
+    {
+        fprintf(stderr, "Error: Unable to set up the test\n");
+        return 1;
+    }
+    srand(1);
+    testBatch(des);
+    testCheckpoint(des);
+    DES_destroy(des);
+    printf("%s\n", failures ? "key search tests FAILED" : "key search tests passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+// 消息认证码 (mac.h) 的自检: 批量版本与逐条计算结果相同, 以及 ANSI X9.19 的公开测试向量.
+// 消息条数超过一批的通道数 (64), 长度各不相同, 含空消息和8字节整数倍. 任一检查失败时返回1
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "DES.h"
+#include "mac.h"
+
+// 消息条数: 超过64, 最后一批不满
+#define MESSAGES 150
+#define MAX_LENGTH 300
+
+static int failures = 0;
+
+static void check(int ok, const char *what)
+{
+    printf("%-58s %s\n", what, ok ? "OK" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+// 逐条计算的结果与批量结果比较
+static int compareBatch(DES *k1, DES *k2, MacMessage *messages, size_t count, MacPadding pad)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        messages[i].tag = 0;
+    }
+    if (k2)
+        DES_retailMacBatch(k1, k2, messages, count, pad);
+    else
+        DES_cbcMacBatch(k1, messages, count, pad);
+    int ok = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        BYTE expect = k2 ? DES_retailMac(k1, k2, messages[i].data, messages[i].length, pad)
+                         : DES_cbcMac(k1, messages[i].data, messages[i].length, pad);
+        ok &= messages[i].tag == expect;
+    }
+    return ok;
+}
+
+int main(void)
+{
+    DES *k1 = DES_create();
+    DES *k2 = DES_create();
+    unsigned char *data = (unsigned char *)malloc(MESSAGES * MAX_LENGTH);
+    MacMessage *messages = (MacMessage *)calloc(MESSAGES, sizeof(MacMessage));
+    if (!k1 || !k2 || !data || !messages || !DES_init(k1, 0x0123456789ABCDEFULL) ||
+        !DES_init(k2, 0xFEDCBA9876543210ULL))
+    {
+        fprintf(stderr, "Error: Unable to set up the test\n");
+        return 1;
+    }
+
+    // X9.19: "Now is the time for all " 的零售MAC
+    const char *x919 = "Now is the time for all ";
+    check(DES_retailMac(k1, k2, (const unsigned char *)x919, strlen(x919), MAC_PAD_ZERO) == 0xA1C72E74EA3FA9B6ULL,
+          "X9.19 retail MAC vector");
+
+    srand(1);
+    for (size_t i = 0; i < MESSAGES * MAX_LENGTH; i++)
+    {
+        data[i] = (unsigned char)rand();
+    }
+    for (size_t i = 0; i < MESSAGES; i++)
+    {
+        messages[i].data = data + i * MAX_LENGTH;
+        // 前几条覆盖空消息与块边界, 其余随机
+        messages[i].length = i < 4 ? i * 8 : (size_t)rand() % MAX_LENGTH;
+    }
+
+    check(compareBatch(k1, NULL, messages, MESSAGES, MAC_PAD_ZERO), "DES_cbcMacBatch equals DES_cbcMac, pad 1");
+    check(compareBatch(k1, NULL, messages, MESSAGES, MAC_PAD_BIT), "DES_cbcMacBatch equals DES_cbcMac, pad 2");
+    check(compareBatch(k1, k2, messages, MESSAGES, MAC_PAD_ZERO), "DES_retailMacBatch equals DES_retailMac, pad 1");
+    check(compareBatch(k1, k2, messages, MESSAGES, MAC_PAD_BIT), "DES_retailMacBatch equals DES_retailMac, pad 2");
+    check(compareBatch(k1, k2, messages, 1, MAC_PAD_BIT), "DES_retailMacBatch with a single message");
+
+    free(messages);
+    free(data);
+    DES_destroy(k1);
+    DES_destroy(k2);
+    printf("%s\n", failures ? "MAC tests FAILED" : "MAC tests passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+// 大输出流式写入测速: ECB_encrypt/OFB_encrypt 在普通存储与非临时存储(见 workMode.h)下的吞吐率,
+// 以及同时运行的干扰线程在自己的缓存内工作集上的访问速率 (输出挤占缓存时干扰线程变慢)
+// 两者都按各自线程的CPU时间计算, 两个线程共用一个核心时只比较缓存的影响
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <getopt.h>
+#include "DES.h"
+#include "workMode.h"
+#include "pool.h"
+
+// 缓存行大小, 干扰线程按行访问
+#define BENCH_LINE 64
+#define BENCH_MB (1024.0 * 1024.0)
+
+static void printStoreBenchUsage()
+{
+    printf("Usage: desstorebench [-s MB] [-w KB] [-r repeats]\n");
+    printf("Options:\n");
+    printf("  -s MB       Size of the array encrypted per call (default 64)\n");
+    printf("  -w KB       Co-runner working set, should fit the last-level cache (default 2048)\n");
+    printf("  -r repeats  Calls per measurement (default 3)\n");
+}
+
+static double threadSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 干扰线程: 反复按缓存行读取自己的工作集, 统计读取的字节数与所用CPU时间
+typedef struct
+{
+    const unsigned char *buf;
+    size_t size;
+    volatile int stop;
+    unsigned long long bytes;
+    double seconds;
+    unsigned sink;
+} CoRunner;
+
+static void *coRunnerMain(void *arg)
+{
+    CoRunner *cr = (CoRunner *)arg;
+    unsigned sum = 0;
+    unsigned long long bytes = 0;
+    double start = threadSeconds();
+    while (!cr->stop)
+    {
+        for (size_t off = 0; off < cr->size; off += BENCH_LINE)
+        {
+            sum += cr->buf[off];
+        }
+        bytes += cr->size;
+    }
+    cr->seconds = threadSeconds() - start;
+    cr->bytes = bytes;
+    cr->sink = sum;
+    return NULL;
+}
+
+typedef struct
+{
+    double desRate;    // 加密线程 MB/s
+    double coRate;     // 干扰线程 MB/s
+    BYTE *firstOutput; // 第一次调用的输出, 用于核对两种写入方式结果一致
+} StoreResult;
+
+static BYTE *runMode(DES *des, EncryptionMode mode, BYTE *data, size_t blocks)
+{
+    size_t outSize;
+    BYTE iv = des->iv;
+    return mode == OFB ? OFB_encrypt(des, data, blocks, &iv, 1, &outSize) : ECB_encrypt(des, data, blocks, &outSize);
+}
+
+// 在干扰线程运行时调用 repeats 次模式函数. 成功返回1
+static int measure(DES *des, EncryptionMode mode, BYTE *data, size_t blocks, CoRunner *cr, int repeats,
+                   StoreResult *result)
+{
+    pthread_t tid;
+    cr->stop = 0;
+    if (pthread_create(&tid, NULL, coRunnerMain, cr) != 0)
+    {
+        fprintf(stderr, "Error: Unable to start the co-runner thread\n");
+        return 0;
+    }
+    int ok = 1;
+    result->firstOutput = NULL;
+    double start = threadSeconds();
+    for (int r = 0; ok && r < repeats; r++)
+    {
+        BYTE *out = runMode(des, mode, data, blocks);
+        ok = out != NULL;
+        if (r == 0)
+            result->firstOutput = out;
+        else
+            poolFree(out);
+    }
+    double elapsed = threadSeconds() - start;
+    cr->stop = 1;
+    pthread_join(tid, NULL);
+    result->desRate = repeats * blocks * sizeof(BYTE) / elapsed / BENCH_MB;
+    result->coRate = cr->seconds > 0 ? cr->bytes / cr->seconds / BENCH_MB : 0;
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t sizeMB = 64, workKB = 2048;
+    int repeats = 3;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:w:r:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            sizeMB = strtoul(optarg, NULL, 10);
+            break;
+        case 'w':
+            workKB = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            repeats = atoi(optarg);
+            break;
+        case 'h':
+            printStoreBenchUsage();
+            return 0;
+        default:
+            printStoreBenchUsage();
+            return 1;
+        }
+    }
+    if (sizeMB == 0 || workKB == 0 || repeats <= 0)
+    {
+        printStoreBenchUsage();
+        return 1;
+    }
+
+    size_t blocks = sizeMB * 1024 * 1024 / sizeof(BYTE);
+    BYTE *data = (BYTE *)poolAlloc(blocks * sizeof(BYTE));
+    unsigned char *work = (unsigned char *)poolAlloc(workKB * 1024);
+    DES *des = DES_create();
+    if (!data || !work || !des || !DES_init(des, 0x133457799BBCDFF1ULL))
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    des->iv = 0x5072656E74696365ULL;
+    for (size_t i = 0; i < blocks; i++)
+    {
+        data[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+    memset(work, 1, workKB * 1024);
+    CoRunner cr = {work, workKB * 1024, 0, 0, 0, 0};
+
+    printf("%zu MB per call, %d calls, co-runner working set %zu KB, default threshold %u MB\n", sizeMB, repeats,
+           workKB, MODE_STREAMING_DEFAULT_BYTES >> 20);
+    printf("%-4s %-10s %12s %16s\n", "mode", "stores", "des MB/s", "co-runner MB/s");
+    int status = 0;
+    static const EncryptionMode modes[] = {ECB, OFB};
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        StoreResult regular = {0, 0, NULL}, streaming = {0, 0, NULL};
+        modeSetStreamingThreshold(0);
+        int ok = measure(des, modes[m], data, blocks, &cr, repeats, &regular);
+        modeSetStreamingThreshold(1);
+        ok = ok && measure(des, modes[m], data, blocks, &cr, repeats, &streaming);
+        const char *name = modes[m] == OFB ? "OFB" : "ECB";
+        if (!ok)
+        {
+            fprintf(stderr, "Error: %s measurement failed\n", name);
+            status = 1;
+        }
+        else if (memcmp(regular.firstOutput, streaming.firstOutput, blocks * sizeof(BYTE)) != 0)
+        {
+            fprintf(stderr, "Error: %s streaming output differs from regular stores\n", name);
+            status = 1;
+        }
+        else
+        {
+            printf("%-4s %-10s %12.2f %16.2f\n", name, "regular", regular.desRate, regular.coRate);
+            printf("%-4s %-10s %12.2f %16.2f\n", name, "streaming", streaming.desRate, streaming.coRate);
+        }
+        poolFree(regular.firstOutput);
+        poolFree(streaming.firstOutput);
+    }
+    modeSetStreamingThreshold(MODE_STREAMING_DEFAULT_BYTES);
+
+    DES_destroy(des);
+    poolFree(data);
+    poolFree(work);
+    return status;
+}
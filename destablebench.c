@@ -0,0 +1,204 @@
+// 轮函数查表规模测速: 在不同规模的缓存干扰下测量 DES_encryptBlocks 的吞吐率
+// 每种查表规模 (make DES_TABLES=...) 各编译一个可执行文件, 见 Makefile 的 bench-tables 目标
+// -j 时再测一遍密钥专用代码 (jit.h), 与通用实现对比, 见 bench-jit 目标
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <getopt.h>
+#include "DES.h"
+#include "DESTables.h"
+#include "jit.h"
+
+// 每次加密的块数 (16KB, 远小于L1, 测得的差异只来自查表本身与干扰)
+#define BENCH_BLOCKS 2048
+// 缓存行大小, 干扰线程按行访问
+#define BENCH_LINE 64
+
+static void printTableBenchUsage()
+{
+    printf("Usage: destablebench [-t seconds] [-s sizes] [-j]\n");
+    printf("Options:\n");
+    printf("  -t seconds  Measuring time per pressure level (default 1)\n");
+    printf("  -s sizes    Comma-separated co-runner working sets in KB, 0 = none (default 0,256,8192)\n");
+    printf("  -j          Also measure the key-specialized code (x86-64 only)\n");
+    printf("Throughput is measured on the encrypting thread's CPU time, so a co-runner sharing\n");
+    printf("the same core only contributes cache misses, not lost time slices.\n");
+}
+
+// 干扰线程: 不停按缓存行读改写自己的缓冲区, 把加密线程的查表挤出缓存
+typedef struct
+{
+    unsigned char *buf;
+    size_t size;
+    volatile int stop;
+} CoRunner;
+
+static void *coRunnerMain(void *arg)
+{
+    CoRunner *cr = (CoRunner *)arg;
+    while (!cr->stop)
+    {
+        for (size_t off = 0; off < cr->size && !cr->stop; off += BENCH_LINE)
+        {
+            cr->buf[off]++;
+        }
+    }
+    return NULL;
+}
+
+static double threadSeconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 在给定干扰下加密 seconds 秒 (加密线程CPU时间), 返回 MB/s, 失败返回负数
+static double measure(DES *des, BYTE *blocks, size_t pressureKB, double seconds)
+{
+    CoRunner cr = {NULL, pressureKB * 1024, 0};
+    pthread_t tid;
+    if (cr.size > 0)
+    {
+        cr.buf = calloc(1, cr.size);
+        if (!cr.buf)
+        {
+            fprintf(stderr, "Error: Unable to allocate %zu KB for the co-runner\n", pressureKB);
+            return -1;
+        }
+        if (pthread_create(&tid, NULL, coRunnerMain, &cr) != 0)
+        {
+            fprintf(stderr, "Error: Unable to start the co-runner thread\n");
+            free(cr.buf);
+            return -1;
+        }
+    }
+
+    unsigned long long rounds = 0;
+    double start = threadSeconds(), elapsed;
+    do
+    {
+        DES_encryptBlocks(des, blocks, blocks, BENCH_BLOCKS);
+        rounds++;
+        elapsed = threadSeconds() - start;
+    } while (elapsed < seconds);
+
+    if (cr.size > 0)
+    {
+        cr.stop = 1;
+        pthread_join(tid, NULL);
+        free(cr.buf);
+    }
+    return rounds * BENCH_BLOCKS * sizeof(BYTE) / elapsed / (1024.0 * 1024.0);
+}
+
+// 按干扰规模列表依次测量并输出一行结果. 列表格式错误或测量失败返回0
+static int runLevels(DES *des, BYTE *blocks, const char *name, size_t footprint, const char *sizes, double seconds)
+{
+    const char *p = sizes;
+    while (*p)
+    {
+        char *end;
+        unsigned long kb = strtoul(p, &end, 10);
+        if (end == p || (*end && *end != ','))
+        {
+            fprintf(stderr, "Error: Invalid co-runner size list: %s\n", sizes);
+            return 0;
+        }
+        double mbps = measure(des, blocks, kb, seconds);
+        if (mbps < 0)
+            return 0;
+        char label[32];
+        if (kb == 0)
+            snprintf(label, sizeof(label), "none");
+        else
+            snprintf(label, sizeof(label), "%lu KB", kb);
+        printf("%-8s tables %6zu bytes  co-runner %-8s  %8.2f MB/s\n", name, footprint, label, mbps);
+        p = *end ? end + 1 : end;
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    double seconds = 1.0;
+    const char *sizes = "0,256,8192";
+    bool jit = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:s:jh")) != -1)
+    {
+        switch (opt)
+        {
+        case 't':
+            seconds = atof(optarg);
+            break;
+        case 's':
+            sizes = optarg;
+            break;
+        case 'j':
+            jit = true;
+            break;
+        case 'h':
+            printTableBenchUsage();
+            return 0;
+        default:
+            printTableBenchUsage();
+            return 1;
+        }
+    }
+    if (seconds <= 0)
+    {
+        fprintf(stderr, "Error: Measuring time must be positive\n");
+        return 1;
+    }
+
+    DES des;
+    const DES_KeySchedule *schedule = DES_scheduleCreate(0x133457799BBCDFF1ULL);
+    if (!schedule)
+    {
+        fprintf(stderr, "Error: Unable to create key schedule\n");
+        return 1;
+    }
+    DES_bind(&des, schedule, 0);
+
+    static BYTE blocks[BENCH_BLOCKS];
+    for (size_t i = 0; i < BENCH_BLOCKS; i++)
+    {
+        blocks[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+
+    size_t footprint;
+    const char *variant = DES_tableVariant(&footprint);
+    int status = runLevels(&des, blocks, variant, footprint, sizes, seconds) ? 0 : 1;
+
+    // 密钥专用代码只查 SP 表, 编排创建时生成
+    if (status == 0 && jit)
+    {
+        if (!jitSetEnabled(true))
+        {
+            fprintf(stderr, "Error: Key-specialized code is unavailable on this platform\n");
+            status = 1;
+        }
+        else
+        {
+            const DES_KeySchedule *jitSchedule = DES_scheduleCreate(schedule->key);
+            if (!jitSchedule || !jitSchedule->jitEncrypt)
+            {
+                fprintf(stderr, "Error: Unable to generate key-specialized code\n");
+                status = 1;
+            }
+            else
+            {
+                DES jitDes;
+                DES_bind(&jitDes, jitSchedule, 0);
+                status = runLevels(&jitDes, blocks, "jit", sizeof(DES_SP_TABLE), sizes, seconds) ? 0 : 1;
+            }
+            DES_scheduleFree(jitSchedule);
+        }
+    }
+
+    DES_scheduleFree(schedule);
+    return status;
+}
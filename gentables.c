@@ -0,0 +1,114 @@
+// 查表生成器: 由 DESConstants.h 中的原始置换表和S-盒推导出按字节索引的查表, 输出 DESTables.c
+// 构建时运行 (见 Makefile 的 tables / check-tables 目标), 生成结果随源码提交
+// 所有位序与 DES.c 一致: 64位块和子密钥均为 MSB-first
+#include <stdio.h>
+#include "DESConstants.h"
+
+typedef unsigned long long BYTE;
+
+// 通用置换: 输出第 i 位 (从高位数) 取自输入的第 table[i]-1 位
+static BYTE permute(BYTE in, const int *table, int outBits, int inBits)
+{
+    BYTE out = 0;
+    for (int i = 0; i < outBits; i++)
+    {
+        int src = table[i] - 1;
+        BYTE bit = (in >> (inBits - 1 - src)) & 1;
+        out |= bit << (outBits - 1 - i);
+    }
+    return out;
+}
+
+// 输入按字节分组的置换表: 第 b 组为第 b 个字节(从高位数)取值 v 时的置换结果, 各组结果按位或即为整体置换
+static void emitByteTable(const char *name, const char *comment, const int *table, int outBits, int inBits)
+{
+    int groups = inBits / 8;
+    printf("// %s\n", comment);
+    printf("const BYTE %s[%d][256] DES_CACHE_ALIGNED = {\n", name, groups);
+    for (int b = 0; b < groups; b++)
+    {
+        printf("    {");
+        for (int v = 0; v < 256; v++)
+        {
+            BYTE in = (BYTE)v << (inBits - 8 - 8 * b);
+            printf("%s0x%016llXULL%s", v % 4 == 0 ? "\n        " : " ", permute(in, table, outBits, inBits),
+                   v < 255 ? "," : "");
+        }
+        printf("}%s\n", b < groups - 1 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+// S-盒与P置换合并: 第 i 个S-盒输入6位 chunk (未拆分行列) 时, 经P置换后的32位输出
+static void emitSPTable(void)
+{
+    printf("// S-盒与P置换合并的查表, 索引为E扩展后与子密钥异或结果中第i组6位\n");
+    printf("const unsigned int DES_SP_TABLE[8][64] DES_CACHE_ALIGNED = {\n");
+    for (int i = 0; i < 8; i++)
+    {
+        printf("    {");
+        for (int chunk = 0; chunk < 64; chunk++)
+        {
+            int row = ((chunk >> 5) << 1) | (chunk & 1);
+            int col = (chunk >> 1) & 0x0F;
+            BYTE s = (BYTE)(S_BOXES[i][row][col] & 0x0F) << (28 - 4 * i);
+            printf("%s0x%08llXU%s", chunk % 8 == 0 ? "\n        " : " ", permute(s, P, 32, 32),
+                   chunk < 63 ? "," : "");
+        }
+        printf("}%s\n", i < 7 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+// 原始S-盒按6位输入直接索引 (行列已拆分好), 每项一个字节
+static void emitSboxTable(void)
+{
+    printf("// S-盒按6位输入直接索引, 每项4位输出存为一个字节\n");
+    printf("const unsigned char DES_SBOX_TABLE[8][64] DES_CACHE_ALIGNED = {\n");
+    for (int i = 0; i < 8; i++)
+    {
+        printf("    {");
+        for (int chunk = 0; chunk < 64; chunk++)
+        {
+            int row = ((chunk >> 5) << 1) | (chunk & 1);
+            int col = (chunk >> 1) & 0x0F;
+            printf("%s%2d%s", chunk % 16 == 0 ? "\n        " : " ", S_BOXES[i][row][col] & 0x0F,
+                   chunk < 63 ? "," : "");
+        }
+        printf("}%s\n", i < 7 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+// 第i个S-盒的4位输出经P置换后的32位结果
+static void emitP4Table(void)
+{
+    printf("// P置换按S-盒输出查表: 第i个S-盒输出4位值时的P置换结果\n");
+    printf("const unsigned int DES_P4_TABLE[8][16] DES_CACHE_ALIGNED = {\n");
+    for (int i = 0; i < 8; i++)
+    {
+        printf("    {");
+        for (int v = 0; v < 16; v++)
+        {
+            BYTE s = (BYTE)v << (28 - 4 * i);
+            printf("%s0x%08llXU%s", v % 8 == 0 ? "\n        " : " ", permute(s, P, 32, 32), v < 15 ? "," : "");
+        }
+        printf("}%s\n", i < 7 ? "," : "");
+    }
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    printf("// 由 gentables.c 从 DESConstants.h 生成, 请勿手工修改. 重新生成: make tables\n");
+    printf("#include \"DESTables.h\"\n\n");
+    emitByteTable("DES_IP_TABLE", "初始置换IP, 按输入字节查表", IP, 64, 64);
+    emitByteTable("DES_IP_INV_TABLE", "逆初始置换IP^-1, 按输入字节查表", IP_INV, 64, 64);
+    emitByteTable("DES_E_TABLE", "E扩展: 32位输入按字节查表, 输出48位", E, 48, 32);
+    emitSPTable();
+    emitSboxTable();
+    emitP4Table();
+    emitByteTable("DES_PC1_TABLE", "置换选择PC-1: 64位密钥按字节查表, 输出56位", PC1, 56, 64);
+    emitByteTable("DES_PC2_TABLE", "置换选择PC-2: 56位CD按字节查表(7组), 输出48位", PC2, 48, 56);
+    return 0;
+}
@@ -0,0 +1,402 @@
+#include "incr.h"
+#include "util.h"
+#include "workMode.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+// 每次从输入文件读取的字节数
+#define INCR_READ_BYTES 65536
+// 校验值: E_K(E_K(IV ^ 常量)), 密钥或IV变化时清单作废; 两次加密, 不暴露派生IV
+#define INCR_CHECK_MAGIC 0x494E4352454D4E54ULL // "INCREMNT"
+
+// 顺序读取明文字节: 十六进制文本用 hexDecode 分段解码, 与 readInput 一致
+typedef struct
+{
+    FILE *fp;
+    bool binary;
+    int nibble; // 尚未配对的高4位, -1表示没有
+    unsigned char *buf;
+    size_t pos, len;
+} ChunkReader;
+
+static int readerOpen(ChunkReader *r, const char *path, bool binary)
+{
+    r->binary = binary;
+    r->nibble = -1;
+    r->pos = r->len = 0;
+    r->buf = (unsigned char *)poolAlloc(INCR_READ_BYTES);
+    r->fp = r->buf ? fopen(path, binary ? "rb" : "r") : NULL;
+    if (!r->fp)
+    {
+        fprintf(stderr, "Error: Unable to open file: %s\n", path);
+        poolFree(r->buf);
+        return 0;
+    }
+    return 1;
+}
+
+static void readerRewind(ChunkReader *r)
+{
+    rewind(r->fp);
+    r->nibble = -1;
+    r->pos = r->len = 0;
+}
+
+static void readerClose(ChunkReader *r)
+{
+    fclose(r->fp);
+    poolFree(r->buf);
+}
+
+// 读取至多 want 个明文字节, 返回实际字节数(少于 want 说明到达文件末尾), 读取失败或十六进制字符数为奇数时返回-1
+static long readChunk(ChunkReader *r, unsigned char *out, size_t want)
+{
+    size_t got = 0;
+    while (got < want)
+    {
+        if (r->pos == r->len)
+        {
+            r->pos = 0;
+            r->len = fread(r->buf, 1, INCR_READ_BYTES, r->fp);
+            if (r->len == 0)
+                break;
+        }
+        if (r->binary)
+        {
+            size_t n = r->len - r->pos < want - got ? r->len - r->pos : want - got;
+            memcpy(out + got, r->buf + r->pos, n);
+            r->pos += n;
+            got += n;
+            continue;
+        }
+        size_t consumed;
+        got += hexDecode(r->buf + r->pos, r->len - r->pos, &consumed, out + got, want - got, &r->nibble);
+        r->pos += consumed;
+    }
+    if (ferror(r->fp) || (got < want && r->nibble >= 0))
+        return -1;
+    return (long)got;
+}
+
+static inline BYTE rotl64(BYTE v, int n)
+{
+    return (v << n) | (v >> (64 - n));
+}
+
+// 分块散列: 以校验值为种子的64位乘法-循环移位散列, 包含分块长度. 只用于发现修改,
+// 不是密码学散列; 以密钥派生的校验值为种子, 清单本身不能用来直接验证对明文的猜测
+static BYTE chunkHash(BYTE seed, const unsigned char *p, size_t len)
+{
+    const BYTE k1 = 0x9E3779B97F4A7C15ULL, k2 = 0xC2B2AE3D27D4EB4FULL;
+    BYTE h = seed ^ ((BYTE)len * k1);
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8)
+    {
+        BYTE w;
+        memcpy(&w, p + i, 8);
+        h = rotl64(h ^ (w * k2), 31) * k1;
+    }
+    if (i < len)
+    {
+        BYTE w = 0;
+        memcpy(&w, p + i, len - i);
+        h = rotl64(h ^ (w * k2), 31) * k1;
+    }
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 29;
+    return h;
+}
+
+// 清单: 文本格式, 每行一项 "format ecb|chunked", "chunk 字节数", "length 明文字节数",
+// "check 校验值", 然后每个分块一行 "hash 散列值"
+typedef struct
+{
+    bool chunked;
+    size_t chunkBytes;
+    unsigned long long length;
+    BYTE check;
+    BYTE *hashes;
+    size_t count;
+} Manifest;
+
+static int appendHash(BYTE **hashes, size_t *count, BYTE hash)
+{
+    // 容量按2的幂增长
+    if ((*count & (*count - 1)) == 0)
+    {
+        BYTE *grown = (BYTE *)poolRealloc(*hashes, (*count ? *count * 2 : 1) * sizeof(BYTE));
+        if (!grown)
+            return 0;
+        *hashes = grown;
+    }
+    (*hashes)[(*count)++] = hash;
+    return 1;
+}
+
+// 读取清单. 文件不存在返回0; 损坏时给出警告并返回0, 调用者整体重写
+static int readManifest(const char *path, Manifest *m)
+{
+    memset(m, 0, sizeof(*m));
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return 0;
+    char line[256], format[16] = "";
+    unsigned long long chunk = 0, value;
+    int fields = 0;
+    int ok = 1;
+    while (ok && fgets(line, sizeof(line), fp))
+    {
+        if (line[0] == '#')
+            continue;
+        if (sscanf(line, "hash %llx", &value) == 1)
+            ok = appendHash(&m->hashes, &m->count, value);
+        else if (sscanf(line, "format %15s", format) == 1 || sscanf(line, "chunk %llu", &chunk) == 1 ||
+                 sscanf(line, "length %llu", &m->length) == 1 || sscanf(line, "check %llx", &m->check) == 1)
+            fields++;
+        else
+            ok = 0;
+    }
+    fclose(fp);
+    m->chunked = strcmp(format, "chunked") == 0;
+    m->chunkBytes = (size_t)chunk;
+    size_t expected = chunk ? (size_t)((m->length + chunk - 1) / chunk) : 0;
+    if (!ok || fields != 4 || (!m->chunked && strcmp(format, "ecb") != 0) || chunk == 0 || chunk % 8 != 0 ||
+        m->count != expected)
+    {
+        fprintf(stderr, "Warning: Ignoring damaged manifest %s, re-encrypting the whole file\n", path);
+        poolFree(m->hashes);
+        memset(m, 0, sizeof(*m));
+        return 0;
+    }
+    return 1;
+}
+
+// 清单先写临时文件再改名, 中途崩溃不会留下半个文件
+static int writeManifest(const char *path, const Manifest *m)
+{
+    char tmp[4096 + sizeof(".tmp")];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *fp = fopen(tmp, "w");
+    if (!fp)
+    {
+        fprintf(stderr, "Error: Unable to write manifest %s: %s\n", tmp, strerror(errno));
+        return 0;
+    }
+    fprintf(fp, "# e1des incremental manifest\n");
+    fprintf(fp, "format %s\n", m->chunked ? "chunked" : "ecb");
+    fprintf(fp, "chunk %zu\n", m->chunkBytes);
+    fprintf(fp, "length %llu\n", m->length);
+    fprintf(fp, "check %016llX\n", m->check);
+    for (size_t i = 0; i < m->count; i++)
+    {
+        fprintf(fp, "hash %016llX\n", m->hashes[i]);
+    }
+    int ok = fclose(fp) == 0 && rename(tmp, path) == 0;
+    if (!ok)
+        fprintf(stderr, "Error: Unable to write manifest %s\n", path);
+    return ok;
+}
+
+// 密文文件布局: 分块i的密文从 base + i*chunkBytes*2 个字符开始
+typedef struct
+{
+    size_t chunkBlocks; // 每块的BYTE数
+    size_t chunkCount;
+    size_t totalBlocks;
+    off_t base;      // 第一个分块密文的字符偏移(分块CBC容器为头部与块索引之后)
+    off_t fileChars; // 密文文件的总字符数
+} Layout;
+
+static void computeLayout(bool chunked, size_t chunkBytes, unsigned long long length, Layout *l)
+{
+    l->chunkBlocks = chunkBytes / 8;
+    l->totalBlocks = (size_t)((length + 7) / 8);
+    l->chunkCount = (l->totalBlocks + l->chunkBlocks - 1) / l->chunkBlocks;
+    l->base = chunked ? (off_t)(4 + l->chunkCount) * 16 : 0;
+    l->fileChars = l->base + (off_t)l->totalBlocks * 16;
+}
+
+static int pwriteFull(int fd, const char *buf, size_t n, off_t offset)
+{
+    while (n > 0)
+    {
+        ssize_t w = pwrite(fd, buf, n, offset);
+        if (w < 0 && errno == EINTR)
+            continue;
+        if (w <= 0)
+            return 0;
+        buf += w;
+        n -= (size_t)w;
+        offset += w;
+    }
+    return 1;
+}
+
+// 分块CBC容器的头部与块索引
+static int writeContainerHeader(int fd, const Layout *l)
+{
+    size_t count = 4 + l->chunkCount;
+    BYTE *header = (BYTE *)poolAlloc(count * sizeof(BYTE));
+    char *text = (char *)poolAlloc(count * 16);
+    int ok = header && text;
+    if (ok)
+    {
+        header[0] = CHUNKED_MAGIC;
+        header[1] = l->chunkBlocks;
+        header[2] = l->chunkCount;
+        header[3] = l->totalBlocks;
+        for (size_t i = 0; i < l->chunkCount; i++)
+        {
+            size_t remaining = l->totalBlocks - i * l->chunkBlocks;
+            header[4 + i] = remaining < l->chunkBlocks ? remaining : l->chunkBlocks;
+        }
+        hexEncodeBlocks(header, count, text);
+        ok = pwriteFull(fd, text, count * 16, 0);
+    }
+    poolFree(header);
+    poolFree(text);
+    return ok;
+}
+
+int incrementalProcessFile(DES *des, bool chunked, bool binary, size_t chunkBytes, const char *inPath,
+                           const char *outPath, const char *manifestPath, IncrStats *stats)
+{
+    char defaultManifest[4096];
+    if (manifestPath == NULL)
+    {
+        snprintf(defaultManifest, sizeof(defaultManifest), "%s%s", outPath, INCR_MANIFEST_SUFFIX);
+        manifestPath = defaultManifest;
+    }
+    memset(stats, 0, sizeof(*stats));
+
+    // 旧清单可用的条件: 格式与校验值一致, 分块CBC的分块大小不变, 密文文件大小与清单相符
+    BYTE check = DES_encryptBlock(des, DES_encryptBlock(des, (chunked ? des->iv : 0) ^ INCR_CHECK_MAGIC));
+    Manifest old;
+    bool reuse = readManifest(manifestPath, &old) && old.chunked == chunked && old.check == check &&
+                 (!chunked || old.chunkBytes == chunkBytes);
+    if (reuse)
+    {
+        Layout oldLayout;
+        computeLayout(chunked, old.chunkBytes, old.length, &oldLayout);
+        struct stat st;
+        reuse = stat(outPath, &st) == 0 && S_ISREG(st.st_mode) && st.st_size == oldLayout.fileChars;
+        if (!chunked)
+            chunkBytes = old.chunkBytes;
+    }
+    if (chunkBytes == 0 || chunkBytes % 8 != 0)
+    {
+        fprintf(stderr, "Error: Chunk size must be a positive multiple of 8 bytes\n");
+        poolFree(old.hashes);
+        return 0;
+    }
+
+    ChunkReader reader;
+    unsigned char *plain = (unsigned char *)poolAlloc(chunkBytes + 8);
+    BYTE *blocks = (BYTE *)poolAlloc(chunkBytes + 8);
+    char *text = (char *)poolAlloc(chunkBytes * 2 + 16);
+    if (!plain || !blocks || !text || !readerOpen(&reader, inPath, binary))
+    {
+        if (!plain || !blocks || !text)
+            fprintf(stderr, "Error: Memory allocation failed\n");
+        poolFree(plain);
+        poolFree(blocks);
+        poolFree(text);
+        poolFree(old.hashes);
+        return 0;
+    }
+
+    // 第一遍: 只计算各分块的散列, 得到明文长度与需要重写的分块
+    Manifest cur = {chunked, chunkBytes, 0, check, NULL, 0};
+    long got = 0;
+    int ok = 1;
+    while (ok && (got = readChunk(&reader, plain, chunkBytes)) > 0)
+    {
+        ok = appendHash(&cur.hashes, &cur.count, chunkHash(check, plain, (size_t)got));
+        cur.length += (unsigned long long)got;
+        if (got < (long)chunkBytes)
+            break;
+    }
+    if (ok && got < 0)
+    {
+        fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+        ok = 0;
+    }
+
+    Layout layout;
+    computeLayout(chunked, chunkBytes, cur.length, &layout);
+    // 分块CBC容器的块数变化时块索引长度变化, 所有密文的位置都会移动
+    if (reuse && chunked && old.count != cur.count)
+        reuse = false;
+    stats->chunks = cur.count;
+    stats->full = !reuse;
+    for (size_t i = 0; i < cur.count; i++)
+    {
+        if (!reuse || i >= old.count || cur.hashes[i] != old.hashes[i])
+            stats->rewritten++;
+    }
+
+    // 没有变化时密文与清单都不动
+    if (ok && (stats->rewritten > 0 || !reuse || old.length != cur.length))
+    {
+        // 先删除旧清单: 改写中途失败时下次运行整体重写, 不会把未更新的密文当作最新
+        unlink(manifestPath);
+        int fd = open(outPath, O_RDWR | O_CREAT | (reuse ? 0 : O_TRUNC), 0666);
+        if (fd < 0)
+        {
+            fprintf(stderr, "Error: Unable to create file: %s\n", outPath);
+            ok = 0;
+        }
+        if (ok && chunked)
+            ok = writeContainerHeader(fd, &layout);
+
+        // 第二遍: 重新读取明文, 只加密并写回变化的分块
+        readerRewind(&reader);
+        for (size_t i = 0; ok && i < cur.count; i++)
+        {
+            got = readChunk(&reader, plain, chunkBytes);
+            if (got <= 0)
+            {
+                fprintf(stderr, "Error: Input file changed while reading: %s\n", inPath);
+                ok = 0;
+                break;
+            }
+            if (reuse && i < old.count && cur.hashes[i] == old.hashes[i])
+                continue;
+            size_t n = ((size_t)got + 7) / 8;
+            bytesToBlocks(plain, (size_t)got, blocks);
+            BYTE state = chunked ? chunkedDeriveIV(des, des->iv, i) : 0;
+            DES_encryptInPlace(des, blocks, n, chunked ? CBC : ECB, &state);
+            hexEncodeBlocks(blocks, n, text);
+            ok = pwriteFull(fd, text, n * 16, layout.base + (off_t)(i * chunkBytes * 2));
+            if (!ok)
+                fprintf(stderr, "Error: Failed to write file: %s\n", outPath);
+        }
+        if (fd >= 0)
+        {
+            if (ok && ftruncate(fd, layout.fileChars) != 0)
+            {
+                fprintf(stderr, "Error: Failed to write file: %s\n", outPath);
+                ok = 0;
+            }
+            if (close(fd) != 0)
+                ok = 0;
+        }
+        if (ok)
+            ok = writeManifest(manifestPath, &cur);
+    }
+
+    readerClose(&reader);
+    poolFree(plain);
+    poolFree(blocks);
+    poolFree(text);
+    poolFree(old.hashes);
+    poolFree(cur.hashes);
+    return ok;
+}
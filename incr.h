@@ -0,0 +1,31 @@
+#ifndef INCR_H
+#define INCR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "DES.h"
+#include "enum.h"
+
+// 增量加密: 明文按固定大小分块, 每块计算带密钥的64位散列存入旁路清单;
+// 再次加密同一文件时只对散列变化的分块重新加密, 并原地改写密文文件中对应的位置, 其余密文不动
+// 只支持密文位置与明文一一对应的格式: ECB 密文(十六进制文本)和分块CBC容器(块数不变时);
+// CBC/CFB/OFB 的每个密文块依赖前面的全部数据, 任一处修改都要重写其后所有密文, 不适用
+
+// 清单默认为输出文件名加此后缀
+#define INCR_MANIFEST_SUFFIX ".manifest"
+
+typedef struct
+{
+    size_t chunks;    // 明文分块数
+    size_t rewritten; // 重新加密并写回的分块数
+    bool full;        // 没有可用的清单(或格式、密钥、分块大小变化), 整个文件重写
+} IncrStats;
+
+// 增量加密 inPath 到 outPath. chunked 为真时输出分块CBC容器(须为CBC, chunkBytes 为分块字节数),
+// 否则为 ECB 密文, 分块大小沿用清单中的值, 没有清单时为 chunkBytes
+// 输出与完整加密的结果完全一致. 清单在改写密文之前删除, 完成后重新写入, 中途失败时下次整体重写
+// manifestPath 为 NULL 时使用 outPath + INCR_MANIFEST_SUFFIX. 成功返回1
+int incrementalProcessFile(DES *des, bool chunked, bool binary, size_t chunkBytes, const char *inPath,
+                           const char *outPath, const char *manifestPath, IncrStats *stats);
+
+#endif // INCR_H
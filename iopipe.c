@@ -0,0 +1,571 @@
+#define _GNU_SOURCE // O_DIRECT
+#include "iopipe.h"
+#include "stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+void ioPipelineDefaults(IoPipelineOptions *opts)
+{
+    opts->backend = IO_BACKEND_MEMORY;
+    opts->chunkSize = IOPIPE_DEFAULT_CHUNK;
+    opts->queueDepth = IOPIPE_DEFAULT_DEPTH;
+    opts->direct = false;
+}
+
+int parseIoBackend(const char *name)
+{
+    if (strcmp(name, "memory") == 0)
+        return IO_BACKEND_MEMORY;
+    if (strcmp(name, "threads") == 0)
+        return IO_BACKEND_THREADS;
+    if (strcmp(name, "uring") == 0)
+        return IO_BACKEND_URING;
+    return -1;
+}
+
+// 同步完成剩余的读/写, 处理短读短写. 返回累计字节数, 出错返回-errno
+static ssize_t fullIo(int fd, int isWrite, unsigned char *buf, size_t len, off_t off)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        ssize_t n = isWrite ? pwrite(fd, buf + done, len - done, off + (off_t)done)
+                            : pread(fd, buf + done, len - done, off + (off_t)done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return -errno;
+        if (n == 0)
+            break; // 读到文件末尾
+        done += (size_t)n;
+    }
+    return (ssize_t)done;
+}
+
+// 一个I/O请求, 以tag标识 (读缓冲区和写缓冲区各有固定的tag)
+typedef struct
+{
+    int fd;
+    int isWrite;
+    unsigned char *buf;
+    size_t len;
+    off_t off;
+    int done;
+    ssize_t result;
+} IoRequest;
+
+// I/O引擎接口: 提交请求, 按tag等待完成
+typedef struct IoEngine IoEngine;
+struct IoEngine
+{
+    int (*submit)(IoEngine *e, int tag);
+    ssize_t (*wait)(IoEngine *e, int tag);
+    void (*destroy)(IoEngine *e);
+    IoRequest *reqs;
+};
+
+// ---------------- 线程后端: 后台线程执行 pread/pwrite ----------------
+
+#define IO_THREADS 2 // 一个读一个写可同时进行
+
+typedef struct
+{
+    IoEngine base;
+    pthread_t threads[IO_THREADS];
+    int started;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    pthread_cond_t finished;
+    int *queue; // 待执行tag的环形队列
+    int queueCap, queueHead, queueLen;
+    int stopping;
+} ThreadEngine;
+
+static void *ioThreadMain(void *arg)
+{
+    ThreadEngine *te = (ThreadEngine *)arg;
+    pthread_mutex_lock(&te->lock);
+    for (;;)
+    {
+        while (te->queueLen == 0 && !te->stopping)
+            pthread_cond_wait(&te->queued, &te->lock);
+        if (te->queueLen == 0)
+            break;
+        int tag = te->queue[te->queueHead];
+        te->queueHead = (te->queueHead + 1) % te->queueCap;
+        te->queueLen--;
+        pthread_mutex_unlock(&te->lock);
+
+        IoRequest *r = &te->base.reqs[tag];
+        ssize_t res = fullIo(r->fd, r->isWrite, r->buf, r->len, r->off);
+
+        pthread_mutex_lock(&te->lock);
+        r->result = res;
+        r->done = 1;
+        pthread_cond_broadcast(&te->finished);
+    }
+    pthread_mutex_unlock(&te->lock);
+    return NULL;
+}
+
+static int threadSubmit(IoEngine *e, int tag)
+{
+    ThreadEngine *te = (ThreadEngine *)e;
+    pthread_mutex_lock(&te->lock);
+    e->reqs[tag].done = 0;
+    te->queue[(te->queueHead + te->queueLen) % te->queueCap] = tag;
+    te->queueLen++;
+    pthread_cond_signal(&te->queued);
+    pthread_mutex_unlock(&te->lock);
+    return 1;
+}
+
+static ssize_t threadWait(IoEngine *e, int tag)
+{
+    ThreadEngine *te = (ThreadEngine *)e;
+    pthread_mutex_lock(&te->lock);
+    while (!e->reqs[tag].done)
+        pthread_cond_wait(&te->finished, &te->lock);
+    ssize_t res = e->reqs[tag].result;
+    pthread_mutex_unlock(&te->lock);
+    return res;
+}
+
+static void threadDestroy(IoEngine *e)
+{
+    ThreadEngine *te = (ThreadEngine *)e;
+    pthread_mutex_lock(&te->lock);
+    te->stopping = 1;
+    pthread_cond_broadcast(&te->queued);
+    pthread_mutex_unlock(&te->lock);
+    for (int i = 0; i < te->started; i++)
+        pthread_join(te->threads[i], NULL);
+    pthread_mutex_destroy(&te->lock);
+    pthread_cond_destroy(&te->queued);
+    pthread_cond_destroy(&te->finished);
+    free(te->queue);
+    free(te);
+}
+
+static IoEngine *createThreadEngine(IoRequest *reqs, int tags)
+{
+    ThreadEngine *te = (ThreadEngine *)calloc(1, sizeof(ThreadEngine));
+    if (!te)
+        return NULL;
+    te->queue = (int *)malloc(tags * sizeof(int));
+    if (!te->queue)
+    {
+        free(te);
+        return NULL;
+    }
+    te->queueCap = tags;
+    te->base.submit = threadSubmit;
+    te->base.wait = threadWait;
+    te->base.destroy = threadDestroy;
+    te->base.reqs = reqs;
+    pthread_mutex_init(&te->lock, NULL);
+    pthread_cond_init(&te->queued, NULL);
+    pthread_cond_init(&te->finished, NULL);
+    for (; te->started < IO_THREADS; te->started++)
+    {
+        if (pthread_create(&te->threads[te->started], NULL, ioThreadMain, te) != 0)
+            break;
+    }
+    if (te->started == 0)
+    {
+        threadDestroy(&te->base);
+        return NULL;
+    }
+    return &te->base;
+}
+
+// ---------------- io_uring 后端: 直接使用系统调用 ----------------
+
+#ifdef __linux__
+
+typedef struct
+{
+    IoEngine base;
+    int ringFd;
+    void *sqRing, *cqRing;
+    size_t sqRingSize, cqRingSize;
+    struct io_uring_sqe *sqes;
+    size_t sqesSize;
+    unsigned *sqHead, *sqTail, *sqMask, *sqArray;
+    unsigned *cqHead, *cqTail, *cqMask;
+    struct io_uring_cqe *cqes;
+} UringEngine;
+
+static int uringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static int uringSubmit(IoEngine *e, int tag)
+{
+    UringEngine *ue = (UringEngine *)e;
+    IoRequest *r = &e->reqs[tag];
+    unsigned tail = *ue->sqTail;
+    unsigned index = tail & *ue->sqMask;
+    struct io_uring_sqe *sqe = &ue->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = r->isWrite ? IORING_OP_WRITE : IORING_OP_READ;
+    sqe->fd = r->fd;
+    sqe->addr = (unsigned long)r->buf;
+    sqe->len = (unsigned)r->len;
+    sqe->off = (unsigned long long)r->off;
+    sqe->user_data = (unsigned long long)tag;
+    ue->sqArray[index] = index;
+    r->done = 0;
+    __atomic_store_n(ue->sqTail, tail + 1, __ATOMIC_RELEASE);
+    while (uringEnter(ue->ringFd, 1, 0, 0) < 0)
+    {
+        if (errno != EINTR && errno != EAGAIN)
+            return 0;
+    }
+    return 1;
+}
+
+// 收割所有已完成的CQE
+static void uringReap(UringEngine *ue)
+{
+    unsigned head = *ue->cqHead;
+    unsigned tail = __atomic_load_n(ue->cqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++)
+    {
+        struct io_uring_cqe *cqe = &ue->cqes[head & *ue->cqMask];
+        IoRequest *r = &ue->base.reqs[cqe->user_data];
+        r->result = cqe->res;
+        r->done = 1;
+    }
+    __atomic_store_n(ue->cqHead, head, __ATOMIC_RELEASE);
+}
+
+static ssize_t uringWait(IoEngine *e, int tag)
+{
+    UringEngine *ue = (UringEngine *)e;
+    IoRequest *r = &e->reqs[tag];
+    uringReap(ue);
+    while (!r->done)
+    {
+        if (uringEnter(ue->ringFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+            return -errno;
+        uringReap(ue);
+    }
+    // 短读短写时同步补齐剩余部分
+    ssize_t res = r->result;
+    if (res > 0 && (size_t)res < r->len)
+    {
+        ssize_t rest = fullIo(r->fd, r->isWrite, r->buf + res, r->len - res, r->off + res);
+        res = rest < 0 ? rest : res + rest;
+    }
+    return res;
+}
+
+static void uringDestroy(IoEngine *e)
+{
+    UringEngine *ue = (UringEngine *)e;
+    if (ue->sqes)
+        munmap(ue->sqes, ue->sqesSize);
+    if (ue->cqRing)
+        munmap(ue->cqRing, ue->cqRingSize);
+    if (ue->sqRing)
+        munmap(ue->sqRing, ue->sqRingSize);
+    if (ue->ringFd >= 0)
+        close(ue->ringFd);
+    free(ue);
+}
+
+// 检查内核是否支持 io_uring 以及 READ/WRITE 操作 (5.6+)
+static int uringSupported(int ringFd)
+{
+    size_t size = sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe *)calloc(1, size);
+    if (!probe)
+        return 0;
+    int ok = syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) >= 0 &&
+             probe->last_op >= IORING_OP_WRITE &&
+             (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) &&
+             (probe->ops[IORING_OP_WRITE].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return ok;
+}
+
+static IoEngine *createUringEngine(IoRequest *reqs, int tags)
+{
+    UringEngine *ue = (UringEngine *)calloc(1, sizeof(UringEngine));
+    if (!ue)
+        return NULL;
+    ue->base.submit = uringSubmit;
+    ue->base.wait = uringWait;
+    ue->base.destroy = uringDestroy;
+    ue->base.reqs = reqs;
+
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    ue->ringFd = (int)syscall(__NR_io_uring_setup, (unsigned)tags, &p);
+    if (ue->ringFd < 0 || !uringSupported(ue->ringFd))
+    {
+        uringDestroy(&ue->base);
+        return NULL;
+    }
+
+    ue->sqRingSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    ue->cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    ue->sqesSize = p.sq_entries * sizeof(struct io_uring_sqe);
+    ue->sqRing = mmap(NULL, ue->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ue->ringFd, IORING_OFF_SQ_RING);
+    ue->cqRing = mmap(NULL, ue->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ue->ringFd, IORING_OFF_CQ_RING);
+    ue->sqes = (struct io_uring_sqe *)mmap(NULL, ue->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ue->ringFd, IORING_OFF_SQES);
+    if (ue->sqRing == MAP_FAILED || ue->cqRing == MAP_FAILED || ue->sqes == MAP_FAILED)
+    {
+        if (ue->sqRing == MAP_FAILED)
+            ue->sqRing = NULL;
+        if (ue->cqRing == MAP_FAILED)
+            ue->cqRing = NULL;
+        if (ue->sqes == MAP_FAILED)
+            ue->sqes = NULL;
+        uringDestroy(&ue->base);
+        return NULL;
+    }
+
+    unsigned char *sq = (unsigned char *)ue->sqRing, *cq = (unsigned char *)ue->cqRing;
+    ue->sqHead = (unsigned *)(sq + p.sq_off.head);
+    ue->sqTail = (unsigned *)(sq + p.sq_off.tail);
+    ue->sqMask = (unsigned *)(sq + p.sq_off.ring_mask);
+    ue->sqArray = (unsigned *)(sq + p.sq_off.array);
+    ue->cqHead = (unsigned *)(cq + p.cq_off.head);
+    ue->cqTail = (unsigned *)(cq + p.cq_off.tail);
+    ue->cqMask = (unsigned *)(cq + p.cq_off.ring_mask);
+    ue->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    return &ue->base;
+}
+
+#else
+
+static IoEngine *createUringEngine(IoRequest *reqs, int tags)
+{
+    (void)reqs;
+    (void)tags;
+    return NULL;
+}
+
+#endif
+
+// ---------------- 流水线 ----------------
+
+static int openFile(const char *path, int flags, bool direct, bool *directUsed)
+{
+    int fd = -1;
+#ifdef O_DIRECT
+    if (direct)
+    {
+        fd = open(path, flags | O_DIRECT, 0644);
+        // tmpfs 等文件系统不支持 O_DIRECT, 退回普通I/O
+        if (fd >= 0)
+        {
+            *directUsed = true;
+            return fd;
+        }
+        if (errno != EINVAL)
+            return -1;
+        fprintf(stderr, "Warning: O_DIRECT not supported for %s, using buffered I/O\n", path);
+    }
+#else
+    (void)direct;
+#endif
+    *directUsed = false;
+    return open(path, flags, 0644);
+}
+
+static void *alignedAlloc(size_t size)
+{
+    void *p = NULL;
+    return posix_memalign(&p, IOPIPE_ALIGN, size) == 0 ? p : NULL;
+}
+
+int pipelineProcessFile(DES *des, EncryptionMode mode, bool decrypt,
+                        const char *inPath, const char *outPath, const IoPipelineOptions *opts)
+{
+    size_t chunk = opts->chunkSize;
+    int depth = opts->queueDepth;
+    if (chunk == 0 || chunk % IOPIPE_ALIGN != 0 || depth <= 0)
+    {
+        fprintf(stderr, "Error: Chunk size must be a positive multiple of %d and queue depth positive\n", IOPIPE_ALIGN);
+        return 0;
+    }
+
+    bool inDirect = false, outDirect = false;
+    int inFd = openFile(inPath, O_RDONLY, opts->direct, &inDirect);
+    if (inFd < 0)
+    {
+        fprintf(stderr, "Error: Unable to open file: %s\n", inPath);
+        return 0;
+    }
+    struct stat st;
+    if (fstat(inFd, &st) < 0)
+    {
+        close(inFd);
+        return 0;
+    }
+    int outFd = openFile(outPath, O_WRONLY | O_CREAT | O_TRUNC, opts->direct, &outDirect);
+    if (outFd < 0)
+    {
+        fprintf(stderr, "Error: Unable to create file: %s\n", outPath);
+        close(inFd);
+        return 0;
+    }
+
+    // tag 0..depth-1 为读缓冲区, depth 和 depth+1 为交替使用的两个输出缓冲区
+    int tags = depth + 2;
+    size_t outCap = chunk + CRYPT_STREAM_OUT_MAX(chunk) + IOPIPE_ALIGN;
+    outCap = (outCap + IOPIPE_ALIGN - 1) & ~(size_t)(IOPIPE_ALIGN - 1);
+    IoRequest *reqs = (IoRequest *)calloc(tags, sizeof(IoRequest));
+    int *inFlight = (int *)calloc(tags, sizeof(int));
+    unsigned char **bufs = (unsigned char **)calloc(tags, sizeof(unsigned char *));
+    CryptStream *stream = (CryptStream *)malloc(sizeof(CryptStream));
+    int ok = reqs && inFlight && bufs && stream;
+    for (int t = 0; ok && t < tags; t++)
+    {
+        bufs[t] = (unsigned char *)alignedAlloc(t < depth ? chunk : outCap);
+        ok = bufs[t] != NULL;
+    }
+
+    IoEngine *engine = NULL;
+    if (ok && opts->backend == IO_BACKEND_URING)
+    {
+        engine = createUringEngine(reqs, tags);
+        if (!engine)
+            fprintf(stderr, "Warning: io_uring unavailable, using thread backend\n");
+    }
+    if (ok && !engine)
+        engine = createThreadEngine(reqs, tags);
+    if (!engine)
+    {
+        fprintf(stderr, "Error: Unable to initialize I/O pipeline\n");
+        ok = 0;
+    }
+
+    size_t fileSize = (size_t)st.st_size;
+    size_t chunks = (fileSize + chunk - 1) / chunk;
+    int cur = 0;     // 当前填充的输出缓冲区 (0 或 1)
+    size_t fill = 0; // 当前输出缓冲区中已有的字节数
+    off_t outOff = 0;
+
+    if (ok)
+        cryptStreamInit(stream, des, mode, decrypt, des->iv);
+
+    // 预先提交前 depth 个分块的读请求
+    for (size_t i = 0; ok && i < chunks && i < (size_t)depth; i++)
+    {
+        reqs[i] = (IoRequest){inFd, 0, bufs[i], chunk, (off_t)(i * chunk), 0, 0};
+        ok = inFlight[i] = engine->submit(engine, (int)i);
+    }
+
+    for (size_t i = 0; ok && i < chunks; i++)
+    {
+        int tag = (int)(i % depth);
+        size_t expected = fileSize - i * chunk < chunk ? fileSize - i * chunk : chunk;
+        ssize_t got = engine->wait(engine, tag);
+        inFlight[tag] = 0;
+        if (got != (ssize_t)expected)
+        {
+            fprintf(stderr, "Error: Failed to read file: %s\n", inPath);
+            ok = 0;
+            break;
+        }
+        unsigned char *outBuf = bufs[depth + cur];
+        fill += cryptStreamUpdate(stream, (const char *)bufs[tag], expected, (char *)outBuf + fill);
+
+        // 缓冲区已处理完, 立即提交后面的读请求
+        if (i + depth < chunks)
+        {
+            reqs[tag] = (IoRequest){inFd, 0, bufs[tag], chunk, (off_t)((i + depth) * chunk), 0, 0};
+            ok = inFlight[tag] = engine->submit(engine, tag);
+        }
+
+        // 输出积累够一个分块后, 异步写出对齐的部分, 剩余部分移到另一个缓冲区
+        if (ok && fill >= chunk)
+        {
+            size_t flushLen = fill & ~(size_t)(IOPIPE_ALIGN - 1);
+            int wtag = depth + cur, next = cur ^ 1;
+            reqs[wtag] = (IoRequest){outFd, 1, outBuf, flushLen, outOff, 0, 0};
+            ok = inFlight[wtag] = engine->submit(engine, wtag);
+            outOff += (off_t)flushLen;
+            if (ok && inFlight[depth + next])
+            {
+                inFlight[depth + next] = 0;
+                ok = engine->wait(engine, depth + next) == (ssize_t)reqs[depth + next].len;
+            }
+            memcpy(bufs[depth + next], outBuf + flushLen, fill - flushLen);
+            fill -= flushLen;
+            cur = next;
+        }
+    }
+
+    if (ok)
+    {
+        long tail = cryptStreamFinal(stream, (char *)bufs[depth + cur] + fill);
+        if (tail < 0)
+        {
+            fprintf(stderr, "Error: Invalid hexadecimal string length: %s\n", inPath);
+            ok = 0;
+        }
+        else
+        {
+            fill += (size_t)tail;
+        }
+    }
+
+    // 等待所有在途请求完成, 之后才能释放缓冲区
+    for (int t = 0; engine && t < tags; t++)
+    {
+        if (inFlight[t])
+        {
+            ssize_t res = engine->wait(engine, t);
+            if (t >= depth && res != (ssize_t)reqs[t].len)
+                ok = 0;
+        }
+    }
+
+    // 写出剩余部分; O_DIRECT 下先写对齐部分, 末尾不足对齐的部分关闭 O_DIRECT 后写
+    if (ok && fill > 0)
+    {
+        unsigned char *outBuf = bufs[depth + cur];
+        size_t aligned = outDirect ? fill & ~(size_t)(IOPIPE_ALIGN - 1) : fill;
+        ok = fullIo(outFd, 1, outBuf, aligned, outOff) == (ssize_t)aligned;
+#ifdef O_DIRECT
+        if (ok && aligned < fill)
+        {
+            fcntl(outFd, F_SETFL, fcntl(outFd, F_GETFL) & ~O_DIRECT);
+            ok = fullIo(outFd, 1, outBuf + aligned, fill - aligned, outOff + (off_t)aligned) == (ssize_t)(fill - aligned);
+        }
+#endif
+        if (!ok)
+            fprintf(stderr, "Error: Failed to write file: %s\n", outPath);
+    }
+
+    if (engine)
+        engine->destroy(engine);
+    for (int t = 0; bufs && t < tags; t++)
+        free(bufs[t]);
+    free(bufs);
+    free(inFlight);
+    free(reqs);
+    free(stream);
+    close(inFd);
+    if (close(outFd) < 0)
+        ok = 0;
+    return ok;
+}
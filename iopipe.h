@@ -0,0 +1,41 @@
+#ifndef IOPIPE_H
+#define IOPIPE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "DES.h"
+#include "enum.h"
+
+// 大文件I/O流水线: 多个对齐的分块读请求同时在途, 当前分块加解密的同时
+// 后续分块在读、之前的分块在写. 仅处理十六进制文本格式的输入输出
+
+typedef enum
+{
+    IO_BACKEND_MEMORY,  // 默认: 整个文件读入内存后处理
+    IO_BACKEND_THREADS, // pread/pwrite 由后台I/O线程执行
+    IO_BACKEND_URING    // io_uring 异步提交 (仅 Linux)
+} IoBackend;
+
+typedef struct
+{
+    IoBackend backend;
+    size_t chunkSize; // 每次读取的字节数, 须为4096的整数倍
+    int queueDepth;   // 同时在途的读请求数
+    bool direct;      // 使用 O_DIRECT 绕过页缓存
+} IoPipelineOptions;
+
+#define IOPIPE_ALIGN 4096
+#define IOPIPE_DEFAULT_CHUNK (1024 * 1024)
+#define IOPIPE_DEFAULT_DEPTH 4
+
+void ioPipelineDefaults(IoPipelineOptions *opts);
+
+// 解析后端名称 "memory" / "threads" / "uring", 未知名称返回-1
+int parseIoBackend(const char *name);
+
+// 以流水线方式处理单个文件, 结果与 processFile 相同. 成功返回1
+// 请求 io_uring 但内核不支持时自动退回线程后端
+int pipelineProcessFile(DES *des, EncryptionMode mode, bool decrypt,
+                        const char *inPath, const char *outPath, const IoPipelineOptions *opts);
+
+#endif // IOPIPE_H
@@ -0,0 +1,393 @@
+#include "jit.h"
+#include "DESTables.h"
+#include "pool.h"
+#include <stdarg.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) && defined(__unix__)
+#define JIT_SUPPORTED 1
+#include <sys/mman.h>
+#else
+#define JIT_SUPPORTED 0
+#endif
+
+static pthread_mutex_t jitLock = PTHREAD_MUTEX_INITIALIZER;
+static size_t compiledCount;
+static size_t reusedCount;
+
+void jitGetStats(size_t *compiled, size_t *reused)
+{
+    pthread_mutex_lock(&jitLock);
+    if (compiled)
+        *compiled = compiledCount;
+    if (reused)
+        *reused = reusedCount;
+    pthread_mutex_unlock(&jitLock);
+}
+
+#if JIT_SUPPORTED
+
+// 每次交错处理的块数: 4组左右两半占满8个寄存器, 相互独立的查表链填满流水线
+#define JIT_LANES 4
+// 每个函数的代码上限 (4块交错的主循环约11KB, 加上逐块处理的尾部循环约14KB), 加密与解密函数共用一个映射
+#define JIT_FUNC_BYTES 16384
+#define JIT_MAP_BYTES (2 * JIT_FUNC_BYTES)
+
+typedef struct
+{
+    unsigned char *code; // 映射起始地址, NULL 表示空槽
+    BYTE key;
+    DES_BlocksFn encrypt;
+    DES_BlocksFn decrypt;
+    unsigned refs;              // 使用该代码的编排数
+    unsigned long long lastUse; // 最近一次取得的序号, 用于淘汰
+} JitEntry;
+
+static JitEntry cache[JIT_CACHE_KEYS];
+static bool enabled = false;
+static unsigned long long useClock;
+
+// x86-64 通用寄存器编号
+enum
+{
+    REG_RAX = 0,
+    REG_RCX = 1,
+    REG_RDX = 2,
+    REG_RBX = 3,
+    REG_RBP = 5,
+    REG_RSI = 6,
+    REG_RDI = 7,
+    REG_R8 = 8,
+    REG_R9 = 9,
+    REG_R10 = 10,
+    REG_R11 = 11,
+    REG_R12 = 12,
+    REG_R13 = 13
+};
+
+// 各块的左右两半所在寄存器. rdi/rsi 为输入输出指针, r8 为 SP 表地址, r9 为剩余块数, edx 为临时寄存器
+static const int laneL[JIT_LANES] = {REG_RAX, REG_RBX, REG_R10, REG_R12};
+static const int laneR[JIT_LANES] = {REG_RCX, REG_RBP, REG_R11, REG_R13};
+
+typedef struct
+{
+    unsigned char *p;
+} Emitter;
+
+static void emitBytes(Emitter *e, int n, ...)
+{
+    va_list ap;
+    va_start(ap, n);
+    for (int i = 0; i < n; i++)
+    {
+        *e->p++ = (unsigned char)va_arg(ap, int);
+    }
+    va_end(ap);
+}
+
+static void emit32(Emitter *e, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        *e->p++ = (unsigned char)(v >> (8 * i));
+    }
+}
+
+static void emit64(Emitter *e, uint64_t v)
+{
+    emit32(e, (uint32_t)v);
+    emit32(e, (uint32_t)(v >> 32));
+}
+
+// REX前缀: w 为64位操作数, reg/rm 为8号以上寄存器时置扩展位; 不需要时省略
+static void emitRex(Emitter *e, int w, int reg, int rm)
+{
+    int rex = 0x40 | w << 3 | (reg >= 8) << 2 | (rm >= 8);
+    if (rex != 0x40)
+        emitBytes(e, 1, rex);
+}
+
+// 寄存器间运算 op rm, reg (mov 0x89, xor 0x31, or 0x09)
+static void emitRR(Emitter *e, int w, int op, int rm, int reg)
+{
+    emitRex(e, w, reg, rm);
+    emitBytes(e, 2, op, 0xC0 | (reg & 7) << 3 | (rm & 7));
+}
+
+// 带8位立即数的单寄存器运算: op 0xC1 (rol 0, shl 4, shr 5) 或 0x83 (add 0, sub 5, xor 6, cmp 7)
+static void emitRI8(Emitter *e, int w, int op, int ext, int rm, int imm)
+{
+    emitRex(e, w, 0, rm);
+    emitBytes(e, 3, op, 0xC0 | ext << 3 | (rm & 7), imm);
+}
+
+// mov reg, [base + disp] (op 0x8B) 或 mov [base + disp], reg (op 0x89), base 为 rdi/rsi
+static void emitMem(Emitter *e, int op, int reg, int base, int disp)
+{
+    emitRex(e, 1, reg, base);
+    emitBytes(e, 3, op, 0x40 | (reg & 7) << 3 | (base & 7), disp);
+}
+
+// 条件跳转 (rel32), 返回待回填的位移地址
+static unsigned char *emitJcc(Emitter *e, int cc)
+{
+    emitBytes(e, 2, 0x0F, cc);
+    unsigned char *rel = e->p;
+    emit32(e, 0);
+    return rel;
+}
+
+// 把 rel32 回填为跳到 target
+static void patchJump(unsigned char *rel, unsigned char *target)
+{
+    Emitter patch = {rel};
+    emit32(&patch, (uint32_t)(target - (rel + 4)));
+}
+
+// 与 DES.c 的 DELTA_SWAP 相同: t = ((a >> n) ^ b) & mask; b ^= t; a ^= t << n (edx 为临时寄存器)
+static void emitDeltaSwap(Emitter *e, int a, int b, int n, uint32_t mask)
+{
+    emitRR(e, 0, 0x89, REG_RDX, a);      // mov edx, a
+    emitRI8(e, 0, 0xC1, 5, REG_RDX, n);  // shr edx, n
+    emitRR(e, 0, 0x31, REG_RDX, b);      // xor edx, b
+    emitBytes(e, 2, 0x81, 0xE2);         // and edx, mask
+    emit32(e, mask);
+    emitRR(e, 0, 0x31, b, REG_RDX);      // xor b, edx
+    emitRI8(e, 0, 0xC1, 4, REG_RDX, n);  // shl edx, n
+    emitRR(e, 0, 0x31, a, REG_RDX);      // xor a, edx
+}
+
+// 第i个S-盒: l ^= SP[i][(rotl(r, 4i-1) >> 26) ^ k], k 为子密钥第i组, 作为立即数
+static void emitSbox(Emitter *e, int l, int r, int i, unsigned k)
+{
+    emitRR(e, 0, 0x89, REG_RDX, r);                      // mov edx, r
+    emitRI8(e, 0, 0xC1, 0, REG_RDX, (4 * i + 31) & 31); // rol edx, 4i-1
+    emitRI8(e, 0, 0xC1, 5, REG_RDX, 26);                 // shr edx, 26
+    if (k)
+        emitRI8(e, 0, 0x83, 6, REG_RDX, k);              // xor edx, k
+    emitRex(e, 0, l, REG_R8);                            // xor l, [r8 + rdx*4 + i*256]
+    emitBytes(e, 3, 0x33, 0x84 | (l & 7) << 3, 0x90);
+    emit32(e, (uint32_t)(i * sizeof(DES_SP_TABLE[0])));
+}
+
+// 处理 lanes 个相邻的块 ([rdi], [rdi+8], ... 写到 [rsi], ...): IP、16轮、交换左右、IP^-1
+static void emitBlockGroup(Emitter *e, const BYTE subkeys[16], int lanes)
+{
+    for (int j = 0; j < lanes; j++)
+    {
+        int l = laneL[j], r = laneR[j];
+        emitMem(e, 0x8B, l, REG_RDI, 8 * j);  // mov l, [rdi + 8j]
+        emitRR(e, 1, 0x89, r, l);             // mov r, l
+        emitRI8(e, 1, 0xC1, 5, l, 32);        // shr l, 32: l 为左半, r 的低32位为右半
+        emitDeltaSwap(e, l, r, 4, 0x0F0F0F0FU);
+        emitDeltaSwap(e, l, r, 16, 0x0000FFFFU);
+        emitDeltaSwap(e, r, l, 2, 0x33333333U);
+        emitDeltaSwap(e, r, l, 8, 0x00FF00FFU);
+        emitDeltaSwap(e, l, r, 1, 0x55555555U);
+    }
+
+    // 16轮完全展开, 左右两半交替承担 l/r, 不需要交换寄存器; 同一S-盒在各块间交错
+    for (int k = 0; k < 16; k++)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            unsigned key = (unsigned)(subkeys[k] >> (42 - 6 * i)) & 0x3F;
+            for (int j = 0; j < lanes; j++)
+            {
+                if (k % 2 == 0)
+                    emitSbox(e, laneL[j], laneR[j], i, key);
+                else
+                    emitSbox(e, laneR[j], laneL[j], i, key);
+            }
+        }
+    }
+
+    // 16轮后左半寄存器为 l, 右半寄存器为 r; 交换左右后右半寄存器为高半, 做逆初始置换
+    for (int j = 0; j < lanes; j++)
+    {
+        int lo = laneL[j], hi = laneR[j];
+        emitDeltaSwap(e, hi, lo, 1, 0x55555555U);
+        emitDeltaSwap(e, lo, hi, 8, 0x00FF00FFU);
+        emitDeltaSwap(e, lo, hi, 2, 0x33333333U);
+        emitDeltaSwap(e, hi, lo, 16, 0x0000FFFFU);
+        emitDeltaSwap(e, hi, lo, 4, 0x0F0F0F0FU);
+        emitRI8(e, 1, 0xC1, 4, hi, 32);       // shl hi, 32
+        emitRR(e, 1, 0x09, hi, lo);           // or hi, lo
+        emitMem(e, 0x89, hi, REG_RSI, 8 * j); // mov [rsi + 8j], hi
+    }
+}
+
+// void fn(const BYTE *in (rdi), BYTE *out (rsi), size_t n (rdx)):
+// 每次交错处理 JIT_LANES 个块, 剩余的块逐个处理
+static void emitBlocksFunction(Emitter *e, const BYTE subkeys[16])
+{
+    // 保存用到的被调用者保存寄存器
+    emitBytes(e, 6, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55); // push rbx, rbp, r12, r13
+    emitRR(e, 1, 0x89, REG_R9, REG_RDX);                 // mov r9, rdx
+    emitBytes(e, 2, 0x49, 0xB8);                         // mov r8, DES_SP_TABLE
+    emit64(e, (uint64_t)(uintptr_t)DES_SP_TABLE);
+
+    emitRI8(e, 1, 0x83, 7, REG_R9, JIT_LANES); // cmp r9, JIT_LANES
+    unsigned char *toTail = emitJcc(e, 0x82);  // jb tail
+    unsigned char *groupLoop = e->p;
+    emitBlockGroup(e, subkeys, JIT_LANES);
+    emitRI8(e, 1, 0x83, 0, REG_RDI, 8 * JIT_LANES); // add rdi, 8*JIT_LANES
+    emitRI8(e, 1, 0x83, 0, REG_RSI, 8 * JIT_LANES); // add rsi, 8*JIT_LANES
+    emitRI8(e, 1, 0x83, 5, REG_R9, JIT_LANES);      // sub r9, JIT_LANES
+    emitRI8(e, 1, 0x83, 7, REG_R9, JIT_LANES);      // cmp r9, JIT_LANES
+    patchJump(emitJcc(e, 0x83), groupLoop);         // jae groupLoop
+
+    patchJump(toTail, e->p);
+    emitRR(e, 1, 0x85, REG_R9, REG_R9);      // test r9, r9
+    unsigned char *toDone = emitJcc(e, 0x84); // jz done
+    unsigned char *tailLoop = e->p;
+    emitBlockGroup(e, subkeys, 1);
+    emitRI8(e, 1, 0x83, 0, REG_RDI, 8);       // add rdi, 8
+    emitRI8(e, 1, 0x83, 0, REG_RSI, 8);       // add rsi, 8
+    emitRI8(e, 1, 0x83, 5, REG_R9, 1);        // sub r9, 1
+    patchJump(emitJcc(e, 0x85), tailLoop);    // jnz tailLoop
+
+    patchJump(toDone, e->p);
+    emitBytes(e, 7, 0x41, 0x5D, 0x41, 0x5C, 0x5D, 0x5B, 0xC3); // pop r13, r12, rbp, rbx; ret
+}
+
+// 生成一个密钥的加密与解密函数: 在可写映射中生成后改为只读可执行. 失败返回0
+static int compileKey(JitEntry *entry, BYTE key)
+{
+    BYTE *subkeys = generate_subkeys(key);
+    if (!subkeys)
+        return 0;
+    BYTE decKeys[16];
+    for (int i = 0; i < 16; i++)
+    {
+        decKeys[i] = subkeys[15 - i];
+    }
+
+    unsigned char *code = mmap(NULL, JIT_MAP_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+    {
+        poolFree(subkeys);
+        return 0;
+    }
+    Emitter e = {code};
+    emitBlocksFunction(&e, subkeys);
+    e.p = code + JIT_FUNC_BYTES;
+    emitBlocksFunction(&e, decKeys);
+    poolFree(subkeys);
+    if (mprotect(code, JIT_MAP_BYTES, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(code, JIT_MAP_BYTES);
+        return 0;
+    }
+
+    entry->code = code;
+    entry->key = key;
+    entry->encrypt = (DES_BlocksFn)(void *)code;
+    entry->decrypt = (DES_BlocksFn)(void *)(code + JIT_FUNC_BYTES);
+    entry->refs = 0;
+    return 1;
+}
+
+// 检查系统是否允许把可写映射改为可执行 (部分加固的内核或容器禁止)
+static int probeExecutable(void)
+{
+    void *page = mmap(NULL, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (page == MAP_FAILED)
+        return 0;
+    int ok = mprotect(page, 4096, PROT_READ | PROT_EXEC) == 0;
+    munmap(page, 4096);
+    return ok;
+}
+
+int jitSetEnabled(bool enable)
+{
+    int ok = !enable || probeExecutable();
+    pthread_mutex_lock(&jitLock);
+    enabled = enable && ok;
+    pthread_mutex_unlock(&jitLock);
+    return ok;
+}
+
+int jitAcquire(BYTE key, DES_BlocksFn *encrypt, DES_BlocksFn *decrypt)
+{
+    pthread_mutex_lock(&jitLock);
+    JitEntry *entry = NULL;
+    if (enabled)
+    {
+        // 已缓存的密钥直接复用, 否则取空槽或最久未用且无人使用的槽
+        JitEntry *victim = NULL;
+        for (int i = 0; i < JIT_CACHE_KEYS; i++)
+        {
+            JitEntry *c = &cache[i];
+            if (c->code && c->key == key)
+            {
+                entry = c;
+                break;
+            }
+            if (c->refs == 0 && (!victim || !c->code || (victim->code && c->lastUse < victim->lastUse)))
+                victim = c;
+        }
+        if (entry)
+            reusedCount++;
+        else if (victim)
+        {
+            if (victim->code)
+            {
+                munmap(victim->code, JIT_MAP_BYTES);
+                victim->code = NULL;
+            }
+            if (compileKey(victim, key))
+            {
+                entry = victim;
+                compiledCount++;
+            }
+        }
+    }
+    if (entry)
+    {
+        entry->refs++;
+        entry->lastUse = ++useClock;
+        *encrypt = entry->encrypt;
+        *decrypt = entry->decrypt;
+    }
+    pthread_mutex_unlock(&jitLock);
+    return entry != NULL;
+}
+
+void jitRelease(BYTE key)
+{
+    pthread_mutex_lock(&jitLock);
+    for (int i = 0; i < JIT_CACHE_KEYS; i++)
+    {
+        if (cache[i].code && cache[i].key == key && cache[i].refs > 0)
+        {
+            cache[i].refs--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&jitLock);
+}
+
+#else // !JIT_SUPPORTED
+
+int jitSetEnabled(bool enable)
+{
+    return !enable;
+}
+
+int jitAcquire(BYTE key, DES_BlocksFn *encrypt, DES_BlocksFn *decrypt)
+{
+    (void)key;
+    (void)encrypt;
+    (void)decrypt;
+    return 0;
+}
+
+void jitRelease(BYTE key)
+{
+    (void)key;
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <stdbool.h>
+#include "DES.h"
+
+// 密钥专用代码生成 (仅 x86-64): 为一个密钥生成批量加/解密函数, 16个子密钥作为立即数写进指令,
+// 16轮完全展开, E扩展用循环移位, S-盒与P-置换查 DES_SP_TABLE, 不再从内存读取子密钥
+// 启用后 DES_scheduleCreate 为新编排取得该密钥的代码, DES_encryptBlocks/DES_decryptBlocks 直接调用;
+// 其他平台或系统禁止可执行映射时保持关闭, 使用通用实现. 线程安全
+// 代码按密钥缓存: 编排释放后仍保留, 同一密钥再次创建编排时直接复用
+
+// 缓存的密钥数上限. 满时淘汰已无编排使用的最久未用项; 全部在用时新编排使用通用实现
+#define JIT_CACHE_KEYS 16
+
+// 启用或关闭, 只影响之后创建的编排. 启用时返回1, 本平台无法生成可执行代码时返回0并保持关闭
+int jitSetEnabled(bool enable);
+
+// 取得密钥的加/解密函数, 引用计数加1. 未启用、不可用或缓存已满时返回0
+int jitAcquire(BYTE key, DES_BlocksFn *encrypt, DES_BlocksFn *decrypt);
+// 引用计数减1, 代码留在缓存中
+void jitRelease(BYTE key);
+
+// 生成过代码的次数与命中缓存的次数
+void jitGetStats(size_t *compiled, size_t *reused);
+
+#endif // JIT_H
@@ -0,0 +1,279 @@
+#define _GNU_SOURCE // vmsplice, splice
+#include "kcrypt.h"
+#include "stream.h"
+#include "pool.h"
+#include <stdio.h>
+#include <string.h>
+
+int parseCryptBackend(const char *name)
+{
+    if (strcmp(name, "des") == 0)
+        return CRYPT_BACKEND_DES;
+    if (strcmp(name, "kernel") == 0)
+        return CRYPT_BACKEND_KERNEL;
+    return -1;
+}
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/if_alg.h>
+
+#ifndef SOL_ALG
+#define SOL_ALG 279
+#endif
+
+// 单个请求的最大字节数: 内核每个请求最多引用16个页面, 未对齐的缓冲区可能跨越9个页面
+#define KERNEL_REQUEST_BYTES (32 * 1024)
+
+struct KernelCipher
+{
+    int tfm;     // 绑定算法并设置了密钥的套接字
+    int op;      // accept 得到的操作套接字, 每个请求在上面收发
+    int pipe[2]; // vmsplice 中转管道, 创建失败时为-1, 此时只用 sendmsg 复制
+    EncryptionMode mode;
+};
+
+// 模式对应的内核算法名, 不支持的模式返回NULL
+static const char *algorithmName(EncryptionMode mode)
+{
+    if (mode == ECB)
+        return "ecb(des)";
+    if (mode == CBC)
+        return "cbc(des)";
+    return NULL;
+}
+
+// 创建绑定到算法的套接字, 失败返回-1
+static int bindAlgorithm(EncryptionMode mode)
+{
+    const char *name = algorithmName(mode);
+    if (!name)
+        return -1;
+    int fd = socket(AF_ALG, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return -1;
+    struct sockaddr_alg sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.salg_family = AF_ALG;
+    strcpy((char *)sa.salg_type, "skcipher");
+    strcpy((char *)sa.salg_name, name);
+    if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void storeBigEndian(BYTE v, unsigned char *p)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        p[i] = (unsigned char)(v >> (56 - 8 * i));
+    }
+}
+
+static BYTE loadBigEndian(const unsigned char *p)
+{
+    BYTE v = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+bool kernelCipherAvailable(EncryptionMode mode)
+{
+    int fd = bindAlgorithm(mode);
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+}
+
+KernelCipher *kernelCipherCreate(EncryptionMode mode, BYTE key)
+{
+    KernelCipher *kc = (KernelCipher *)poolAlloc(sizeof(KernelCipher));
+    if (!kc)
+        return NULL;
+    kc->mode = mode;
+    kc->op = -1;
+    kc->pipe[0] = kc->pipe[1] = -1;
+    kc->tfm = bindAlgorithm(mode);
+    unsigned char keyBytes[8];
+    storeBigEndian(key, keyBytes);
+    if (kc->tfm < 0 || setsockopt(kc->tfm, SOL_ALG, ALG_SET_KEY, keyBytes, sizeof(keyBytes)) != 0 ||
+        (kc->op = accept4(kc->tfm, NULL, NULL, SOCK_CLOEXEC)) < 0)
+    {
+        kernelCipherFree(kc);
+        return NULL;
+    }
+    if (pipe2(kc->pipe, O_CLOEXEC) != 0)
+        kc->pipe[0] = kc->pipe[1] = -1;
+    return kc;
+}
+
+void kernelCipherFree(KernelCipher *kc)
+{
+    if (!kc)
+        return;
+    int fds[] = {kc->pipe[0], kc->pipe[1], kc->op, kc->tfm};
+    for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++)
+    {
+        if (fds[i] >= 0)
+            close(fds[i]);
+    }
+    poolFree(kc);
+}
+
+// 把输入页面经管道拼接到操作套接字, 不复制数据. 最后一段不带 SPLICE_F_MORE, 内核据此结束请求
+static int spliceInput(KernelCipher *kc, const unsigned char *in, size_t len)
+{
+    size_t done = 0;
+    while (done < len)
+    {
+        struct iovec iov = {(void *)(in + done), len - done};
+        ssize_t mapped = vmsplice(kc->pipe[1], &iov, 1, 0);
+        if (mapped <= 0)
+            return 0;
+        size_t end = done + (size_t)mapped;
+        while (done < end)
+        {
+            ssize_t moved = splice(kc->pipe[0], NULL, kc->op, NULL, end - done, end < len ? SPLICE_F_MORE : 0);
+            if (moved <= 0)
+                return 0;
+            done += (size_t)moved;
+        }
+    }
+    return 1;
+}
+
+// 一个请求: 设置方向(及CBC的IV)后提交 len 字节, 再读回同样长度的结果
+static int kernelRequest(KernelCipher *kc, bool decrypt, const unsigned char *iv, const unsigned char *in,
+                         unsigned char *out, size_t len)
+{
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(uint32_t)) + CMSG_SPACE(sizeof(struct af_alg_iv) + 8)];
+        struct cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control = control.buf;
+    msg.msg_controllen = kc->mode == CBC ? sizeof(control.buf) : CMSG_SPACE(sizeof(uint32_t));
+
+    struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_ALG;
+    c->cmsg_type = ALG_SET_OP;
+    c->cmsg_len = CMSG_LEN(sizeof(uint32_t));
+    uint32_t op = decrypt ? ALG_OP_DECRYPT : ALG_OP_ENCRYPT;
+    memcpy(CMSG_DATA(c), &op, sizeof(op));
+    if (kc->mode == CBC)
+    {
+        c = CMSG_NXTHDR(&msg, c);
+        c->cmsg_level = SOL_ALG;
+        c->cmsg_type = ALG_SET_IV;
+        c->cmsg_len = CMSG_LEN(sizeof(struct af_alg_iv) + 8);
+        struct af_alg_iv *algIv = (struct af_alg_iv *)CMSG_DATA(c);
+        algIv->ivlen = 8;
+        memcpy(algIv->iv, iv, 8);
+    }
+
+    // 输入输出不重叠时零拷贝提交; 重叠时拼接的输入页面就是输出, 改用 sendmsg 复制到内核
+    bool zeroCopy = kc->pipe[0] >= 0 && (in + len <= out || out + len <= in);
+    struct iovec iov = {(void *)in, len};
+    if (!zeroCopy)
+    {
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+    }
+    ssize_t sent = sendmsg(kc->op, &msg, zeroCopy ? MSG_MORE : 0);
+    if (sent < 0 || (!zeroCopy && (size_t)sent != len) || (zeroCopy && !spliceInput(kc, in, len)))
+        return 0;
+
+    size_t got = 0;
+    while (got < len)
+    {
+        ssize_t n = read(kc->op, out + got, len - got);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        got += (size_t)n;
+    }
+    return 1;
+}
+
+int kernelCipherProcess(KernelCipher *kc, bool decrypt, BYTE *state, const unsigned char *in, unsigned char *out,
+                        size_t len)
+{
+    unsigned char iv[8];
+    BYTE chain = state ? *state : 0;
+    for (size_t off = 0; off < len; off += KERNEL_REQUEST_BYTES)
+    {
+        size_t n = len - off < KERNEL_REQUEST_BYTES ? len - off : KERNEL_REQUEST_BYTES;
+        storeBigEndian(chain, iv);
+        // CBC 的下一段以本段最后一个密文块为IV; 解密时原地处理会覆盖它, 先保存
+        BYTE lastIn = loadBigEndian(in + off + n - 8);
+        if (!kernelRequest(kc, decrypt, iv, in + off, out + off, n))
+            return 0;
+        chain = decrypt ? lastIn : loadBigEndian(out + off + n - 8);
+    }
+    if (state && kc->mode == CBC)
+        *state = chain;
+    return 1;
+}
+
+#else // !__linux__
+
+bool kernelCipherAvailable(EncryptionMode mode)
+{
+    (void)mode;
+    return false;
+}
+
+KernelCipher *kernelCipherCreate(EncryptionMode mode, BYTE key)
+{
+    (void)mode;
+    (void)key;
+    return NULL;
+}
+
+void kernelCipherFree(KernelCipher *kc)
+{
+    (void)kc;
+}
+
+int kernelCipherProcess(KernelCipher *kc, bool decrypt, BYTE *state, const unsigned char *in, unsigned char *out,
+                        size_t len)
+{
+    (void)kc;
+    (void)decrypt;
+    (void)state;
+    (void)in;
+    (void)out;
+    (void)len;
+    return 0;
+}
+
+#endif
+
+int kernelProcessFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                      const char *inPath, const char *outPath)
+{
+    KernelCipher *kc = kernelCipherCreate(mode, des->schedule->key);
+    if (!kc)
+        fprintf(stderr, "Warning: Kernel crypto API has no DES %s support, using the DES.c engine\n",
+                mode == CBC ? "CBC" : "ECB");
+    int ok = streamProcessFileKernel(des, kc, mode, decrypt, binary, binaryOut, inPath, outPath);
+    kernelCipherFree(kc);
+    return ok;
+}
@@ -0,0 +1,41 @@
+#ifndef KCRYPT_H
+#define KCRYPT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "DES.h"
+#include "enum.h"
+
+// Linux 内核加密接口 (AF_ALG) 后端: ECB/CBC 交给内核的 "ecb(des)"/"cbc(des)" skcipher 实现
+// (通用软件实现或加速驱动). 数据为原始字节(块按大端存放), 与文件中的字节序一致, 不经过 BYTE 转换
+// 输入与输出不同时用 vmsplice/splice 把输入页面直接交给内核, 否则用 sendmsg 复制
+
+typedef enum
+{
+    CRYPT_BACKEND_DES,   // 默认: DES.c 实现
+    CRYPT_BACKEND_KERNEL // 内核加密接口 (仅 Linux, ECB/CBC)
+} CryptBackend;
+
+// 解析后端名称 "des" / "kernel", 未知名称返回-1
+int parseCryptBackend(const char *name);
+
+typedef struct KernelCipher KernelCipher;
+
+// 运行时检查内核是否提供该模式的 DES 实现. 非 Linux 或模式不是 ECB/CBC 时返回false
+bool kernelCipherAvailable(EncryptionMode mode);
+
+// 为密钥创建会话, 失败(内核不支持或拒绝该密钥)返回NULL
+KernelCipher *kernelCipherCreate(EncryptionMode mode, BYTE key);
+void kernelCipherFree(KernelCipher *kc);
+
+// 加/解密 len 字节 (8的整数倍), in 与 out 可相同
+// CBC 时 state 为链接状态(初值为IV), 返回后更新为最后一个密文块, 可接着处理后续数据. 成功返回1
+int kernelCipherProcess(KernelCipher *kc, bool decrypt, BYTE *state, const unsigned char *in, unsigned char *out,
+                        size_t len);
+
+// 用内核后端流式处理单个文件, 参数与输出同 streamProcessFile
+// 内核不支持时打印警告并改用 DES.c 实现. 成功返回1
+int kernelProcessFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                      const char *inPath, const char *outPath);
+
+#endif // KCRYPT_H
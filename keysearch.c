@@ -0,0 +1,496 @@
+#include "keysearch.h"
+#include "DESConstants.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+// 位切片字: 第i位属于第i个候选密钥
+typedef uint64_t bsword;
+
+// 每个线程一次领取的密钥数 (64个一批, 共1024批)
+#define KEYSEARCH_BLOCK (1ULL << 16)
+// 不输出进度时检查点的写入间隔(秒)
+#define KEYSEARCH_CHECKPOINT_SECONDS 10
+
+// 第r轮子密钥第j位(MSB起)取自原始密钥的哪一位(0..63, MSB起)
+static uint8_t roundKeyBit[16][48];
+// 56位索引的第i位(MSB起)对应的密钥位置, 跳过奇偶校验位
+static uint8_t indexKeyBit[56];
+// P置换的逆: S盒输出第q位落在f输出的哪一位
+static uint8_t pInverse[32];
+// S盒真值表: [盒][输出位][高3位输入] -> 低3位输入的8位真值表
+static uint8_t sboxTable[8][4][8];
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+static void buildTables()
+{
+    for (int i = 0, n = 0; i < 64; i++)
+    {
+        if (i % 8 != 7)
+            indexKeyBit[n++] = (uint8_t)i;
+    }
+
+    // 按 generate_subkeys 的移位过程追踪每个子密钥位的来源
+    int shift = 0;
+    for (int r = 0; r < 16; r++)
+    {
+        shift += SHIFTS[r];
+        for (int j = 0; j < 48; j++)
+        {
+            int cd = PC2[j] - 1;
+            int half = cd < 28 ? 0 : 28;
+            int src = half + (cd - half + shift) % 28;
+            roundKeyBit[r][j] = (uint8_t)(PC1[src] - 1);
+        }
+    }
+
+    for (int i = 0; i < 32; i++)
+    {
+        pInverse[P[i] - 1] = (uint8_t)i;
+    }
+
+    // 6位输入 m = b1..b6 (b1为最高位), 行 = b1b6, 列 = b2..b5
+    for (int s = 0; s < 8; s++)
+    {
+        for (int m = 0; m < 64; m++)
+        {
+            int row = ((m >> 5) << 1) | (m & 1);
+            int col = (m >> 1) & 0x0F;
+            int v = S_BOXES[s][row][col];
+            for (int o = 0; o < 4; o++)
+            {
+                if ((v >> (3 - o)) & 1)
+                    sboxTable[s][o][m >> 3] |= (uint8_t)(1 << (m & 7));
+            }
+        }
+    }
+}
+
+BYTE keyIndexToKey(uint64_t index)
+{
+    pthread_once(&tablesOnce, buildTables);
+    BYTE key = 0;
+    for (int i = 0; i < 56; i++)
+    {
+        if ((index >> (55 - i)) & 1)
+            key |= 1ULL << (63 - indexKeyBit[i]);
+    }
+    // 每字节最低位为奇校验位
+    for (int b = 0; b < 8; b++)
+    {
+        if (!__builtin_parityll((key >> (b * 8)) & 0xFE))
+            key |= 1ULL << (b * 8);
+    }
+    return key;
+}
+
+uint64_t keyToIndex(BYTE key)
+{
+    pthread_once(&tablesOnce, buildTables);
+    uint64_t index = 0;
+    for (int i = 0; i < 56; i++)
+    {
+        index |= ((key >> (63 - indexKeyBit[i])) & 1) << (55 - i);
+    }
+    return index;
+}
+
+// 位切片S盒: 输入x[0..5]为b1..b6, 输出out[0..3]为4位输出(MSB起)
+// 把6输入函数按Shannon展开为多路选择树: 先枚举(b5,b6)的全部16个函数,
+// 再由真值表选取并依次按b4、b3、b2、b1合并
+static inline void bsSbox(int s, const bsword x[6], bsword out[4])
+{
+    bsword t2[16];
+    bsword minterm[4] = {~x[4] & ~x[5], ~x[4] & x[5], x[4] & ~x[5], x[4] & x[5]};
+    t2[0] = 0;
+    for (int tt = 1; tt < 16; tt++)
+    {
+        t2[tt] = t2[tt & (tt - 1)] | minterm[__builtin_ctz(tt)];
+    }
+
+    for (int o = 0; o < 4; o++)
+    {
+        const uint8_t *tt = sboxTable[s][o];
+        bsword node[8];
+        for (int n = 0; n < 8; n++)
+        {
+            bsword lo = t2[tt[n] & 0x0F], hi = t2[tt[n] >> 4];
+            node[n] = lo ^ ((lo ^ hi) & x[3]);
+        }
+        for (int n = 0; n < 4; n++)
+        {
+            node[n] = node[2 * n] ^ ((node[2 * n] ^ node[2 * n + 1]) & x[2]);
+        }
+        node[0] = node[0] ^ ((node[0] ^ node[1]) & x[1]);
+        node[1] = node[2] ^ ((node[2] ^ node[3]) & x[1]);
+        out[o] = node[0] ^ ((node[0] ^ node[1]) & x[0]);
+    }
+}
+
+// 一轮Feistel: left ^= f(right, K_r), 密钥调度只是对密钥位字的下标选择
+static inline void bsRound(bsword left[32], const bsword right[32], const bsword key[64], int r)
+{
+    const uint8_t *kb = roundKeyBit[r];
+    for (int s = 0; s < 8; s++)
+    {
+        bsword x[6], y[4];
+        for (int j = 0; j < 6; j++)
+        {
+            x[j] = right[E[s * 6 + j] - 1] ^ key[kb[s * 6 + j]];
+        }
+        bsSbox(s, x, y);
+        for (int o = 0; o < 4; o++)
+        {
+            left[pInverse[s * 4 + o]] ^= y[o];
+        }
+    }
+}
+
+// 已知明文/密文预先做IP, 搜索时只比较16轮后的 R16||L16
+typedef struct
+{
+    BYTE ipPlain;
+    BYTE ipCipher;
+} KeySearchTarget;
+
+static void targetInit(KeySearchTarget *t, BYTE plaintext, BYTE ciphertext)
+{
+    pthread_once(&tablesOnce, buildTables);
+    t->ipPlain = IP_transform(plaintext);
+    t->ipCipher = IP_transform(ciphertext);
+}
+
+static inline bsword bitWord(BYTE v, int pos)
+{
+    return (bsword)0 - ((v >> (63 - pos)) & 1);
+}
+
+// 测试 base..base+63 这64个索引, 返回匹配的位掩码
+static uint64_t searchBatch(const KeySearchTarget *t, uint64_t base)
+{
+    // 低6位索引在各通道间变化, 其余位在所有通道相同
+    static const bsword lanePattern[6] = {
+        0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+        0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+    bsword key[64] = {0};
+    for (int i = 0; i < 50; i++)
+    {
+        key[indexKeyBit[i]] = (bsword)0 - ((base >> (55 - i)) & 1);
+    }
+    for (int b = 0; b < 6; b++)
+    {
+        key[indexKeyBit[55 - b]] = lanePattern[b];
+    }
+
+    bsword half[2][32];
+    for (int i = 0; i < 32; i++)
+    {
+        half[0][i] = bitWord(t->ipPlain, i);
+        half[1][i] = bitWord(t->ipPlain, 32 + i);
+    }
+    // 每轮更新左半部分后交换角色, 15轮后 half[cur] 为 L15, half[cur^1] 为 R15
+    int cur = 0;
+    for (int r = 0; r < 15; r++)
+    {
+        bsRound(half[cur], half[cur ^ 1], key, r);
+        cur ^= 1;
+    }
+
+    // L16 = R15 无需计算: 先用它淘汰绝大多数通道, 全部淘汰时省去第16轮
+    bsword match = ~(bsword)0;
+    const bsword *r15 = half[cur ^ 1];
+    for (int i = 0; i < 32 && match; i++)
+    {
+        match &= ~(r15[i] ^ bitWord(t->ipCipher, 32 + i));
+    }
+    if (!match)
+        return 0;
+    bsRound(half[cur], r15, key, 15);
+    for (int i = 0; i < 32 && match; i++)
+    {
+        match &= ~(half[cur][i] ^ bitWord(t->ipCipher, i));
+    }
+    return match;
+}
+
+uint64_t keySearchBatch(BYTE plaintext, BYTE ciphertext, uint64_t base)
+{
+    KeySearchTarget t;
+    targetInit(&t, plaintext, ciphertext);
+    return searchBatch(&t, base);
+}
+
+// 搜索的共享状态
+typedef struct
+{
+    KeySearchTarget target;
+    uint64_t rangeStart; // 用户给定的区间起点, 写入检查点
+    uint64_t start, end; // 本次实际搜索的 [start, end)
+    uint64_t origin;     // start 向下对齐到64
+    uint64_t blocks;     // 区间内的分块数
+    uint64_t nextBlock;  // 下一个待领取的分块, 原子递增
+    uint64_t tested;     // 已测试的密钥数, 原子累加
+    int stopped;         // 找满或被中断
+    volatile sig_atomic_t *stop;
+    pthread_mutex_t lock;
+    BYTE *found;
+    int foundCount, maxFound;
+} SearchContext;
+
+typedef struct
+{
+    SearchContext *ctx;
+    pthread_t thread;
+    uint64_t current; // 正在处理的分块, 空闲时为 UINT64_MAX
+} SearchWorker;
+
+static void recordKey(SearchContext *ctx, BYTE key)
+{
+    pthread_mutex_lock(&ctx->lock);
+    int dup = 0;
+    for (int i = 0; i < ctx->foundCount; i++)
+    {
+        dup |= ctx->found[i] == key;
+    }
+    if (!dup && ctx->foundCount < ctx->maxFound)
+        ctx->found[ctx->foundCount++] = key;
+    if (ctx->foundCount >= ctx->maxFound)
+        __atomic_store_n(&ctx->stopped, 1, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+static void *searchWorkerMain(void *arg)
+{
+    SearchWorker *w = (SearchWorker *)arg;
+    SearchContext *ctx = w->ctx;
+    for (;;)
+    {
+        // 先登记再领取, 检查点不会越过正在处理的分块
+        __atomic_store_n(&w->current, __atomic_load_n(&ctx->nextBlock, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+        uint64_t block = __atomic_fetch_add(&ctx->nextBlock, 1, __ATOMIC_SEQ_CST);
+        if (block >= ctx->blocks)
+            break;
+        // 停止时保留已领取但未处理的分块, 检查点从它开始
+        __atomic_store_n(&w->current, block, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ctx->stopped, __ATOMIC_RELAXED) || (ctx->stop && *ctx->stop))
+            return NULL;
+
+        uint64_t lo = ctx->origin + block * KEYSEARCH_BLOCK;
+        uint64_t hi = lo + KEYSEARCH_BLOCK < ctx->end ? lo + KEYSEARCH_BLOCK : ctx->end;
+        for (uint64_t base = lo; base < hi; base += 64)
+        {
+            uint64_t match = searchBatch(&ctx->target, base);
+            while (match)
+            {
+                uint64_t index = base + __builtin_ctzll(match);
+                match &= match - 1;
+                if (index >= ctx->start && index < ctx->end)
+                    recordKey(ctx, keyIndexToKey(index));
+            }
+        }
+        uint64_t first = lo > ctx->start ? lo : ctx->start;
+        __atomic_fetch_add(&ctx->tested, hi - first, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&w->current, UINT64_MAX, __ATOMIC_SEQ_CST);
+    return NULL;
+}
+
+// 所有编号小于返回值的分块都已完成
+static uint64_t completedBlocks(SearchContext *ctx, SearchWorker *workers, int n)
+{
+    uint64_t done = __atomic_load_n(&ctx->nextBlock, __ATOMIC_SEQ_CST);
+    for (int i = 0; i < n; i++)
+    {
+        uint64_t cur = __atomic_load_n(&workers[i].current, __ATOMIC_SEQ_CST);
+        if (cur < done)
+            done = cur;
+    }
+    return done < ctx->blocks ? done : ctx->blocks;
+}
+
+// 检查点为文本格式, 先写临时文件再改名, 中途崩溃不会留下半个文件
+static int writeCheckpoint(const char *path, SearchContext *ctx, uint64_t resumeAt)
+{
+    char tmp[4096];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *fp = fopen(tmp, "w");
+    if (!fp)
+    {
+        fprintf(stderr, "Error: Unable to write checkpoint %s: %s\n", tmp, strerror(errno));
+        return 0;
+    }
+    fprintf(fp, "# e1des key search checkpoint\n");
+    fprintf(fp, "plaintext %016llX\n", IP_inv_transform(ctx->target.ipPlain));
+    fprintf(fp, "ciphertext %016llX\n", IP_inv_transform(ctx->target.ipCipher));
+    fprintf(fp, "range %014llX %014llX\n", (unsigned long long)ctx->rangeStart, (unsigned long long)ctx->end);
+    fprintf(fp, "next %014llX\n", (unsigned long long)resumeAt);
+    pthread_mutex_lock(&ctx->lock);
+    for (int i = 0; i < ctx->foundCount; i++)
+    {
+        fprintf(fp, "found %016llX\n", ctx->found[i]);
+    }
+    pthread_mutex_unlock(&ctx->lock);
+    int ok = fclose(fp) == 0 && rename(tmp, path) == 0;
+    if (!ok)
+        fprintf(stderr, "Error: Unable to write checkpoint %s\n", path);
+    return ok;
+}
+
+// 读取检查点, 明文/密文/区间须与本次搜索一致. 文件不存在返回0, 不匹配或损坏返回-1
+static int readCheckpoint(const char *path, SearchContext *ctx, uint64_t *resumeAt)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return 0;
+    char line[256];
+    unsigned long long plain = 0, cipher = 0, start = 0, end = 0, next = 0, key;
+    int fields = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        if (sscanf(line, "plaintext %llx", &plain) == 1 || sscanf(line, "ciphertext %llx", &cipher) == 1)
+            fields++;
+        else if (sscanf(line, "range %llx %llx", &start, &end) == 2)
+            fields++;
+        else if (sscanf(line, "next %llx", &next) == 1)
+            fields++;
+        else if (sscanf(line, "found %llx", &key) == 1)
+            recordKey(ctx, key);
+    }
+    fclose(fp);
+    if (fields != 4 || plain != IP_inv_transform(ctx->target.ipPlain) ||
+        cipher != IP_inv_transform(ctx->target.ipCipher) || start != ctx->rangeStart || end != ctx->end ||
+        next < start || next > end)
+    {
+        fprintf(stderr, "Error: Checkpoint %s does not match this search\n", path);
+        return -1;
+    }
+    *resumeAt = next;
+    return 1;
+}
+
+static double elapsedSeconds(const struct timespec *since)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - since->tv_sec) + (now.tv_nsec - since->tv_nsec) / 1e9;
+}
+
+int keySearch(const KeySearchParams *params, BYTE *found, int maxFound)
+{
+    if (params->start >= params->end || params->end > KEYSEARCH_SPACE || maxFound <= 0)
+    {
+        fprintf(stderr, "Error: Invalid key search range\n");
+        return -1;
+    }
+    int numThreads = params->threads;
+    if (numThreads <= 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    SearchContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    targetInit(&ctx.target, params->plaintext, params->ciphertext);
+    ctx.rangeStart = params->start;
+    ctx.start = params->start;
+    ctx.end = params->end;
+    ctx.stop = params->stop;
+    ctx.found = found;
+    ctx.maxFound = maxFound;
+    pthread_mutex_init(&ctx.lock, NULL);
+
+    uint64_t resumeAt = params->start;
+    if (params->checkpointPath)
+    {
+        int r = readCheckpoint(params->checkpointPath, &ctx, &resumeAt);
+        if (r < 0)
+        {
+            pthread_mutex_destroy(&ctx.lock);
+            return -1;
+        }
+        if (r > 0)
+            fprintf(stderr, "Resuming from %014llX (%d key(s) already found)\n",
+                    (unsigned long long)resumeAt, ctx.foundCount);
+    }
+    // 恢复点之前的密钥已测试过, 分块从恢复点所在的对齐位置开始
+    ctx.start = resumeAt;
+    ctx.origin = resumeAt & ~63ULL;
+    ctx.blocks = (params->end - ctx.origin + KEYSEARCH_BLOCK - 1) / KEYSEARCH_BLOCK;
+    ctx.stopped = ctx.foundCount >= maxFound || resumeAt >= params->end;
+
+    SearchWorker *workers = (SearchWorker *)calloc(numThreads, sizeof(SearchWorker));
+    if (!workers)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        pthread_mutex_destroy(&ctx.lock);
+        return -1;
+    }
+    int started = 0;
+    for (; started < numThreads; started++)
+    {
+        workers[started].ctx = &ctx;
+        workers[started].current = 0;
+        if (pthread_create(&workers[started].thread, NULL, searchWorkerMain, &workers[started]) != 0)
+            break;
+    }
+    if (started == 0)
+    {
+        fprintf(stderr, "Error: Unable to start search threads\n");
+        free(workers);
+        pthread_mutex_destroy(&ctx.lock);
+        return -1;
+    }
+
+    // 主线程负责进度输出和周期性检查点
+    struct timespec begin;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    int interval = params->progressInterval > 0 ? params->progressInterval : KEYSEARCH_CHECKPOINT_SECONDS;
+    uint64_t total = params->end - resumeAt;
+    for (int tick = 1;; tick++)
+    {
+        uint64_t done = completedBlocks(&ctx, workers, started);
+        if (done >= ctx.blocks || __atomic_load_n(&ctx.stopped, __ATOMIC_RELAXED) ||
+            (ctx.stop && *ctx.stop))
+            break;
+        sleep(1);
+        if (tick % interval != 0)
+            continue;
+        if (params->progressInterval > 0)
+        {
+            uint64_t tested = __atomic_load_n(&ctx.tested, __ATOMIC_RELAXED);
+            double secs = elapsedSeconds(&begin);
+            double rate = secs > 0 ? tested / secs : 0;
+            fprintf(stderr, "Progress: %.2f%% %llu keys, %.2f Mkeys/s, ETA %.0f s\n",
+                    total ? 100.0 * tested / total : 100.0, (unsigned long long)tested, rate / 1e6,
+                    rate > 0 ? (total - tested) / rate : 0.0);
+        }
+        if (params->checkpointPath)
+        {
+            uint64_t at = ctx.origin + completedBlocks(&ctx, workers, started) * KEYSEARCH_BLOCK;
+            writeCheckpoint(params->checkpointPath, &ctx, at > resumeAt ? (at < params->end ? at : params->end) : resumeAt);
+        }
+    }
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    double secs = elapsedSeconds(&begin);
+    uint64_t tested = __atomic_load_n(&ctx.tested, __ATOMIC_RELAXED);
+    if (params->progressInterval > 0)
+        fprintf(stderr, "Tested %llu keys in %.2f s (%.2f Mkeys/s, %d threads)\n",
+                (unsigned long long)tested, secs, secs > 0 ? tested / secs / 1e6 : 0.0, started);
+    if (params->checkpointPath)
+    {
+        uint64_t at = ctx.origin + completedBlocks(&ctx, workers, started) * KEYSEARCH_BLOCK;
+        writeCheckpoint(params->checkpointPath, &ctx, at > resumeAt ? (at < params->end ? at : params->end) : resumeAt);
+    }
+    free(workers);
+    pthread_mutex_destroy(&ctx.lock);
+    return ctx.foundCount;
+}
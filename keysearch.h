@@ -0,0 +1,36 @@
+#ifndef KEYSEARCH_H
+#define KEYSEARCH_H
+
+#include <signal.h>
+#include <stdint.h>
+#include "DES.h"
+
+// 已知明文/密文对的DES密钥穷举搜索 (用于审计遗留密钥)
+// 密钥用56位索引表示: 索引最高位对应密钥第1位, 依次跳过每字节的奇偶校验位(第8、16、...、64位)
+// 核心采用位切片实现: 64个密钥并行, 每个机器字的第i位属于第i个密钥
+
+#define KEYSEARCH_SPACE (1ULL << 56)
+
+typedef struct
+{
+    BYTE plaintext;
+    BYTE ciphertext;
+    uint64_t start;             // 搜索区间 [start, end), 56位索引
+    uint64_t end;
+    int threads;                // <=0 时取CPU核数
+    const char *checkpointPath; // 非空时定期写入检查点, 启动时若存在则从中恢复
+    int progressInterval;       // 进度/检查点间隔(秒), <=0 表示不输出进度
+    volatile sig_atomic_t *stop; // 可为NULL; 置位后各线程尽快停止并写入检查点
+} KeySearchParams;
+
+// 56位索引与64位密钥互相转换, 生成的密钥带奇校验位
+BYTE keyIndexToKey(uint64_t index);
+uint64_t keyToIndex(BYTE key);
+
+// 测试从 base(须为64的倍数)开始的64个密钥, 返回匹配的位掩码
+uint64_t keySearchBatch(BYTE plaintext, BYTE ciphertext, uint64_t base);
+
+// 在多线程上搜索整个区间, 匹配的密钥写入found(最多maxFound个), 返回找到的个数, 出错返回-1
+int keySearch(const KeySearchParams *params, BYTE *found, int maxFound);
+
+#endif // KEYSEARCH_H
@@ -0,0 +1,52 @@
+#ifndef LIBDES_H
+#define LIBDES_H
+
+// libdes 公共接口: 包含此头文件即可在进程内使用 DES 核心、工作模式、MAC、流式与文件 I/O 辅助函数
+// 链接 -ldes (静态库 libdes.a 或共享库 libdes.so), 另需 -pthread
+//
+// 线程安全约定:
+// - 函数出错时返回错误值, 不会终止进程
+// - 以下状态是进程全局的, 由同一进程中的所有使用者共享, 内部加锁或用原子操作访问:
+//   缓冲区池、密钥专用代码缓存、运行指标分片. 下列设置函数因此作用于整个进程, 可从任意线程调用,
+//   只影响之后开始的操作, 宜在启动时调用一次:
+//   modeSetStreamingThreshold, poolSetHugePages, poolTrim, jitSetEnabled, metricsSetEnabled, metricsReset
+// - 除此之外不使用全局可变状态, 其余函数只访问参数传入的对象
+// - 密钥编排 (DES_scheduleCreate) 创建后只读, 可由所有线程共享; 每个线程或每次操作用 DES_bind
+//   在栈上绑定自己的上下文(含IV), 无需分配内存
+// - 设置好密钥的 DES 实例只被读取, 可由多个线程同时用于加解密;
+//   DES_setKey/DES_setIV/DES_destroy 须与使用该实例的其他调用串行
+// - CryptStream 等带状态的对象每个线程各用一个
+// - 异步任务 (async.h) 的线程池可由多个线程同时提交、取回和取消
+// - 运行指标 (metrics.h) 每个线程记录到自己的分片, 导出可与记录同时进行
+// - 返回新数组的函数从缓冲区池分配, 用 poolFree 释放
+
+#define LIBDES_VERSION_MAJOR 2
+#define LIBDES_VERSION_MINOR 1
+#define LIBDES_VERSION_PATCH 0
+#define LIBDES_VERSION "2.1.0"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "DES.h"
+#include "jit.h"
+#include "workMode.h"
+#include "util.h"
+#include "pool.h"
+#include "stream.h"
+#include "kcrypt.h"
+#include "range.h"
+#include "mac.h"
+#include "async.h"
+#include "metrics.h"
+
+// 运行时链接的库版本, 可与编译时的 LIBDES_VERSION 比较
+const char *DES_libraryVersion(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIBDES_H
@@ -0,0 +1,122 @@
+#include "mac.h"
+#include <string.h>
+
+// 每组同时推进的消息数, 与多路CBC相同
+#define MAC_LANES 64
+
+// 填充后的块数
+static size_t macBlocks(size_t length, MacPadding pad)
+{
+    if (pad == MAC_PAD_BIT)
+        return length / 8 + 1;
+    return length ? (length + 7) / 8 : 1;
+}
+
+// 取填充后消息的第index块 (大端序)
+static BYTE macBlock(const unsigned char *data, size_t length, size_t index, MacPadding pad)
+{
+    size_t offset = index * 8;
+    BYTE block = 0;
+    if (offset + 8 <= length)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            block = (block << 8) | data[offset + j];
+        }
+        return block;
+    }
+    // 最后一块: 剩余字节 + 填充
+    size_t rest = length > offset ? length - offset : 0;
+    for (size_t j = 0; j < 8; j++)
+    {
+        unsigned char b = 0;
+        if (j < rest)
+            b = data[offset + j];
+        else if (j == rest && pad == MAC_PAD_BIT)
+            b = 0x80;
+        block = (block << 8) | b;
+    }
+    return block;
+}
+
+BYTE DES_cbcMac(DES *des, const unsigned char *data, size_t length, MacPadding pad)
+{
+    BYTE state = 0;
+    size_t blocks = macBlocks(length, pad);
+    for (size_t i = 0; i < blocks; i++)
+    {
+        state = DES_encryptBlock(des, state ^ macBlock(data, length, i, pad));
+    }
+    return state;
+}
+
+BYTE DES_retailMac(DES *k1, DES *k2, const unsigned char *data, size_t length, MacPadding pad)
+{
+    BYTE tag = DES_cbcMac(k1, data, length, pad);
+    return DES_encryptBlock(k1, DES_decryptBlock(k2, tag));
+}
+
+void DES_cbcMacBatch(DES *des, MacMessage *messages, size_t count, MacPadding pad)
+{
+    MacMessage *lane[MAC_LANES];
+    size_t laneBlocks[MAC_LANES];
+    BYTE state[MAC_LANES];
+    for (size_t g = 0; g < count; g += MAC_LANES)
+    {
+        size_t n = count - g < MAC_LANES ? count - g : MAC_LANES;
+        // 按块数降序排列, 每一步仍未结束的消息总是前缀
+        for (size_t i = 0; i < n; i++)
+        {
+            MacMessage *m = &messages[g + i];
+            size_t blocks = macBlocks(m->length, pad);
+            size_t j = i;
+            for (; j > 0 && laneBlocks[j - 1] < blocks; j--)
+            {
+                lane[j] = lane[j - 1];
+                laneBlocks[j] = laneBlocks[j - 1];
+            }
+            lane[j] = m;
+            laneBlocks[j] = blocks;
+        }
+
+        memset(state, 0, sizeof(state));
+        size_t active = n;
+        for (size_t step = 0;; step++)
+        {
+            // 结束的消息落在末尾, 其寄存器即为标签
+            while (active > 0 && laneBlocks[active - 1] <= step)
+            {
+                active--;
+                lane[active]->tag = state[active];
+            }
+            if (active == 0)
+                break;
+            for (size_t i = 0; i < active; i++)
+            {
+                state[i] ^= macBlock(lane[i]->data, lane[i]->length, step, pad);
+            }
+            DES_encryptBlocks(des, state, state, active);
+        }
+    }
+}
+
+void DES_retailMacBatch(DES *k1, DES *k2, MacMessage *messages, size_t count, MacPadding pad)
+{
+    DES_cbcMacBatch(k1, messages, count, pad);
+    // 最后的 D_k2 / E_k1 也按组批量执行
+    BYTE tags[MAC_LANES];
+    for (size_t g = 0; g < count; g += MAC_LANES)
+    {
+        size_t n = count - g < MAC_LANES ? count - g : MAC_LANES;
+        for (size_t i = 0; i < n; i++)
+        {
+            tags[i] = messages[g + i].tag;
+        }
+        DES_decryptBlocks(k2, tags, tags, n);
+        DES_encryptBlocks(k1, tags, tags, n);
+        for (size_t i = 0; i < n; i++)
+        {
+            messages[g + i].tag = tags[i];
+        }
+    }
+}
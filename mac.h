@@ -0,0 +1,35 @@
+#ifndef MAC_H
+#define MAC_H
+
+#include <stddef.h>
+#include "DES.h"
+
+// DES消息认证码: CBC-MAC (ISO/IEC 9797-1 算法1) 和零售MAC (算法3, ANSI X9.19)
+// 只保留链接寄存器, 不生成密文. IV固定为0
+
+// ISO/IEC 9797-1 填充方法
+typedef enum
+{
+    MAC_PAD_ZERO = 1, // 方法1: 补0到8字节的整数倍, 空消息补成一个全0块
+    MAC_PAD_BIT = 2   // 方法2: 先补0x80再补0, 总会多出填充字节
+} MacPadding;
+
+// 批量计算中的一条消息, tag 为输出
+typedef struct
+{
+    const unsigned char *data;
+    size_t length;
+    BYTE tag;
+} MacMessage;
+
+// CBC-MAC: 最后一个密文块
+BYTE DES_cbcMac(DES *des, const unsigned char *data, size_t length, MacPadding pad);
+
+// 零售MAC: 用 k1 做CBC-MAC, 最后一块再用 k2 解密、k1 加密
+BYTE DES_retailMac(DES *k1, DES *k2, const unsigned char *data, size_t length, MacPadding pad);
+
+// 批量版本: 多条消息齐步推进, 每一步各取一块交给交错执行的批量内核
+void DES_cbcMacBatch(DES *des, MacMessage *messages, size_t count, MacPadding pad);
+void DES_retailMacBatch(DES *k1, DES *k2, MacMessage *messages, size_t count, MacPadding pad);
+
+#endif // MAC_H
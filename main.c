@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
+#include <errno.h>
 #ifdef _WIN32
 #include "getopt.h" // 从第三方源码拷贝到项目
 #else
@@ -11,12 +13,59 @@
 #include "enum.h"
 #include "util.h"     // 引入util.h头文件
 #include "workMode.h" // 引入workMode.h头文件
+#include "batch.h"
+#include "service.h"
+#include "shmring.h"
+#include "iopipe.h"
+#include "range.h"
+#include "mac.h"
+#include "stream.h"
+#include "pool.h"
+#include "jit.h"
+#include "kcrypt.h"
+#include "autotune.h"
+#include "incr.h"
 
 // DES相关常量定义
 #define BLOCK_SIZE 1 // 现在1个BYTE代表一个64位块
 #define KEY_SIZE 1   // 密钥大小为1个BYTE (64位)
 #define IV_SIZE 1    // 初始化向量大小为1个BYTE (64位)
 
+// --offset/--length 的值: 只接受非负整数(可带 0x 前缀), 拒绝负号、空白和多余字符. 成功返回1
+static int parseRangeValue(const char *text, unsigned long long *value)
+{
+    if (!isdigit((unsigned char)text[0]))
+        return 0;
+    char *end;
+    errno = 0;
+    *value = strtoull(text, &end, 0);
+    return errno == 0 && *end == '\0';
+}
+
+// 读取第二个密钥(零售MAC)后计算MAC
+static int processMacWithKey2(DES *des, const char *key2FilePath, const char *inPath, int pad, const char *outPath)
+{
+    if (key2FilePath == NULL)
+        return processMacFile(des, NULL, inPath, pad, outPath);
+    size_t key2Size = 0;
+    BYTE *key2 = readHexFile(key2FilePath, &key2Size);
+    if (!key2 || key2Size != KEY_SIZE)
+    {
+        fprintf(stderr, "Error: Key must be 16 hexadecimal characters (64 bits)\n");
+        poolFree(key2);
+        return 0;
+    }
+    DES *des2 = DES_create();
+    int ok = 0;
+    if (des2 && DES_setKey(des2, key2, key2Size))
+        ok = processMacFile(des, des2, inPath, pad, outPath);
+    else
+        fprintf(stderr, "Error: Unable to set the second MAC key\n");
+    DES_destroy(des2);
+    poolFree(key2);
+    return ok;
+}
+
 int main(int argc, char *argv[])
 {
     // 参数解析
@@ -25,10 +74,85 @@ int main(int argc, char *argv[])
     char *ivFilePath = NULL;
     char *modeName = NULL;
     char *cipherFilePath = NULL;
+    char *manifestPath = NULL;
+    char *socketPath = NULL;
+    char *keyTablePath = NULL;
+    char *ringName = NULL;
+    int numThreads = 0;
     bool decrypt = false;
+    size_t chunkedBytes = 0; // 非0时使用分块CBC容器
+    bool rangeMode = false;  // 只解密 [rangeOffset, rangeOffset+rangeLength)
+    unsigned long long rangeOffset = 0, rangeLength = 0;
+    bool rangeInvalid = false; // --offset/--length 不是非负整数
+    bool binaryInput = false;
+    bool binaryOutput = false;
+    char *macName = NULL; // "cbc" 或 "retail"
+    char *key2FilePath = NULL;
+    int macPad = MAC_PAD_ZERO;
+    bool allocStats = false;
+    CryptBackend backend = CRYPT_BACKEND_DES;
+    bool autotune = false;
+    char *profilePath = NULL;
+    bool incremental = false;
+    char *incrManifestPath = NULL; // NULL 时为输出文件名加 .manifest
+    char *metricsSocket = NULL;    // 服务模式的指标导出
+    char *metricsFile = NULL;
+    // 命令行显式给出的参数不被配置文件覆盖
+    bool chunkedDefault = false, ioChunkSet = false, queueDepthSet = false, jitSet = false;
+    IoPipelineOptions ioOpts;
+    ioPipelineDefaults(&ioOpts);
+
+    // 长选项 (无对应短选项的使用大于255的值)
+    enum
+    {
+        OPT_IO = 256,
+        OPT_DIRECT,
+        OPT_CHUNK,
+        OPT_QUEUE_DEPTH,
+        OPT_CHUNKED,
+        OPT_OFFSET,
+        OPT_LENGTH,
+        OPT_BINARY,
+        OPT_BINARY_OUT,
+        OPT_MAC,
+        OPT_KEY2,
+        OPT_MAC_PAD,
+        OPT_HUGEPAGES,
+        OPT_ALLOC_STATS,
+        OPT_JIT,
+        OPT_BACKEND,
+        OPT_AUTOTUNE,
+        OPT_PROFILE,
+        OPT_INCREMENTAL,
+        OPT_METRICS_SOCKET,
+        OPT_METRICS_FILE
+    };
+    static const struct option longOptions[] = {
+        {"io", required_argument, NULL, OPT_IO},
+        {"direct", no_argument, NULL, OPT_DIRECT},
+        {"chunk", required_argument, NULL, OPT_CHUNK},
+        {"queue-depth", required_argument, NULL, OPT_QUEUE_DEPTH},
+        {"chunked", optional_argument, NULL, OPT_CHUNKED},
+        {"offset", required_argument, NULL, OPT_OFFSET},
+        {"length", required_argument, NULL, OPT_LENGTH},
+        {"binary", no_argument, NULL, OPT_BINARY},
+        {"binary-out", no_argument, NULL, OPT_BINARY_OUT},
+        {"mac", required_argument, NULL, OPT_MAC},
+        {"key2", required_argument, NULL, OPT_KEY2},
+        {"mac-pad", required_argument, NULL, OPT_MAC_PAD},
+        {"hugepages", required_argument, NULL, OPT_HUGEPAGES},
+        {"alloc-stats", no_argument, NULL, OPT_ALLOC_STATS},
+        {"jit", no_argument, NULL, OPT_JIT},
+        {"backend", required_argument, NULL, OPT_BACKEND},
+        {"autotune", no_argument, NULL, OPT_AUTOTUNE},
+        {"profile", required_argument, NULL, OPT_PROFILE},
+        {"incremental", optional_argument, NULL, OPT_INCREMENTAL},
+        {"metrics-socket", required_argument, NULL, OPT_METRICS_SOCKET},
+        {"metrics-file", required_argument, NULL, OPT_METRICS_FILE},
+        {NULL, 0, NULL, 0}};
 
     int opt;
-    while ((opt = getopt(argc, argv, "p:k:v:m:c:hd")) != -1)
+    while ((opt = getopt_long(argc, argv, "p:k:v:m:c:b:t:s:K:r:hd", longOptions, NULL)) != -1)
     {
         switch (opt)
         {
@@ -47,9 +171,136 @@ int main(int argc, char *argv[])
         case 'c':
             cipherFilePath = optarg;
             break;
+        case 'b':
+            manifestPath = optarg;
+            break;
+        case 't':
+            numThreads = atoi(optarg);
+            break;
+        case 's':
+            socketPath = optarg;
+            break;
+        case 'K':
+            keyTablePath = optarg;
+            break;
+        case 'r':
+            ringName = optarg;
+            break;
         case 'd':
             decrypt = true;
             break;
+        case OPT_IO:
+        {
+            int backend = parseIoBackend(optarg);
+            if (backend < 0)
+            {
+                fprintf(stderr, "Error: Unknown I/O backend: %s\n", optarg);
+                return 1;
+            }
+            ioOpts.backend = (IoBackend)backend;
+            break;
+        }
+        case OPT_DIRECT:
+            ioOpts.direct = true;
+            break;
+        case OPT_CHUNK:
+            ioOpts.chunkSize = strtoull(optarg, NULL, 10);
+            ioChunkSet = true;
+            break;
+        case OPT_QUEUE_DEPTH:
+            ioOpts.queueDepth = atoi(optarg);
+            queueDepthSet = true;
+            break;
+        case OPT_CHUNKED:
+            chunkedBytes = optarg ? strtoull(optarg, NULL, 10) : CHUNKED_DEFAULT_BYTES;
+            chunkedDefault = optarg == NULL;
+            if (chunkedBytes == 0 || chunkedBytes % 8 != 0)
+            {
+                fprintf(stderr, "Error: Chunk size must be a positive multiple of 8 bytes\n");
+                return 1;
+            }
+            break;
+        case OPT_OFFSET:
+            rangeInvalid |= !parseRangeValue(optarg, &rangeOffset);
+            rangeMode = true;
+            break;
+        case OPT_LENGTH:
+            rangeInvalid |= !parseRangeValue(optarg, &rangeLength);
+            rangeMode = true;
+            break;
+        case OPT_BINARY:
+            binaryInput = true;
+            break;
+        case OPT_BINARY_OUT:
+            binaryOutput = true;
+            break;
+        case OPT_MAC:
+            if (strcmp(optarg, "cbc") != 0 && strcmp(optarg, "retail") != 0)
+            {
+                fprintf(stderr, "Error: Unknown MAC: %s\n", optarg);
+                return 1;
+            }
+            macName = optarg;
+            break;
+        case OPT_KEY2:
+            key2FilePath = optarg;
+            break;
+        case OPT_MAC_PAD:
+            macPad = atoi(optarg);
+            if (macPad != MAC_PAD_ZERO && macPad != MAC_PAD_BIT)
+            {
+                fprintf(stderr, "Error: MAC padding must be 1 or 2\n");
+                return 1;
+            }
+            break;
+        case OPT_HUGEPAGES:
+            if (strcmp(optarg, "off") == 0)
+                poolSetHugePages(POOL_HUGE_OFF);
+            else if (strcmp(optarg, "thp") == 0)
+                poolSetHugePages(POOL_HUGE_THP);
+            else if (strcmp(optarg, "tlb") == 0)
+                poolSetHugePages(POOL_HUGE_TLB);
+            else
+            {
+                fprintf(stderr, "Error: Unknown huge page mode: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case OPT_ALLOC_STATS:
+            allocStats = true;
+            break;
+        case OPT_BACKEND:
+        {
+            int parsed = parseCryptBackend(optarg);
+            if (parsed < 0)
+            {
+                fprintf(stderr, "Error: Unknown backend: %s\n", optarg);
+                return 1;
+            }
+            backend = (CryptBackend)parsed;
+            break;
+        }
+        case OPT_JIT:
+            if (!jitSetEnabled(true))
+                fprintf(stderr, "Warning: Key-specialized code unavailable on this platform, using generic kernel\n");
+            jitSet = true;
+            break;
+        case OPT_AUTOTUNE:
+            autotune = true;
+            break;
+        case OPT_PROFILE:
+            profilePath = optarg;
+            break;
+        case OPT_INCREMENTAL:
+            incremental = true;
+            incrManifestPath = optarg;
+            break;
+        case OPT_METRICS_SOCKET:
+            metricsSocket = optarg;
+            break;
+        case OPT_METRICS_FILE:
+            metricsFile = optarg;
+            break;
         case 'h':
             printUsage();
             return 0;
@@ -59,43 +310,172 @@ int main(int argc, char *argv[])
         }
     }
 
-    // 检查必要参数
-    if (plainFilePath == NULL || keyFilePath == NULL || modeName == NULL || cipherFilePath == NULL)
+    // 本机调优配置文件: 显式 --profile, 否则为默认路径
+    char profileBuf[1024];
+    if (profilePath == NULL)
+        profilePath = (char *)tuneProfilePath(profileBuf, sizeof(profileBuf));
+    if (autotune)
+    {
+        if (profilePath == NULL)
+        {
+            fprintf(stderr, "Error: No profile path, set HOME, E1DES_PROFILE or --profile\n");
+            return 1;
+        }
+        return runAutotune(profilePath) ? 0 : 1;
+    }
+
+    // 加载配置文件, 只填补命令行没有给出的参数
+    TuneProfile profile;
+    tuneProfileDefaults(&profile);
+    if (profilePath != NULL && tuneProfileLoad(profilePath, &profile))
+    {
+        if (numThreads == 0)
+            numThreads = profile.threads;
+        if (chunkedDefault && profile.chunkedBytes != 0)
+            chunkedBytes = profile.chunkedBytes;
+        if (!ioChunkSet && profile.ioChunk != 0)
+            ioOpts.chunkSize = profile.ioChunk;
+        if (!queueDepthSet && profile.queueDepth != 0)
+            ioOpts.queueDepth = profile.queueDepth;
+        if (!jitSet && profile.jit)
+            jitSetEnabled(true);
+    }
+
+    if ((metricsSocket != NULL || metricsFile != NULL) && socketPath == NULL)
+    {
+        fprintf(stderr, "Error: --metrics-socket and --metrics-file require service mode (-s)\n");
+        return 1;
+    }
+
+    // 服务模式: 模式和IV由每个请求携带, 只需要密钥
+    if (socketPath != NULL)
+    {
+        if (keyFilePath == NULL && keyTablePath == NULL)
+        {
+            fprintf(stderr, "Error: Service mode requires -k or -K\n");
+            return 1;
+        }
+        BYTE *defaultKey = NULL;
+        size_t defaultKeySize = 0;
+        if (keyFilePath != NULL)
+        {
+            defaultKey = readHexFile(keyFilePath, &defaultKeySize);
+            if (!defaultKey || defaultKeySize != KEY_SIZE)
+            {
+                fprintf(stderr, "Error: Key must be 16 hexadecimal characters (64 bits)\n");
+                poolFree(defaultKey);
+                return 1;
+            }
+        }
+        int serviceRet = runService(socketPath, keyTablePath, defaultKey, numThreads, metricsSocket, metricsFile);
+        poolFree(defaultKey);
+        return serviceRet;
+    }
+
+    // 共享内存环形缓冲区工作进程: 模式和IV由每个任务描述符携带
+    if (ringName != NULL)
+    {
+        size_t ringKeySize = 0;
+        BYTE *ringKey = keyFilePath ? readHexFile(keyFilePath, &ringKeySize) : NULL;
+        if (!ringKey || ringKeySize != KEY_SIZE)
+        {
+            fprintf(stderr, "Error: Key must be 16 hexadecimal characters (64 bits)\n");
+            poolFree(ringKey);
+            return 1;
+        }
+        int ringRet = runShmWorker(ringName, ringKey[0]);
+        poolFree(ringKey);
+        return ringRet;
+    }
+
+    // 检查必要参数 (计算MAC时不需要模式)
+    if (keyFilePath == NULL || (modeName == NULL && macName == NULL) ||
+        (manifestPath == NULL && (plainFilePath == NULL || cipherFilePath == NULL)))
     {
         fprintf(stderr, "Error: Missing required arguments\n");
         printUsage();
         return 1;
     }
 
+    if (macName != NULL && (manifestPath != NULL || (strcmp(macName, "retail") == 0) != (key2FilePath != NULL)))
+    {
+        fprintf(stderr, "Error: --mac needs a single input file, and --key2 exactly when it is retail\n");
+        return 1;
+    }
+
     // 解析加密模式
-    EncryptionMode mode = parseMode(modeName);
+    int parsedMode = modeName ? parseMode(modeName) : ECB;
+    if (parsedMode < 0)
+    {
+        fprintf(stderr, "Error: Unsupported encryption mode: %s\n", modeName);
+        return 1;
+    }
+    EncryptionMode mode = (EncryptionMode)parsedMode;
 
     // 如果是CBC、CFB或OFB模式，需要初始化向量
-    if ((mode == CBC || mode == CFB || mode == OFB) && ivFilePath == NULL)
+    if (modeName != NULL && (mode == CBC || mode == CFB || mode == OFB) && ivFilePath == NULL)
     {
         fprintf(stderr, "Error: CBC, CFB and OFB modes require an IV file\n");
         return 1;
     }
 
-    // 读取文件
-    size_t plaintextSize = 0, keySize = 0, ivSize = 0;
-    BYTE *plaintext = NULL, *key = NULL, *iv = NULL;
-    int ret = 0;
+    if (chunkedBytes != 0 && (mode != CBC || manifestPath != NULL))
+    {
+        fprintf(stderr, "Error: --chunked requires -m CBC and a single input file\n");
+        return 1;
+    }
+
+    if (rangeMode && (!decrypt || manifestPath != NULL || mode == OFB || chunkedBytes != 0 || rangeLength == 0 ||
+                      rangeInvalid))
+    {
+        fprintf(stderr, "Error: --offset/--length require -d, a single ECB/CBC/CFB input and a positive length\n");
+        return 1;
+    }
+    if (binaryInput && (manifestPath != NULL || chunkedBytes != 0 || macName != NULL ||
+                        ioOpts.backend != IO_BACKEND_MEMORY))
+    {
+        fprintf(stderr, "Error: --binary is supported for single-file and range processing only\n");
+        return 1;
+    }
+    // 标准输入/输出和原始字节输出只由流式的单文件处理支持
+    bool stdioIn = plainFilePath != NULL && strcmp(plainFilePath, STREAM_STDIO_PATH) == 0;
+    bool stdioOut = cipherFilePath != NULL && strcmp(cipherFilePath, STREAM_STDIO_PATH) == 0;
+    if ((stdioIn || stdioOut || binaryOutput) &&
+        (manifestPath != NULL || chunkedBytes != 0 || macName != NULL || rangeMode ||
+         ioOpts.backend != IO_BACKEND_MEMORY))
+    {
+        fprintf(stderr, "Error: '-' and --binary-out are supported for single-file processing only\n");
+        return 1;
+    }
+
+    // 内核后端只接管流式单文件处理的 ECB/CBC
+    if (backend == CRYPT_BACKEND_KERNEL &&
+        (manifestPath != NULL || chunkedBytes != 0 || macName != NULL || rangeMode ||
+         ioOpts.backend != IO_BACKEND_MEMORY || (mode != ECB && mode != CBC)))
+    {
+        fprintf(stderr, "Error: --backend=kernel supports single-file ECB/CBC processing only\n");
+        return 1;
+    }
 
-    // 先读取明文
-    plaintext = readHexFile(plainFilePath, &plaintextSize);
-    if (!plaintext)
+    // 增量加密只适用于密文位置固定的格式, 原地改写输出文件
+    if (incremental && (decrypt || manifestPath != NULL || macName != NULL || rangeMode || stdioIn || stdioOut ||
+                        binaryOutput || backend != CRYPT_BACKEND_DES || ioOpts.backend != IO_BACKEND_MEMORY ||
+                        !(mode == ECB || (mode == CBC && chunkedBytes != 0))))
     {
-        fprintf(stderr, "Error: Unable to read plaintext file\n");
+        fprintf(stderr, "Error: --incremental supports encrypting a single file with -m ECB or -m CBC --chunked\n");
         return 1;
     }
 
+    // 读取密钥和IV, 输入文件由 processFile 按模式读取
+    size_t keySize = 0, ivSize = 0;
+    BYTE *key = NULL, *iv = NULL;
+    int ret = 0;
+
     // 读取密钥
     key = readHexFile(keyFilePath, &keySize);
     if (!key)
     {
         fprintf(stderr, "Error: Unable to read key file\n");
-        free(plaintext);
         return 1;
     }
 
@@ -103,8 +483,7 @@ int main(int argc, char *argv[])
     if (keySize != KEY_SIZE)
     {
         fprintf(stderr, "Error: Key must be 16 hexadecimal characters (64 bits)\n");
-        free(plaintext);
-        free(key);
+        poolFree(key);
         return 1;
     }
 
@@ -115,17 +494,15 @@ int main(int argc, char *argv[])
         if (!iv)
         {
             fprintf(stderr, "Error: Unable to read IV file\n");
-            free(plaintext);
-            free(key);
+            poolFree(key);
             return 1;
         }
 
         if (ivSize != IV_SIZE)
         {
             fprintf(stderr, "Error: IV must be 16 hexadecimal characters (64 bits)\n");
-            free(plaintext);
-            free(key);
-            free(iv);
+            poolFree(key);
+            poolFree(iv);
             return 1;
         }
     }
@@ -135,197 +512,87 @@ int main(int argc, char *argv[])
     if (!des)
     {
         fprintf(stderr, "Error: Unable to create DES instance\n");
-        free(plaintext);
-        free(key);
+        poolFree(key);
         if (iv)
-            free(iv);
+            poolFree(iv);
         return 1;
     }
 
     // 设置密钥和初始化向量
-    DES_setKey(des, key, keySize);
+    if (!DES_setKey(des, key, keySize))
+    {
+        fprintf(stderr, "Error: Unable to set the DES key\n");
+        DES_destroy(des);
+        poolFree(key);
+        if (iv)
+            poolFree(iv);
+        return 1;
+    }
     if (iv != NULL)
     {
         DES_setIV(des, iv, ivSize);
     }
 
-    // 解密流程
-    if (decrypt)
+    // 批量模式: 共用已设置好密钥的DES实例处理清单中的所有文件
+    if (manifestPath != NULL)
     {
-        // CFB8 解密
-        if (mode == CFB)
-        {
-            // 读取密文字节数组
-            size_t ctSize8;
-            unsigned char *ct8 = readHexFile8(plainFilePath, &ctSize8);
-            if (!ct8)
-            {
-                fprintf(stderr, "Error: Unable to read ciphertext file\n");
-                return 1;
-            }
-            size_t ptSize8;
-            unsigned char *pt8 = CFB8_decrypt(des, ct8, ctSize8, iv[0], &ptSize8);
-            if (pt8 && writeHexByteFile(cipherFilePath, pt8, ptSize8))
-            {
-                printf("Decryption complete, plaintext written to: %s\n", cipherFilePath);
-                ret = 0;
-            }
-            else
-            {
-                fprintf(stderr, "Error: CFB8 decryption failed\n");
-            }
-            free(ct8);
-            free(pt8);
-            DES_destroy(des);
-            free(plaintext);
-            free(key);
-            if (iv)
-                free(iv);
-            return ret;
-        }
-        // OFB8 解密
-        if (mode == OFB)
-        {
-            size_t ctSize8;
-            unsigned char *ct8 = readHexFile8(plainFilePath, &ctSize8);
-            if (!ct8)
-            {
-                fprintf(stderr, "Error: Unable to read ciphertext file\n");
-                return 1;
-            }
-            size_t ptSize8;
-            unsigned char *pt8 = OFB8_decrypt(des, ct8, ctSize8, iv[0], &ptSize8);
-            if (pt8 && writeHexByteFile(cipherFilePath, pt8, ptSize8))
-            {
-                printf("Decryption complete, plaintext written to: %s\n", cipherFilePath);
-                ret = 0;
-            }
-            else
-            {
-                fprintf(stderr, "Error: OFB8 decryption failed\n");
-            }
-            free(ct8);
-            free(pt8);
-            DES_destroy(des);
-            free(plaintext);
-            free(key);
-            if (iv)
-                free(iv);
-            return ret;
-        }
-        // 其余模式块解密
-        size_t plainOutSize = 0;
-        BYTE *plainOut = DES_decrypt(des, plaintext, plaintextSize, mode, &plainOutSize);
-        if (plainOut && writeHexFile(cipherFilePath, plainOut, plainOutSize))
-        {
-            printf("Decryption complete, plaintext written to: %s\n", cipherFilePath);
-            ret = 0;
-        }
-        else
-        {
-            fprintf(stderr, "Error: Decryption failed\n");
-        }
-        free(plainOut);
-        DES_destroy(des);
-        free(plaintext);
-        free(key);
-        if (iv)
-            free(iv);
-        return ret;
+        ret = runBatch(des, mode, decrypt, manifestPath, numThreads);
     }
-
-    // CFB8 模式
-    if (mode == CFB)
+    else
     {
-        size_t ptSize8;
-        unsigned char *pt8 = readHexFile8(plainFilePath, &ptSize8);
-        if (!pt8)
+        int ok;
+        if (macName != NULL)
+            ok = processMacWithKey2(des, key2FilePath, plainFilePath, macPad, cipherFilePath);
+        else if (incremental)
         {
-            fprintf(stderr, "Error: Failed to read plaintext\n");
-            return 1;
-        }
-        size_t ctSize8;
-        unsigned char *ct8 = CFB8_encrypt(des, pt8, ptSize8, iv[0], &ctSize8);
-        if (ct8 && writeHexByteFile(cipherFilePath, ct8, ctSize8))
-        {
-            printf("Encryption complete, ciphertext written to: %s\n", cipherFilePath);
-            ret = 0;
+            IncrStats stats;
+            ok = incrementalProcessFile(des, chunkedBytes != 0, binaryInput,
+                                        chunkedBytes != 0 ? chunkedBytes : CHUNKED_DEFAULT_BYTES, plainFilePath,
+                                        cipherFilePath, incrManifestPath, &stats);
+            if (ok)
+                printf("Re-encrypted %zu of %zu chunks%s\n", stats.rewritten, stats.chunks,
+                       stats.full ? " (full rewrite)" : "");
         }
+        else if (rangeMode)
+            ok = processFileRange(des, mode, plainFilePath, binaryInput, rangeOffset, rangeLength, cipherFilePath);
+        else if (chunkedBytes != 0)
+            ok = processChunkedFile(des, decrypt, plainFilePath, cipherFilePath, chunkedBytes, numThreads);
+        else if (backend == CRYPT_BACKEND_KERNEL)
+            ok = kernelProcessFile(des, mode, decrypt, binaryInput, binaryOutput, plainFilePath, cipherFilePath);
+        else if (ioOpts.backend != IO_BACKEND_MEMORY)
+            ok = pipelineProcessFile(des, mode, decrypt, plainFilePath, cipherFilePath, &ioOpts);
         else
+            ok = processFile(des, mode, decrypt, binaryInput, binaryOutput, plainFilePath, cipherFilePath);
+
+        // 输出到标准输出时不打印完成信息, 以免混入数据
+        if (ok && stdioOut)
         {
-            fprintf(stderr, "Error: CFB8 encryption failed\n");
-        }
-        free(pt8);
-        free(ct8);
-        DES_destroy(des);
-        free(plaintext);
-        free(key);
-        free(iv);
-        return ret;
-    }
-    // OFB8 模式
-    if (mode == OFB)
-    {
-        size_t ptSize8;
-        unsigned char *pt8 = readHexFile8(plainFilePath, &ptSize8);
-        if (!pt8)
-        {
-            fprintf(stderr, "Error: Failed to read plaintext\n");
-            return 1;
-        }
-        size_t ctSize8;
-        unsigned char *ct8 = OFB8_encrypt(des, pt8, ptSize8, iv[0], &ctSize8);
-        if (ct8 && writeHexByteFile(cipherFilePath, ct8, ctSize8))
-        {
-            printf("Encryption complete, ciphertext written to: %s\n", cipherFilePath);
             ret = 0;
         }
-        else
-        {
-            fprintf(stderr, "Error: OFB8 encryption failed\n");
-        }
-        free(pt8);
-        free(ct8);
-        DES_destroy(des);
-        free(plaintext);
-        free(key);
-        free(iv);
-        return ret;
-    }
-
-    // 执行加密
-    size_t ciphertextSize;
-    BYTE *ciphertext = DES_encrypt(des, plaintext, plaintextSize, mode, &ciphertextSize);
-
-    // 初始化返回值
-    ret = 1;
-
-    if (ciphertext)
-    {
-        // 写入密文文件（以十六进制文本格式）
-        if (writeHexFile(cipherFilePath, ciphertext, ciphertextSize))
+        else if (ok)
         {
-            printf("Encryption complete, ciphertext written to: %s\n", cipherFilePath);
-            ret = 0; // 成功
+            if (macName != NULL)
+                printf("MAC written to: %s\n", cipherFilePath);
+            else if (decrypt)
+                printf("Decryption complete, plaintext written to: %s\n", cipherFilePath);
+            else
+                printf("Encryption complete, ciphertext written to: %s\n", cipherFilePath);
+            ret = 0;
         }
         else
         {
-            fprintf(stderr, "Error: Failed to write ciphertext file\n");
+            fprintf(stderr, decrypt ? "Error: Decryption failed\n" : "Error: Encryption failed\n");
+            ret = 1;
         }
-
-        free(ciphertext);
-    }
-    else
-    {
-        fprintf(stderr, "Error: Encryption failed\n");
     }
 
     // 清理
     DES_destroy(des);
-    free(plaintext);
-    free(key);
+    poolFree(key);
     if (iv)
-        free(iv);
+        poolFree(iv);
+    if (allocStats)
+        poolPrintStats(stderr);
 
     return ret;
-}
\ No newline at end of file
+}
@@ -0,0 +1,449 @@
+#include "metrics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+
+// 统计的模式数 (ECB/CBC/CFB/OFB, 8位反馈的CFB/OFB计入CFB/OFB)
+#define METRICS_MODES 4
+// metricsBegin 返回此值表示本次调用只计数不计时 (时钟读数不会这么小)
+#define METRICS_UNTIMED 1
+// Prometheus 直方图的边界: 2^METRICS_PROM_MIN_EXP 到 2^METRICS_PROM_MAX_EXP 纳秒, 恰好落在分桶边界上
+#define METRICS_PROM_MIN_EXP 10
+#define METRICS_PROM_MAX_EXP 34
+
+typedef struct
+{
+    uint64_t count;
+    uint64_t bytes;
+    uint64_t observed; // 直方图各桶之和, 抽样计时时为估计值
+    uint64_t sumNs;
+    uint64_t maxNs;
+    uint64_t buckets[METRICS_HDR_BUCKETS];
+} MetricsSeries;
+
+// 一个线程的全部数据, 只有拥有它的线程写入
+typedef struct MetricsShard
+{
+    MetricsSeries series[METRICS_MODES][2][METRICS_SIZE_CLASSES];
+    struct MetricsShard *next;
+    int owned; // 有线程在使用, 线程退出时清零
+} MetricsShard;
+
+static const char *const modeNames[METRICS_MODES] = {"ECB", "CBC", "CFB", "OFB"};
+static const char *const directionNames[2] = {"encrypt", "decrypt"};
+// 各大小分级的上限(字节), 最后一级不限
+static const char *const sizeNames[METRICS_SIZE_CLASSES] = {"64", "1024", "16384", "262144", "4194304", "+Inf"};
+static const char *const gaugeNames[METRICS_GAUGES] = {"queue_depth", "in_flight"};
+
+static int enabled = 0;
+static int64_t gauges[METRICS_GAUGES];
+static struct timespec startTime;
+
+static pthread_mutex_t registryLock = PTHREAD_MUTEX_INITIALIZER;
+static MetricsShard *shards = NULL;
+static pthread_key_t shardKey;
+static pthread_once_t shardKeyOnce = PTHREAD_ONCE_INIT;
+
+static __thread MetricsShard *localShard __attribute__((tls_model("initial-exec"))) = NULL;
+static __thread int localActive __attribute__((tls_model("initial-exec"))) = 0; // 最外层调用正在记录
+static __thread uint32_t localRandom __attribute__((tls_model("initial-exec"))) = 0; // 抽样用的 xorshift 状态
+
+static void releaseShard(void *arg)
+{
+    MetricsShard *shard = (MetricsShard *)arg;
+    __atomic_store_n(&shard->owned, 0, __ATOMIC_RELEASE);
+}
+
+static void createShardKey(void)
+{
+    pthread_key_create(&shardKey, releaseShard);
+}
+
+// 当前线程的分片: 优先复用已退出线程留下的分片. 内存不足时返回NULL, 本次不记录
+static MetricsShard *claimShard(void)
+{
+    pthread_once(&shardKeyOnce, createShardKey);
+    pthread_mutex_lock(&registryLock);
+    MetricsShard *shard = shards;
+    while (shard && __atomic_load_n(&shard->owned, __ATOMIC_ACQUIRE))
+        shard = shard->next;
+    if (!shard)
+    {
+        shard = (MetricsShard *)calloc(1, sizeof(MetricsShard));
+        if (shard)
+        {
+            shard->next = shards;
+            shards = shard;
+        }
+    }
+    if (shard)
+    {
+        shard->owned = 1;
+        pthread_setspecific(shardKey, shard);
+    }
+    pthread_mutex_unlock(&registryLock);
+    localShard = shard;
+    return shard;
+}
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 小调用是否计时: 线程内的 xorshift 序列, 避免与周期性的负载同步
+static inline int sampled(void)
+{
+    uint32_t x = localRandom ? localRandom : (uint32_t)(uintptr_t)&localRandom | 1;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    localRandom = x;
+    return x % METRICS_SAMPLE_RATE == 0;
+}
+
+// 单写者计数: 普通读写即可, 原子存取只为让导出线程读到完整的64位值
+static inline void bump(uint64_t *counter, uint64_t delta)
+{
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + delta, __ATOMIC_RELAXED);
+}
+
+static inline int bucketOf(uint64_t ns)
+{
+    if (ns < (1u << METRICS_SUB_BITS))
+        return (int)ns;
+    int exp = 63 - __builtin_clzll(ns);
+    int index = ((exp - METRICS_SUB_BITS + 1) << METRICS_SUB_BITS) +
+                (int)((ns >> (exp - METRICS_SUB_BITS)) & ((1u << METRICS_SUB_BITS) - 1));
+    return index < METRICS_HDR_BUCKETS ? index : METRICS_HDR_BUCKETS - 1;
+}
+
+// 第 index 个桶的上界(不含)
+static uint64_t bucketUpper(int index)
+{
+    if (index < (1 << METRICS_SUB_BITS))
+        return (uint64_t)index + 1;
+    int exp = (index >> METRICS_SUB_BITS) + METRICS_SUB_BITS - 1;
+    uint64_t sub = (uint64_t)(index & ((1 << METRICS_SUB_BITS) - 1));
+    return ((1ULL << METRICS_SUB_BITS) + sub + 1) << (exp - METRICS_SUB_BITS);
+}
+
+static inline int sizeClassOf(size_t bytes)
+{
+    int cls = 0;
+    for (size_t limit = 64; cls < METRICS_SIZE_CLASSES - 1 && bytes > limit; limit <<= 4)
+        cls++;
+    return cls;
+}
+
+void metricsSetEnabled(bool on)
+{
+    if (on && startTime.tv_sec == 0 && startTime.tv_nsec == 0)
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+    __atomic_store_n(&enabled, on ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+bool metricsEnabled(void)
+{
+    return __atomic_load_n(&enabled, __ATOMIC_RELAXED) != 0;
+}
+
+uint64_t metricsBegin(size_t bytes)
+{
+    if (!__atomic_load_n(&enabled, __ATOMIC_RELAXED) || localActive)
+        return 0;
+    localActive = 1;
+    if (bytes < METRICS_SAMPLE_BYTES && !sampled())
+        return METRICS_UNTIMED;
+    return nowNs();
+}
+
+void metricsEnd(uint64_t t0, EncryptionMode mode, MetricsDirection dir, size_t bytes)
+{
+    if (t0 == 0)
+        return;
+    uint64_t ns = t0 != METRICS_UNTIMED ? nowNs() - t0 : 0;
+    localActive = 0;
+    MetricsShard *shard = localShard ? localShard : claimShard();
+    if (!shard || (unsigned)mode >= METRICS_MODES)
+        return;
+    MetricsSeries *s = &shard->series[mode][dir][sizeClassOf(bytes)];
+    bump(&s->count, 1);
+    bump(&s->bytes, bytes);
+    if (t0 == METRICS_UNTIMED)
+        return;
+    uint64_t weight = bytes < METRICS_SAMPLE_BYTES ? METRICS_SAMPLE_RATE : 1;
+    bump(&s->observed, weight);
+    bump(&s->sumNs, ns * weight);
+    bump(&s->buckets[bucketOf(ns)], weight);
+    if (ns > __atomic_load_n(&s->maxNs, __ATOMIC_RELAXED))
+        __atomic_store_n(&s->maxNs, ns, __ATOMIC_RELAXED);
+}
+
+void metricsGaugeSet(MetricsGauge gauge, int64_t value)
+{
+    __atomic_store_n(&gauges[gauge], value, __ATOMIC_RELAXED);
+}
+
+void metricsGaugeAdd(MetricsGauge gauge, int64_t delta)
+{
+    __atomic_fetch_add(&gauges[gauge], delta, __ATOMIC_RELAXED);
+}
+
+void metricsReset(void)
+{
+    pthread_mutex_lock(&registryLock);
+    for (MetricsShard *shard = shards; shard; shard = shard->next)
+    {
+        uint64_t *p = (uint64_t *)shard->series;
+        size_t n = sizeof(shard->series) / sizeof(uint64_t);
+        for (size_t i = 0; i < n; i++)
+            __atomic_store_n(&p[i], 0, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&registryLock);
+}
+
+// 汇总所有分片, 返回 [模式][方向][大小] 的数组, 用 free 释放
+static MetricsSeries *snapshot(void)
+{
+    MetricsSeries *all = (MetricsSeries *)calloc(METRICS_MODES * 2 * METRICS_SIZE_CLASSES, sizeof(MetricsSeries));
+    if (!all)
+        return NULL;
+    pthread_mutex_lock(&registryLock);
+    for (MetricsShard *shard = shards; shard; shard = shard->next)
+    {
+        const MetricsSeries *src = &shard->series[0][0][0];
+        for (size_t i = 0; i < METRICS_MODES * 2 * METRICS_SIZE_CLASSES; i++)
+        {
+            MetricsSeries *dst = &all[i];
+            dst->count += __atomic_load_n(&src[i].count, __ATOMIC_RELAXED);
+            dst->bytes += __atomic_load_n(&src[i].bytes, __ATOMIC_RELAXED);
+            dst->observed += __atomic_load_n(&src[i].observed, __ATOMIC_RELAXED);
+            dst->sumNs += __atomic_load_n(&src[i].sumNs, __ATOMIC_RELAXED);
+            uint64_t max = __atomic_load_n(&src[i].maxNs, __ATOMIC_RELAXED);
+            if (max > dst->maxNs)
+                dst->maxNs = max;
+            for (int b = 0; b < METRICS_HDR_BUCKETS; b++)
+                dst->buckets[b] += __atomic_load_n(&src[i].buckets[b], __ATOMIC_RELAXED);
+        }
+    }
+    pthread_mutex_unlock(&registryLock);
+    return all;
+}
+
+// 第 q 分位数(纳秒): 所在桶的上界, 不超过记录到的最大值
+static uint64_t percentile(const MetricsSeries *s, double q)
+{
+    uint64_t rank = (uint64_t)(q * (double)s->observed + 0.5);
+    if (rank == 0)
+        rank = 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < METRICS_HDR_BUCKETS; b++)
+    {
+        seen += s->buckets[b];
+        if (seen >= rank)
+        {
+            uint64_t upper = bucketUpper(b) - 1;
+            return upper < s->maxNs ? upper : s->maxNs;
+        }
+    }
+    return s->maxNs;
+}
+
+// 可增长的文本缓冲区
+typedef struct
+{
+    char *text;
+    size_t len;
+    size_t cap;
+    int failed;
+} TextBuffer;
+
+static void appendf(TextBuffer *buf, const char *fmt, ...)
+{
+    if (buf->failed)
+        return;
+    for (;;)
+    {
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf->text + buf->len, buf->cap - buf->len, fmt, ap);
+        va_end(ap);
+        if (n < 0)
+        {
+            buf->failed = 1;
+            return;
+        }
+        if ((size_t)n < buf->cap - buf->len)
+        {
+            buf->len += (size_t)n;
+            return;
+        }
+        size_t cap = buf->cap * 2 > buf->len + n + 1 ? buf->cap * 2 : buf->len + n + 1;
+        char *text = (char *)realloc(buf->text, cap);
+        if (!text)
+        {
+            buf->failed = 1;
+            return;
+        }
+        buf->text = text;
+        buf->cap = cap;
+    }
+}
+
+static double uptimeSeconds(void)
+{
+    if (startTime.tv_sec == 0 && startTime.tv_nsec == 0)
+        return 0;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - startTime.tv_sec) + (now.tv_nsec - startTime.tv_nsec) / 1e9;
+}
+
+static void formatText(TextBuffer *buf, const MetricsSeries *all)
+{
+    double uptime = uptimeSeconds();
+    uint64_t totalBytes = 0;
+    for (size_t i = 0; i < METRICS_MODES * 2 * METRICS_SIZE_CLASSES; i++)
+        totalBytes += all[i].bytes;
+    appendf(buf, "uptime_s %.1f\n", uptime);
+    for (int g = 0; g < METRICS_GAUGES; g++)
+        appendf(buf, "%s %lld\n", gaugeNames[g], (long long)__atomic_load_n(&gauges[g], __ATOMIC_RELAXED));
+    appendf(buf, "throughput_MBps %.2f\n", uptime > 0 ? totalBytes / uptime / (1024.0 * 1024.0) : 0.0);
+    appendf(buf, "%-4s %-8s %8s %12s %14s %10s %10s %10s %10s %10s %10s\n", "mode", "dir", "size<=", "ops",
+            "bytes", "MB/s", "p50_us", "p90_us", "p99_us", "p999_us", "max_us");
+    for (int m = 0; m < METRICS_MODES; m++)
+        for (int d = 0; d < 2; d++)
+            for (int c = 0; c < METRICS_SIZE_CLASSES; c++)
+            {
+                const MetricsSeries *s = &all[(m * 2 + d) * METRICS_SIZE_CLASSES + c];
+                if (s->count == 0)
+                    continue;
+                // MB/s 为处理期间的速率: 平均每次的字节数除以平均耗时
+                double avgNs = s->observed ? (double)s->sumNs / s->observed : 0.0;
+                double rate = avgNs > 0 ? (double)s->bytes / s->count / (avgNs / 1e9) / (1024.0 * 1024.0) : 0.0;
+                appendf(buf, "%-4s %-8s %8s %12llu %14llu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                        modeNames[m], directionNames[d], sizeNames[c], (unsigned long long)s->count,
+                        (unsigned long long)s->bytes, rate, percentile(s, 0.5) / 1e3, percentile(s, 0.9) / 1e3,
+                        percentile(s, 0.99) / 1e3, percentile(s, 0.999) / 1e3, s->maxNs / 1e3);
+            }
+}
+
+static void formatPrometheus(TextBuffer *buf, const MetricsSeries *all)
+{
+    appendf(buf, "# HELP e1des_op_duration_seconds Duration of DES mode calls.\n");
+    appendf(buf, "# TYPE e1des_op_duration_seconds histogram\n");
+    for (int m = 0; m < METRICS_MODES; m++)
+        for (int d = 0; d < 2; d++)
+            for (int c = 0; c < METRICS_SIZE_CLASSES; c++)
+            {
+                const MetricsSeries *s = &all[(m * 2 + d) * METRICS_SIZE_CLASSES + c];
+                if (s->observed == 0)
+                    continue;
+                char labels[96];
+                snprintf(labels, sizeof(labels), "mode=\"%s\",direction=\"%s\",size_le=\"%s\"", modeNames[m],
+                         directionNames[d], sizeNames[c]);
+                // 边界 2^exp 纳秒是第 (exp-2)*8 个桶的下界, 之前各桶的计数之和即 <= le 的次数
+                uint64_t cumulative = 0;
+                int b = 0;
+                for (int exp = METRICS_PROM_MIN_EXP; exp <= METRICS_PROM_MAX_EXP; exp++)
+                {
+                    int end = (exp - METRICS_SUB_BITS + 1) << METRICS_SUB_BITS;
+                    for (; b < end && b < METRICS_HDR_BUCKETS; b++)
+                        cumulative += s->buckets[b];
+                    appendf(buf, "e1des_op_duration_seconds_bucket{%s,le=\"%.12g\"} %llu\n", labels,
+                            (double)(1ULL << exp) / 1e9, (unsigned long long)cumulative);
+                }
+                appendf(buf, "e1des_op_duration_seconds_bucket{%s,le=\"+Inf\"} %llu\n", labels,
+                        (unsigned long long)s->observed);
+                appendf(buf, "e1des_op_duration_seconds_sum{%s} %.9f\n", labels, s->sumNs / 1e9);
+                appendf(buf, "e1des_op_duration_seconds_count{%s} %llu\n", labels,
+                        (unsigned long long)s->observed);
+            }
+    // 次数与字节数是精确值; 直方图的 _count 在抽样计时时为估计值
+    static const char *const counters[2][2] = {{"ops_total", "DES mode calls."},
+                                               {"op_bytes_total", "Bytes processed by DES mode calls."}};
+    for (int k = 0; k < 2; k++)
+    {
+        appendf(buf, "# HELP e1des_%s %s\n", counters[k][0], counters[k][1]);
+        appendf(buf, "# TYPE e1des_%s counter\n", counters[k][0]);
+        for (int m = 0; m < METRICS_MODES; m++)
+            for (int d = 0; d < 2; d++)
+                for (int c = 0; c < METRICS_SIZE_CLASSES; c++)
+                {
+                    const MetricsSeries *s = &all[(m * 2 + d) * METRICS_SIZE_CLASSES + c];
+                    if (s->count)
+                        appendf(buf, "e1des_%s{mode=\"%s\",direction=\"%s\",size_le=\"%s\"} %llu\n", counters[k][0],
+                                modeNames[m], directionNames[d], sizeNames[c],
+                                (unsigned long long)(k ? s->bytes : s->count));
+                }
+    }
+    for (int g = 0; g < METRICS_GAUGES; g++)
+    {
+        appendf(buf, "# TYPE e1des_%s gauge\n", gaugeNames[g]);
+        appendf(buf, "e1des_%s %lld\n", gaugeNames[g], (long long)__atomic_load_n(&gauges[g], __ATOMIC_RELAXED));
+    }
+    appendf(buf, "# TYPE e1des_uptime_seconds gauge\n");
+    appendf(buf, "e1des_uptime_seconds %.3f\n", uptimeSeconds());
+}
+
+char *metricsFormat(MetricsFormat format, size_t *len)
+{
+    MetricsSeries *all = snapshot();
+    TextBuffer buf = {(char *)malloc(4096), 0, 4096, 0};
+    if (!all || !buf.text)
+    {
+        free(all);
+        free(buf.text);
+        return NULL;
+    }
+    buf.text[0] = '\0';
+    if (format == METRICS_FORMAT_PROMETHEUS)
+        formatPrometheus(&buf, all);
+    else
+        formatText(&buf, all);
+    free(all);
+    if (buf.failed)
+    {
+        free(buf.text);
+        return NULL;
+    }
+    if (len)
+        *len = buf.len;
+    return buf.text;
+}
+
+int metricsWriteFile(const char *path, MetricsFormat format)
+{
+    char tmp[4096 + sizeof(".tmp")];
+    if (strlen(path) >= 4096)
+    {
+        fprintf(stderr, "Error: Metrics path too long: %s\n", path);
+        return 0;
+    }
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    size_t len = 0;
+    char *text = metricsFormat(format, &len);
+    if (!text)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 0;
+    }
+    FILE *file = fopen(tmp, "w");
+    int ok = file && fwrite(text, 1, len, file) == len;
+    if (file && fclose(file) != 0)
+        ok = 0;
+    free(text);
+    if (!ok || rename(tmp, path) != 0)
+    {
+        fprintf(stderr, "Error: Unable to write metrics file: %s\n", path);
+        remove(tmp);
+        return 0;
+    }
+    return 1;
+}
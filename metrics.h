@@ -0,0 +1,71 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "enum.h"
+
+// 运行指标: workMode.c 各入口函数的耗时直方图, 按模式、方向和数据大小分类, 另有队列深度等计量值
+// 每个线程写自己的分片(首次记录时登记, 线程退出后分片留给新线程复用), 记录时不加锁也没有原子读改写;
+// 导出时汇总所有分片. 默认关闭, 关闭时每次调用只多读一个全局标志
+
+// HDR 式对数-线性分桶(单位纳秒): 每个2的幂区间再等分为 2^METRICS_SUB_BITS 个子桶, 相对误差不超过 1/8
+// 共 METRICS_HDR_BUCKETS 个桶, 覆盖 0 到约17秒, 更长的耗时计入最后一个桶
+#define METRICS_SUB_BITS 3
+#define METRICS_HDR_BUCKETS 256
+
+// 数据大小分级: <=64B, <=1KB, <=16KB, <=256KB, <=4MB, 更大
+#define METRICS_SIZE_CLASSES 6
+
+// 计时一次(两次读时钟)约几十纳秒, 与几个块的处理时间相当; 小于 METRICS_SAMPLE_BYTES 的调用
+// 每次以 1/METRICS_SAMPLE_RATE 的概率计时, 直方图按 METRICS_SAMPLE_RATE 倍计入. 次数和字节数总是精确的
+#define METRICS_SAMPLE_BYTES 4096
+#define METRICS_SAMPLE_RATE 16
+
+// 嵌套调用(如 OFB_decrypt 调用 OFB_encrypt, DES_encrypt 分派到各模式)只按最外层记录一次
+
+typedef enum
+{
+    METRICS_ENCRYPT = 0,
+    METRICS_DECRYPT = 1
+} MetricsDirection;
+
+// 计量值: 由使用者设置的瞬时量
+typedef enum
+{
+    METRICS_QUEUE_DEPTH, // 排队等待处理的请求数
+    METRICS_IN_FLIGHT,   // 已取走正在处理的请求数
+    METRICS_GAUGES
+} MetricsGauge;
+
+// 导出格式
+typedef enum
+{
+    METRICS_FORMAT_TEXT,      // 每类一行: 次数、字节数、吞吐率与 p50/p90/p99/p99.9/max
+    METRICS_FORMAT_PROMETHEUS // Prometheus 文本格式, 直方图边界取1微秒起的2的幂纳秒
+} MetricsFormat;
+
+// 开启或关闭记录. 关闭后已记录的数据保留
+void metricsSetEnabled(bool enabled);
+bool metricsEnabled(void);
+
+// 记录一次操作: t0 = metricsBegin(bytes); ...; metricsEnd(t0, mode, dir, bytes);
+// 关闭或处于嵌套调用中时 metricsBegin 返回0, metricsEnd 收到0时什么也不做.
+// metricsBegin 之后必须调用 metricsEnd, 两者之间不能提前返回
+uint64_t metricsBegin(size_t bytes);
+void metricsEnd(uint64_t t0, EncryptionMode mode, MetricsDirection dir, size_t bytes);
+
+void metricsGaugeSet(MetricsGauge gauge, int64_t value);
+void metricsGaugeAdd(MetricsGauge gauge, int64_t delta);
+
+// 清空所有分片的数据(计量值不变), 可与记录同时进行, 期间的记录可能部分丢失
+void metricsReset(void);
+
+// 汇总导出为以'\0'结尾的文本, 长度写入 len(可为NULL). 用 free 释放, 失败返回NULL
+char *metricsFormat(MetricsFormat format, size_t *len);
+
+// 以同目录临时文件 + rename 原子替换 path, 供 node_exporter 的 textfile 收集器读取. 成功返回1
+int metricsWriteFile(const char *path, MetricsFormat format);
+
+#endif // METRICS_H
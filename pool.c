@@ -0,0 +1,449 @@
+#include "pool.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// 每个缓冲区前有一个缓存行大小的头部, 数据随之按64字节对齐. 头部不计入容量等级,
+// 请求2的幂字节时正好落在同一等级
+#define POOL_HEADER 64
+// 最小容量等级: 2^6 = 64 字节
+#define POOL_MIN_SHIFT 6
+// 直接 mmap 的缓冲区数据区按此对齐, 使内核能用大页映射
+#define POOL_HUGE_PAGE ((size_t)2 << 20)
+#define POOL_CLASSES 48
+// 每个等级缓存的缓冲区数上限, 以及缓存总容量上限
+#define POOL_CACHE_PER_CLASS 8
+#define POOL_CACHE_MAX_BYTES ((size_t)256 << 20)
+
+typedef struct PoolBlock
+{
+    struct PoolBlock *next; // 缓存链表
+    size_t total;           // 向系统申请的字节数 (含头部)
+    unsigned char cls;      // 容量等级
+    unsigned char mapped;   // 由 mmap 分配
+    unsigned char huge;     // 使用了大页
+} PoolBlock;
+
+_Static_assert(sizeof(PoolBlock) <= POOL_HEADER, "pool header too large");
+
+// 线程缓存: 小缓冲区先在本线程的缓存中分配和释放, 不取全局锁. 只缓存不超过64KB的等级,
+// 每级至多 POOL_THREAD_CACHE 个, 每个线程缓存的容量不超过约512KB
+#define POOL_THREAD_CLASSES 11
+#define POOL_THREAD_CACHE 4
+
+// 一个线程的缓存与统计计数. 计数只由拥有它的线程写入, 汇总时原子读取; 线程退出后记录留给新线程复用
+typedef struct PoolThread
+{
+    PoolBlock *list[POOL_THREAD_CLASSES];
+    unsigned count[POOL_THREAD_CLASSES];
+    size_t allocs, reused, systemAllocs, mappedAllocs, hugeAllocs, released;
+    size_t bytesInUse;  // 本线程分配减去本线程释放的容量, 按模2^64累加, 各线程之和才有意义
+    size_t bytesCached; // 本线程缓存中的容量
+    unsigned trimSeen;  // 已处理到的 poolTrim 代数
+    struct PoolThread *next;
+    int owned; // 有线程在使用, 线程退出时清零
+} PoolThread;
+
+// 共享缓存与线程记录表由 poolLock 保护
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static PoolBlock *freeList[POOL_CLASSES];
+static unsigned freeCount[POOL_CLASSES];
+static size_t sharedCached;   // 共享缓存中的容量
+static size_t sharedOut;      // 已交给线程的容量: 使用中的与各线程缓存中的
+static size_t sharedPeak;     // sharedOut 的峰值
+static PoolThread *threads = NULL;
+// 无法分配线程记录时使用的公共记录, 计数原子累加, 不缓存
+static PoolThread orphanThread;
+static pthread_key_t threadKey;
+static pthread_once_t threadKeyOnce = PTHREAD_ONCE_INIT;
+static unsigned trimGeneration = 0; // 原子: 每次 poolTrim 加1
+static PoolHugePages hugeMode = POOL_HUGE_OFF; // 原子
+
+static __thread PoolThread *localThread __attribute__((tls_model("initial-exec"))) = NULL;
+
+static inline void *blockData(PoolBlock *b)
+{
+    return (unsigned char *)b + POOL_HEADER;
+}
+
+static inline PoolBlock *dataBlock(void *ptr)
+{
+    return (PoolBlock *)((unsigned char *)ptr - POOL_HEADER);
+}
+
+// 等级的数据容量
+static inline size_t classBytes(int cls)
+{
+    return (size_t)1 << (cls + POOL_MIN_SHIFT);
+}
+
+// 数据容量对应的等级, 超出范围返回-1
+static int sizeClass(size_t size)
+{
+    if (size > SIZE_MAX / 4)
+        return -1;
+    int cls = 0;
+    while (classBytes(cls) < size)
+        cls++;
+    return cls < POOL_CLASSES ? cls : -1;
+}
+
+// 映射 len 字节(2MB的整数倍)的数据区, 起始地址按 POOL_HUGE_PAGE 对齐, 紧邻其前映射一个普通页存放头部.
+// 先保留足够大的不可访问区间, 在其中的对齐位置以 MAP_FIXED 映射, 再归还多余部分. 失败返回NULL
+static void *mapAligned(size_t len, PoolHugePages huge, unsigned char *usedHuge)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t span = page + len + POOL_HUGE_PAGE;
+    unsigned char *reserved = (unsigned char *)mmap(NULL, span, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED)
+        return NULL;
+    unsigned char *data = (unsigned char *)(((uintptr_t)reserved + page + POOL_HUGE_PAGE - 1) &
+                                            ~(uintptr_t)(POOL_HUGE_PAGE - 1));
+    unsigned char *head = data - page;
+    if (head > reserved)
+        munmap(reserved, (size_t)(head - reserved));
+    if (reserved + span > data + len)
+        munmap(data + len, (size_t)(reserved + span - (data + len)));
+
+    if (mmap(head, page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)
+    {
+        munmap(head, page + len);
+        return NULL;
+    }
+    void *p = MAP_FAILED;
+    *usedHuge = 0;
+#ifdef MAP_HUGETLB
+    if (huge == POOL_HUGE_TLB)
+    {
+        p = mmap(data, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB, -1, 0);
+        *usedHuge = p != MAP_FAILED;
+    }
+#endif
+    if (p == MAP_FAILED)
+    {
+        p = mmap(data, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+        if (p == MAP_FAILED)
+        {
+            munmap(head, page + len);
+            return NULL;
+        }
+#ifdef MADV_HUGEPAGE
+        if (huge != POOL_HUGE_OFF)
+            *usedHuge = madvise(p, len, MADV_HUGEPAGE) == 0;
+#endif
+    }
+    return data;
+}
+
+// 向系统申请一个等级的缓冲区, 不持锁调用
+static PoolBlock *systemAlloc(int cls, PoolHugePages huge)
+{
+    size_t capacity = classBytes(cls), total;
+    PoolBlock *b = NULL;
+    unsigned char mapped = 0, usedHuge = 0;
+    if (capacity >= POOL_MMAP_THRESHOLD)
+    {
+        unsigned char *data = (unsigned char *)mapAligned(capacity, huge, &usedHuge);
+        if (!data)
+            return NULL;
+        b = dataBlock(data);
+        total = (size_t)sysconf(_SC_PAGESIZE) + capacity;
+        mapped = 1;
+    }
+    else
+    {
+        total = POOL_HEADER + capacity;
+        b = (PoolBlock *)aligned_alloc(POOL_HEADER, total);
+        if (!b)
+            return NULL;
+    }
+    b->total = total;
+    b->cls = (unsigned char)cls;
+    b->mapped = mapped;
+    b->huge = usedHuge;
+    return b;
+}
+
+static void systemFree(PoolBlock *b)
+{
+    if (b->mapped) // 头部所在的页之后紧接数据区
+        munmap((unsigned char *)blockData(b) + classBytes(b->cls) - b->total, b->total);
+    else
+        free(b);
+}
+
+// 计数只由拥有记录的线程写入, 普通读写即可; 公共记录由多个线程共用, 原子累加
+static inline void countAdd(PoolThread *t, size_t *counter, size_t delta)
+{
+    if (t == &orphanThread)
+        __atomic_fetch_add(counter, delta, __ATOMIC_RELAXED);
+    else
+        __atomic_store_n(counter, *counter + delta, __ATOMIC_RELAXED);
+}
+
+// 缓冲区交给线程, 持 poolLock 调用
+static void sharedTake(size_t total)
+{
+    sharedOut += total;
+    if (sharedOut > sharedPeak)
+        sharedPeak = sharedOut;
+}
+
+// 缓冲区交回共享层, 持 poolLock 调用: 共享缓存未满时放入, 否则(或 release 为真时)挂到 toFree 上,
+// 由调用者解锁后 systemFree. 返回新的 toFree
+static PoolBlock *sharedPut(PoolThread *t, PoolBlock *b, int release, PoolBlock *toFree)
+{
+    sharedOut -= b->total;
+    if (!release && freeCount[b->cls] < POOL_CACHE_PER_CLASS && sharedCached + b->total <= POOL_CACHE_MAX_BYTES)
+    {
+        b->next = freeList[b->cls];
+        freeList[b->cls] = b;
+        freeCount[b->cls]++;
+        sharedCached += b->total;
+        return toFree;
+    }
+    countAdd(t, &t->released, 1);
+    b->next = toFree;
+    return b;
+}
+
+static void systemFreeList(PoolBlock *list)
+{
+    while (list)
+    {
+        PoolBlock *next = list->next;
+        systemFree(list);
+        list = next;
+    }
+}
+
+// 清空线程缓存: release 为真时归还系统 (poolTrim), 否则交回共享缓存 (线程退出)
+static void flushThread(PoolThread *t, int release)
+{
+    PoolBlock *toFree = NULL;
+    pthread_mutex_lock(&poolLock);
+    for (int cls = 0; cls < POOL_THREAD_CLASSES; cls++)
+    {
+        while (t->list[cls])
+        {
+            PoolBlock *b = t->list[cls];
+            t->list[cls] = b->next;
+            countAdd(t, &t->bytesCached, -b->total);
+            toFree = sharedPut(t, b, release, toFree);
+        }
+        t->count[cls] = 0;
+    }
+    pthread_mutex_unlock(&poolLock);
+    systemFreeList(toFree);
+}
+
+static void releaseThread(void *arg)
+{
+    PoolThread *t = (PoolThread *)arg;
+    flushThread(t, 0);
+    localThread = NULL;
+    __atomic_store_n(&t->owned, 0, __ATOMIC_RELEASE);
+}
+
+static void createThreadKey(void)
+{
+    pthread_key_create(&threadKey, releaseThread);
+}
+
+// 当前线程的记录: 优先复用已退出线程留下的记录. 内存不足时返回公共记录, 下次调用再试
+static PoolThread *claimThread(void)
+{
+    pthread_once(&threadKeyOnce, createThreadKey);
+    pthread_mutex_lock(&poolLock);
+    PoolThread *t = threads;
+    while (t && __atomic_load_n(&t->owned, __ATOMIC_ACQUIRE))
+        t = t->next;
+    if (!t)
+    {
+        t = (PoolThread *)calloc(1, sizeof(PoolThread));
+        if (t)
+        {
+            t->next = threads;
+            threads = t;
+        }
+    }
+    if (t)
+    {
+        t->owned = 1;
+        t->trimSeen = __atomic_load_n(&trimGeneration, __ATOMIC_ACQUIRE);
+        pthread_setspecific(threadKey, t);
+    }
+    pthread_mutex_unlock(&poolLock);
+    if (!t)
+        return &orphanThread;
+    localThread = t;
+    return t;
+}
+
+// 当前线程的记录. 其他线程调用过 poolTrim 时先把本线程缓存归还系统
+static inline PoolThread *currentThread(void)
+{
+    PoolThread *t = localThread ? localThread : claimThread();
+    unsigned generation = __atomic_load_n(&trimGeneration, __ATOMIC_ACQUIRE);
+    if (t != &orphanThread && t->trimSeen != generation)
+    {
+        t->trimSeen = generation;
+        flushThread(t, 1);
+    }
+    return t;
+}
+
+void *poolAlloc(size_t size)
+{
+    int cls = sizeClass(size);
+    if (cls < 0)
+        return NULL;
+
+    PoolThread *t = currentThread();
+    countAdd(t, &t->allocs, 1);
+    PoolBlock *b = NULL;
+    if (cls < POOL_THREAD_CLASSES && t->list[cls]) // 公共记录的缓存总是空的
+    {
+        b = t->list[cls];
+        t->list[cls] = b->next;
+        t->count[cls]--;
+        countAdd(t, &t->bytesCached, -b->total);
+        countAdd(t, &t->reused, 1);
+    }
+    else
+    {
+        pthread_mutex_lock(&poolLock);
+        b = freeList[cls];
+        if (b)
+        {
+            freeList[cls] = b->next;
+            freeCount[cls]--;
+            sharedCached -= b->total;
+            sharedTake(b->total);
+        }
+        pthread_mutex_unlock(&poolLock);
+
+        if (b)
+            countAdd(t, &t->reused, 1);
+        else
+        {
+            // 系统调用和缺页不在锁内
+            b = systemAlloc(cls, __atomic_load_n(&hugeMode, __ATOMIC_RELAXED));
+            if (!b)
+                return NULL;
+            countAdd(t, &t->systemAllocs, 1);
+            countAdd(t, &t->mappedAllocs, b->mapped);
+            countAdd(t, &t->hugeAllocs, b->huge);
+            pthread_mutex_lock(&poolLock);
+            sharedTake(b->total);
+            pthread_mutex_unlock(&poolLock);
+        }
+    }
+    b->next = NULL;
+    countAdd(t, &t->bytesInUse, b->total);
+    return blockData(b);
+}
+
+void *poolRealloc(void *ptr, size_t size)
+{
+    if (!ptr)
+        return poolAlloc(size);
+    PoolBlock *b = dataBlock(ptr);
+    size_t capacity = classBytes(b->cls);
+    if (size <= capacity)
+        return ptr;
+    void *grown = poolAlloc(size);
+    if (!grown)
+        return NULL;
+    memcpy(grown, ptr, capacity);
+    poolFree(ptr);
+    return grown;
+}
+
+void poolFree(void *ptr)
+{
+    if (!ptr)
+        return;
+    PoolBlock *b = dataBlock(ptr);
+    PoolThread *t = currentThread();
+    countAdd(t, &t->bytesInUse, -b->total);
+    if (t != &orphanThread && b->cls < POOL_THREAD_CLASSES && t->count[b->cls] < POOL_THREAD_CACHE)
+    {
+        b->next = t->list[b->cls];
+        t->list[b->cls] = b;
+        t->count[b->cls]++;
+        countAdd(t, &t->bytesCached, b->total);
+        return;
+    }
+    pthread_mutex_lock(&poolLock);
+    PoolBlock *toFree = sharedPut(t, b, 0, NULL);
+    pthread_mutex_unlock(&poolLock);
+    systemFreeList(toFree);
+}
+
+void poolTrim(void)
+{
+    // 其他线程缓存中的缓冲区在该线程下一次调用 poolAlloc/poolFree 时归还
+    __atomic_add_fetch(&trimGeneration, 1, __ATOMIC_ACQ_REL);
+    PoolThread *t = currentThread();
+    PoolBlock *list = NULL;
+    pthread_mutex_lock(&poolLock);
+    for (int cls = 0; cls < POOL_CLASSES; cls++)
+    {
+        while (freeList[cls])
+        {
+            PoolBlock *b = freeList[cls];
+            freeList[cls] = b->next;
+            b->next = list;
+            list = b;
+            countAdd(t, &t->released, 1);
+        }
+        freeCount[cls] = 0;
+    }
+    sharedCached = 0;
+    pthread_mutex_unlock(&poolLock);
+    systemFreeList(list);
+}
+
+void poolSetHugePages(PoolHugePages mode)
+{
+    __atomic_store_n(&hugeMode, mode, __ATOMIC_RELAXED);
+}
+
+static void addThreadStats(PoolStats *out, PoolThread *t)
+{
+    out->allocs += __atomic_load_n(&t->allocs, __ATOMIC_RELAXED);
+    out->reused += __atomic_load_n(&t->reused, __ATOMIC_RELAXED);
+    out->systemAllocs += __atomic_load_n(&t->systemAllocs, __ATOMIC_RELAXED);
+    out->mappedAllocs += __atomic_load_n(&t->mappedAllocs, __ATOMIC_RELAXED);
+    out->hugeAllocs += __atomic_load_n(&t->hugeAllocs, __ATOMIC_RELAXED);
+    out->released += __atomic_load_n(&t->released, __ATOMIC_RELAXED);
+    out->bytesInUse += __atomic_load_n(&t->bytesInUse, __ATOMIC_RELAXED);
+    out->bytesCached += __atomic_load_n(&t->bytesCached, __ATOMIC_RELAXED);
+}
+
+// 汇总各线程的计数; 其他线程正在分配时结果是近似值
+void poolGetStats(PoolStats *out)
+{
+    memset(out, 0, sizeof(*out));
+    pthread_mutex_lock(&poolLock);
+    for (PoolThread *t = threads; t; t = t->next)
+    {
+        addThreadStats(out, t);
+    }
+    addThreadStats(out, &orphanThread);
+    out->bytesCached += sharedCached;
+    out->peakInUse = sharedPeak > out->bytesInUse ? sharedPeak : out->bytesInUse;
+    pthread_mutex_unlock(&poolLock);
+}
+void poolPrintStats(FILE *out)
+{
+    PoolStats s;
+    poolGetStats(&s);
+    fprintf(out, "Allocations: %zu (reused %zu, system %zu, mmap %zu, huge pages %zu, released %zu)\n",
+            s.allocs, s.reused, s.systemAllocs, s.mappedAllocs, s.hugeAllocs, s.released);
+    fprintf(out, "Pool bytes: in use %zu, peak %zu, cached %zu\n", s.bytesInUse, s.peakInUse, s.bytesCached);
+}
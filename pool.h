@@ -0,0 +1,54 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+// 缓冲区池: DES.c/workMode.c/util.c 的数组都从这里分配, 释放时按容量分级缓存,
+// 下一次调用或下一个批量任务直接复用, 省去重复的 malloc/mmap 和缺页
+// 容量按2的幂向上取整(头部另计), 数据起始地址按缓存行(64字节)对齐. 线程安全:
+// 64KB以下的缓冲区先在每个线程自己的小缓存中分配和释放, 不取全局锁; 线程退出时其缓存交回共享缓存
+// 池分配的内存必须用 poolFree 释放
+
+// 大数组的页面类型, 只作用于 POOL_MMAP_THRESHOLD 以上直接 mmap 的缓冲区
+typedef enum
+{
+    POOL_HUGE_OFF = 0, // 普通4KB页
+    POOL_HUGE_THP = 1, // madvise(MADV_HUGEPAGE), 由内核透明大页合并
+    POOL_HUGE_TLB = 2  // MAP_HUGETLB 预留大页, 不可用时退回 THP
+} PoolHugePages;
+
+// 达到此容量的缓冲区直接 mmap, 数据区按2MB大页对齐
+#define POOL_MMAP_THRESHOLD (2u << 20)
+
+// 分配统计, 由各线程的计数汇总
+typedef struct
+{
+    size_t allocs;       // poolAlloc 调用次数
+    size_t reused;       // 其中由缓存满足的次数
+    size_t systemAllocs; // 向系统申请的次数 (malloc 或 mmap)
+    size_t mappedAllocs; // 其中 mmap 的次数
+    size_t hugeAllocs;   // 其中使用大页的次数
+    size_t released;     // 归还系统的次数
+    size_t bytesInUse;   // 当前已分配容量
+    size_t peakInUse;    // 已分配容量的峰值, 含当时各线程缓存中的容量
+    size_t bytesCached;  // 缓存中等待复用的容量
+} PoolStats;
+
+// 分配至少 size 字节, size 为0时也返回有效指针. 失败返回NULL
+void *poolAlloc(size_t size);
+// 扩大缓冲区, 容量足够时原样返回. 失败返回NULL且原缓冲区不变
+void *poolRealloc(void *ptr, size_t size);
+// 释放到缓存, 缓存已满时归还系统. ptr 可为NULL
+void poolFree(void *ptr);
+
+// 归还共享缓存和本线程缓存中的缓冲区; 其他线程缓存中的在该线程下一次调用 poolAlloc/poolFree 时归还
+void poolTrim(void);
+
+// 设置之后分配的大数组的页面类型
+void poolSetHugePages(PoolHugePages mode);
+
+void poolGetStats(PoolStats *stats);
+void poolPrintStats(FILE *out);
+
+#endif // POOL_H
@@ -0,0 +1,229 @@
+#include "range.h"
+#include "util.h"
+#include "workMode.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static int preadFull(int fd, void *buf, size_t n, off_t offset)
+{
+    char *p = (char *)buf;
+    while (n > 0)
+    {
+        ssize_t r = pread(fd, p, n, offset);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            return 0;
+        p += r;
+        n -= (size_t)r;
+        offset += r;
+    }
+    return 1;
+}
+
+// 读取密文字节 [start, end). 十六进制输入按每字节2个字符直接定位,
+// 窗口内出现非十六进制字符(换行等分隔符)说明无法定位, 返回-1由调用者整体读取
+static int readWindow(int fd, bool binary, uint64_t start, uint64_t end, unsigned char *buf)
+{
+    size_t n = (size_t)(end - start);
+    if (binary)
+        return preadFull(fd, buf, n, (off_t)start);
+
+    char *text = (char *)poolAlloc(n * 2 + 1);
+    if (!text)
+        return 0;
+    int ok = preadFull(fd, text, n * 2, (off_t)(start * 2));
+    if (ok > 0)
+    {
+        // hexDecode 跳过非十六进制字符, 解码出的字节不足 n 个说明窗口内有分隔符
+        size_t consumed;
+        int nibble = -1;
+        if (hexDecode((const unsigned char *)text, n * 2, &consumed, buf, n, &nibble) != n)
+            ok = -1;
+    }
+    poolFree(text);
+    return ok;
+}
+
+// 十六进制文本能否按字符定位: 文件开头(至多4KB)出现分隔符的按行折断/分组文本一律整体读取,
+// 窗口内再出现非十六进制字符时同样退回
+#define HEX_PROBE_BYTES 4096
+
+static int hexIsCompact(int fd, off_t fileSize)
+{
+    char probe[HEX_PROBE_BYTES];
+    size_t n = fileSize < HEX_PROBE_BYTES ? (size_t)fileSize : HEX_PROBE_BYTES;
+    if (!preadFull(fd, probe, n, 0))
+        return 0;
+    // 就地解码, 每个字符都是十六进制字符时恰好得到 n/2 个字节(n 为奇数时余下半个)
+    size_t consumed;
+    int nibble = -1;
+    size_t got = hexDecode((const unsigned char *)probe, n, &consumed, (unsigned char *)probe, n, &nibble);
+    return 2 * got + (nibble >= 0) == n;
+}
+
+// 在已读入的密文窗口 [winStart, winEnd) 上解密 [offset, offset+len)
+static int decryptWindow(DES *des, EncryptionMode mode, bool feedback8, const unsigned char *win,
+                         uint64_t winStart, uint64_t winEnd, uint64_t offset, size_t len, unsigned char *out)
+{
+    if (feedback8)
+    {
+        // 移位寄存器 = IV 依次移入区间前的(至多8个)密文字节
+        BYTE reg = des->iv;
+        for (uint64_t p = winStart; p < offset; p++)
+        {
+            reg = (reg << 8) | win[p - winStart];
+        }
+        memcpy(out, win + (offset - winStart), len);
+        return DES_decrypt8InPlace(des, out, len, CFB, &reg);
+    }
+
+    uint64_t first = offset / 8, last = (offset + len - 1) / 8;
+    size_t n = (size_t)(last - first + 1);
+    BYTE *blocks = (BYTE *)poolAlloc(n * sizeof(BYTE));
+    unsigned char *bytes = (unsigned char *)poolAlloc(n * 8);
+    if (!blocks || !bytes)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        poolFree(blocks);
+        poolFree(bytes);
+        return 0;
+    }
+    // 末尾不足8字节的块低位补0, 与 readHexFile 一致
+    uint64_t avail = winEnd - first * 8;
+    memset(blocks, 0, n * sizeof(BYTE));
+    bytesToBlocks(win + (first * 8 - winStart), (size_t)(avail < n * 8 ? avail : n * 8), blocks);
+
+    // 链接状态为前一个密文块, 区间从第一个块开始时为IV
+    BYTE prev = des->iv;
+    if (first > 0)
+        bytesToBlocks(win + (first * 8 - 8 - winStart), 8, &prev);
+    int ok = DES_decryptInPlace(des, blocks, n, mode, &prev);
+    if (ok)
+    {
+        blocksToBytes(blocks, n, bytes);
+        memcpy(out, bytes + (offset - first * 8), len);
+    }
+    poolFree(blocks);
+    poolFree(bytes);
+    return ok;
+}
+
+int decryptFileRange(DES *des, EncryptionMode mode, bool feedback8, const char *inPath, bool binary,
+                     uint64_t offset, uint64_t length, unsigned char *out, size_t *outLen)
+{
+    if (mode == OFB || (feedback8 && mode != CFB))
+    {
+        fprintf(stderr, "Error: Range decryption supports ECB, CBC and CFB only\n");
+        return 0;
+    }
+    int fd = open(inPath, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        fprintf(stderr, "Error: Unable to open file: %s\n", inPath);
+        if (fd >= 0)
+            close(fd);
+        return 0;
+    }
+    uint64_t cipherLen = binary ? (uint64_t)st.st_size : (uint64_t)st.st_size / 2;
+    if (offset >= cipherLen || length == 0)
+    {
+        fprintf(stderr, "Error: Range starts beyond the end of %s\n", inPath);
+        close(fd);
+        return 0;
+    }
+    size_t len = (size_t)(length < cipherLen - offset ? length : cipherLen - offset);
+
+    // 需要读取的密文窗口: 区间本身, 加上前一个块(CFB8为前8个字节)
+    uint64_t winStart, winEnd;
+    if (feedback8)
+    {
+        winStart = offset > 8 ? offset - 8 : 0;
+        winEnd = offset + len;
+    }
+    else
+    {
+        uint64_t first = offset / 8, last = (offset + len - 1) / 8;
+        winStart = first > 0 ? (first - 1) * 8 : 0;
+        winEnd = (last + 1) * 8 < cipherLen ? (last + 1) * 8 : cipherLen;
+    }
+
+    unsigned char *win = (unsigned char *)poolAlloc((size_t)(winEnd - winStart));
+    int r = !win ? 0 : (!binary && !hexIsCompact(fd, st.st_size)) ? -1 : readWindow(fd, binary, winStart, winEnd, win);
+    close(fd);
+    if (r < 0)
+    {
+        // 带分隔符的十六进制文本无法按字符定位, 整体读取后再取区间
+        poolFree(win);
+        size_t total = 0;
+        win = readHexFile8(inPath, &total);
+        if (!win || offset >= total)
+        {
+            fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+            poolFree(win);
+            return 0;
+        }
+        len = len < total - offset ? len : (size_t)(total - offset);
+        if (!feedback8)
+        {
+            uint64_t end = ((offset + len - 1) / 8 + 1) * 8;
+            winEnd = end < total ? end : total;
+        }
+        else
+        {
+            winEnd = offset + len;
+        }
+        // 窗口起点不变, 只是数据来自整个文件
+        memmove(win, win + winStart, (size_t)(winEnd - winStart));
+        r = 1;
+    }
+    if (r == 0)
+    {
+        fprintf(stderr, "Error: Unable to read input file: %s\n", inPath);
+        poolFree(win);
+        return 0;
+    }
+
+    int ok = decryptWindow(des, mode, feedback8, win, winStart, winEnd, offset, len, out);
+    poolFree(win);
+    if (ok)
+        *outLen = len;
+    return ok;
+}
+
+int processFileRange(DES *des, EncryptionMode mode, const char *inPath, bool binary,
+                     uint64_t offset, uint64_t length, const char *outPath)
+{
+    if (length == 0)
+    {
+        fprintf(stderr, "Error: Range length must be positive\n");
+        return 0;
+    }
+    // 区间不会超过文件, 文件大小即可作为缓冲区上限
+    struct stat st;
+    if (stat(inPath, &st) < 0)
+    {
+        fprintf(stderr, "Error: Unable to open file: %s\n", inPath);
+        return 0;
+    }
+    size_t cap = (size_t)(length < (uint64_t)st.st_size ? length : (uint64_t)st.st_size);
+    unsigned char *out = (unsigned char *)poolAlloc(cap ? cap : 1);
+    if (!out)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 0;
+    }
+    size_t outLen = 0;
+    // 命令行的CFB为8位反馈
+    int ok = decryptFileRange(des, mode, mode == CFB, inPath, binary, offset, cap, out, &outLen) &&
+             writeHexByteFile(outPath, out, outLen);
+    poolFree(out);
+    return ok;
+}
@@ -0,0 +1,23 @@
+#ifndef RANGE_H
+#define RANGE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "DES.h"
+#include "enum.h"
+
+// 随机访问区间解密: CBC/CFB 解密任一位置只需要它前面的一段密文,
+// 因此只读取区间覆盖的密文和紧邻其前的一个块(CFB8为前8个字节), 不必解密整个文件
+
+// 解密明文区间 [offset, offset+length) 到 out (容量至少 length 字节), 实际长度写入 *outLen
+// (区间超出文件末尾时截短). mode 支持 ECB/CBC/CFB, feedback8 为真时CFB按8位反馈(与命令行一致)
+// binary 为真时输入为原始密文字节, 否则为十六进制文本; 十六进制输入含分隔符时退回整体读取
+// iv 为 des->iv. 成功返回1
+int decryptFileRange(DES *des, EncryptionMode mode, bool feedback8, const char *inPath, bool binary,
+                     uint64_t offset, uint64_t length, unsigned char *out, size_t *outLen);
+
+// 命令行入口: 解密区间并把明文以十六进制文本写入 outPath, 成功返回1
+int processFileRange(DES *des, EncryptionMode mode, const char *inPath, bool binary,
+                     uint64_t offset, uint64_t length, const char *outPath);
+
+#endif // RANGE_H
@@ -0,0 +1,919 @@
+#define _GNU_SOURCE // accept4
+#include "service.h"
+#include "util.h"
+#include "pool.h"
+#include "workMode.h"
+#include "metrics.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+
+int serviceReadFull(int fd, void *buf, size_t len)
+{
+    unsigned char *p = (unsigned char *)buf;
+    while (len > 0)
+    {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        p += n;
+        len -= (size_t)n;
+    }
+    return 1;
+}
+
+int serviceWriteFull(int fd, const void *buf, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)buf;
+    while (len > 0)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return 0;
+        p += n;
+        len -= (size_t)n;
+    }
+    return 1;
+}
+
+#ifdef __linux__
+
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+
+// 延迟直方图桶数: 第b个桶统计 [2^b, 2^(b+1)) 微秒的请求
+#define LATENCY_BUCKETS 32
+#define SERVICE_MAX_EVENTS 64
+#define SERVICE_BACKLOG 128
+// 工作线程一次从队列取走的最大请求数
+#define SERVICE_WORKER_BATCH 16
+// 指标文件的写入间隔(秒)
+#define SERVICE_METRICS_INTERVAL 5
+// 指标连接等待请求行的时间(毫秒), 没有请求行时按 Prometheus 格式回复
+#define SERVICE_METRICS_WAIT_MS 100
+
+// 已加载的密钥: 密钥编排在启动时生成并常驻内存, 所有工作线程只读共享
+// 每个请求在栈上绑定一个带自己IV的上下文, 不再为线程复制密钥
+typedef struct
+{
+    uint32_t id;
+    const DES_KeySchedule *schedule;
+} ServiceKey;
+
+// 一个客户端连接. 同一连接同一时刻最多只有一个请求在工作线程中处理
+typedef struct Connection
+{
+    int fd;
+    ServiceRequest req;
+    size_t headerGot;
+    unsigned char *payload;
+    size_t payloadGot;
+    unsigned char *response; // 响应帧头 + 结果
+    size_t responseLen;
+    size_t responseSent;
+    struct timespec received;
+    struct Connection *next; // 任务/完成队列链接
+} Connection;
+
+// 简单的链表队列
+typedef struct
+{
+    Connection *head;
+    Connection *tail;
+} ConnQueue;
+
+typedef struct
+{
+    ServiceKey *keys;
+    size_t keyCount;
+
+    int epollFd;
+    int eventFd; // 工作线程完成请求后通知事件循环
+
+    pthread_mutex_t jobLock;
+    pthread_cond_t jobCond;
+    ConnQueue jobs;
+    size_t jobCount;
+    int numWorkers;
+    int stopping;
+
+    pthread_mutex_t doneLock;
+    ConnQueue done;
+
+    // 统计信息, 使用原子操作更新
+    uint64_t requests;
+    uint64_t errors;
+    uint64_t bytes;
+    uint64_t connections;
+    uint64_t latency[LATENCY_BUCKETS];
+
+    // 指标导出线程: 在 metricsFd 上回复指标, 并定期写入 metricsFile
+    int metricsFd;
+    const char *metricsFile;
+    int metricsWake; // eventfd, 通知导出线程退出
+} ServiceState;
+
+// epoll 中用于区分监听套接字和eventfd的标记
+static char listenTag, wakeTag;
+static volatile sig_atomic_t serviceStop = 0;
+
+static void serviceSignal(int sig)
+{
+    (void)sig;
+    serviceStop = 1;
+}
+
+static void queuePush(ConnQueue *q, Connection *c)
+{
+    c->next = NULL;
+    if (q->tail)
+        q->tail->next = c;
+    else
+        q->head = c;
+    q->tail = c;
+}
+
+static Connection *queuePop(ConnQueue *q)
+{
+    Connection *c = q->head;
+    if (c)
+    {
+        q->head = c->next;
+        if (!q->head)
+            q->tail = NULL;
+    }
+    return c;
+}
+
+static int compareKeyId(const void *a, const void *b)
+{
+    uint32_t x = ((const ServiceKey *)a)->id, y = ((const ServiceKey *)b)->id;
+    return (x > y) - (x < y);
+}
+
+static const DES_KeySchedule *findKey(ServiceState *st, uint32_t id)
+{
+    ServiceKey probe = {id, NULL};
+    ServiceKey *k = (ServiceKey *)bsearch(&probe, st->keys, st->keyCount, sizeof(ServiceKey), compareKeyId);
+    return k ? k->schedule : NULL;
+}
+
+static int addKey(ServiceState *st, uint32_t id, BYTE key)
+{
+    if (findKey(st, id))
+    {
+        fprintf(stderr, "Error: Duplicate key id: %u\n", id);
+        return 0;
+    }
+    ServiceKey *grown = (ServiceKey *)realloc(st->keys, (st->keyCount + 1) * sizeof(ServiceKey));
+    const DES_KeySchedule *schedule = DES_scheduleCreate(key);
+    if (!grown || !schedule)
+    {
+        DES_scheduleFree(schedule);
+        if (grown)
+            st->keys = grown;
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 0;
+    }
+    st->keys = grown;
+    st->keys[st->keyCount].id = id;
+    st->keys[st->keyCount].schedule = schedule;
+    st->keyCount++;
+    // 保持有序以便二分查找
+    qsort(st->keys, st->keyCount, sizeof(ServiceKey), compareKeyId);
+    return 1;
+}
+
+// 读取密钥表, 每行"<id> <16个hex字符>", 忽略空行和#注释
+static int loadKeyTable(ServiceState *st, const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        fprintf(stderr, "Error: Unable to open key table: %s\n", path);
+        return 0;
+    }
+    char line[256];
+    size_t lineNo = 0;
+    int ok = 1;
+    while (ok && fgets(line, sizeof(line), file))
+    {
+        lineNo++;
+        char *idStr = strtok(line, " \t\r\n");
+        if (!idStr || idStr[0] == '#')
+            continue;
+        char *keyStr = strtok(NULL, " \t\r\n");
+        char *end = NULL;
+        unsigned long id = strtoul(idStr, &end, 10);
+        int valid = keyStr && *end == '\0' && strlen(keyStr) == 16;
+        for (size_t i = 0; valid && i < 16; i++)
+            valid = isxdigit((unsigned char)keyStr[i]);
+        if (!valid)
+        {
+            fprintf(stderr, "Error: Invalid key table line %zu: %s\n", lineNo, path);
+            ok = 0;
+            break;
+        }
+        ok = addKey(st, (uint32_t)id, strtoull(keyStr, NULL, 16));
+    }
+    fclose(file);
+    return ok;
+}
+
+static uint64_t elapsedMicros(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int64_t us = (int64_t)(now.tv_sec - start->tv_sec) * 1000000 + (now.tv_nsec - start->tv_nsec) / 1000;
+    return us > 0 ? (uint64_t)us : 0;
+}
+
+static void recordLatency(ServiceState *st, uint64_t us)
+{
+    int bucket = 0;
+    while (bucket < LATENCY_BUCKETS - 1 && (us >> (bucket + 1)) != 0)
+        bucket++;
+    __atomic_fetch_add(&st->latency[bucket], 1, __ATOMIC_RELAXED);
+}
+
+// 生成文本格式的统计信息. 与其他结果一样从缓冲区池分配, 由 finishJob 释放
+static char *formatStats(ServiceState *st, size_t *len)
+{
+    size_t cap = 256 + LATENCY_BUCKETS * 64;
+    char *text = (char *)poolAlloc(cap);
+    if (!text)
+        return NULL;
+    size_t n = 0;
+    n += snprintf(text + n, cap - n, "requests %llu\nerrors %llu\nbytes %llu\nconnections %llu\nkeys %zu\n",
+                  (unsigned long long)__atomic_load_n(&st->requests, __ATOMIC_RELAXED),
+                  (unsigned long long)__atomic_load_n(&st->errors, __ATOMIC_RELAXED),
+                  (unsigned long long)__atomic_load_n(&st->bytes, __ATOMIC_RELAXED),
+                  (unsigned long long)__atomic_load_n(&st->connections, __ATOMIC_RELAXED),
+                  st->keyCount);
+    for (int b = 0; b < LATENCY_BUCKETS; b++)
+    {
+        uint64_t count = __atomic_load_n(&st->latency[b], __ATOMIC_RELAXED);
+        if (count)
+            n += snprintf(text + n, cap - n, "latency_us[%llu,%llu) %llu\n",
+                          b ? 1ULL << b : 0ULL, 1ULL << (b + 1), (unsigned long long)count);
+    }
+    // 开启了指标时附上各模式的耗时分布
+    size_t metricsLen = 0;
+    char *metrics = metricsEnabled() ? metricsFormat(METRICS_FORMAT_TEXT, &metricsLen) : NULL;
+    if (metrics)
+    {
+        char *grown = (char *)poolRealloc(text, n + metricsLen + 1);
+        if (grown)
+        {
+            text = grown;
+            memcpy(text + n, metrics, metricsLen + 1);
+            n += metricsLen;
+        }
+        free(metrics);
+    }
+    *len = n;
+    return text;
+}
+
+// 执行一个请求, 返回结果缓冲区(长度写入outLen), 状态写入status
+static unsigned char *executeRequest(ServiceState *st, const ServiceRequest *req,
+                                     unsigned char *payload, size_t *outLen, int32_t *status)
+{
+    *outLen = 0;
+    if (req->op == SERVICE_OP_STATS)
+    {
+        char *text = formatStats(st, outLen);
+        *status = text ? SERVICE_OK : SERVICE_ERR_INTERNAL;
+        return (unsigned char *)text;
+    }
+    if (req->op != SERVICE_OP_CRYPT)
+    {
+        *status = SERVICE_ERR_MODE;
+        return NULL;
+    }
+
+    const DES_KeySchedule *schedule = findKey(st, req->keyId);
+    if (!schedule)
+    {
+        *status = SERVICE_ERR_KEY;
+        return NULL;
+    }
+
+    size_t len = req->length;
+    BYTE iv = req->iv;
+    DES context;
+    DES *des = &context;
+    DES_bind(des, schedule, iv);
+    *status = SERVICE_ERR_INTERNAL;
+
+    // CFB/OFB 与命令行一致使用8位反馈, 直接处理字节
+    if (req->mode == CFB || req->mode == OFB)
+    {
+        unsigned char *out;
+        size_t outSize = 0;
+        if (req->mode == CFB)
+            out = req->decrypt ? CFB8_decrypt(des, payload, len, iv, &outSize)
+                               : CFB8_encrypt(des, payload, len, iv, &outSize);
+        else
+            out = req->decrypt ? OFB8_decrypt(des, payload, len, iv, &outSize)
+                               : OFB8_encrypt(des, payload, len, iv, &outSize);
+        if (out)
+        {
+            *status = SERVICE_OK;
+            *outLen = outSize;
+        }
+        return out;
+    }
+
+    if (req->mode != ECB && req->mode != CBC)
+    {
+        *status = SERVICE_ERR_MODE;
+        return NULL;
+    }
+    if (len % 8 != 0)
+    {
+        *status = SERVICE_ERR_LENGTH;
+        return NULL;
+    }
+
+    size_t blocks = len / 8, outBlocks = 0;
+    BYTE *in = (BYTE *)poolAlloc(blocks * sizeof(BYTE));
+    if (!in)
+        return NULL;
+    bytesToBlocks(payload, len, in);
+
+    // 共享的DES实例只读使用, IV按请求直接传给模式函数
+    BYTE *out;
+    if (req->mode == ECB)
+        out = req->decrypt ? ECB_decrypt(des, in, blocks, &outBlocks) : ECB_encrypt(des, in, blocks, &outBlocks);
+    else
+        out = req->decrypt ? CBC_decrypt(des, in, blocks, &iv, 1, &outBlocks)
+                           : CBC_encrypt(des, in, blocks, &iv, 1, &outBlocks);
+    poolFree(in);
+    if (!out)
+        return NULL;
+
+    // 结果展开为字节, 写入新分配的缓冲区 (BYTE数组与字节数组大小相同)
+    unsigned char *bytes = (unsigned char *)poolAlloc(len);
+    if (bytes)
+    {
+        blocksToBytes(out, outBlocks, bytes);
+        *status = SERVICE_OK;
+        *outLen = len;
+    }
+    poolFree(out);
+    return bytes;
+}
+
+// 构造响应并交回事件循环. 请求负载和 result 都来自缓冲区池
+static void finishJob(ServiceState *st, Connection *c, unsigned char *result, size_t resultLen, int32_t status)
+{
+    poolFree(c->payload);
+    c->payload = NULL;
+
+    ServiceResponse resp = {SERVICE_RESPONSE_MAGIC, status, (uint32_t)resultLen, 0};
+    c->responseLen = sizeof(resp) + resultLen;
+    c->responseSent = 0;
+    c->response = (unsigned char *)malloc(c->responseLen);
+    if (!c->response)
+    {
+        // 无法构造结果时只返回错误帧头
+        resp.status = SERVICE_ERR_INTERNAL;
+        resp.length = 0;
+        c->responseLen = sizeof(resp);
+        c->response = (unsigned char *)malloc(sizeof(resp));
+    }
+    if (c->response)
+    {
+        memcpy(c->response, &resp, sizeof(resp));
+        if (resp.length)
+            memcpy(c->response + sizeof(resp), result, resultLen);
+    }
+    poolFree(result);
+
+    metricsGaugeAdd(METRICS_IN_FLIGHT, -1);
+    __atomic_fetch_add(&st->requests, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&st->bytes, c->req.length, __ATOMIC_RELAXED);
+    if (resp.status != SERVICE_OK)
+        __atomic_fetch_add(&st->errors, 1, __ATOMIC_RELAXED);
+    recordLatency(st, elapsedMicros(&c->received));
+
+    pthread_mutex_lock(&st->doneLock);
+    queuePush(&st->done, c);
+    pthread_mutex_unlock(&st->doneLock);
+    uint64_t one = 1;
+    if (write(st->eventFd, &one, sizeof(one)) < 0)
+        perror("eventfd write");
+}
+
+// 可以合并为多路CBC的请求: 已注册密钥的整块CBC加密
+static int isMultiCBC(ServiceState *st, const ServiceRequest *req)
+{
+    return req->op == SERVICE_OP_CRYPT && req->mode == CBC && !req->decrypt &&
+           req->length % 8 == 0 && req->length > 0 && findKey(st, req->keyId) != NULL;
+}
+
+// 一批请求中使用同一密钥的CBC加密请求一起用多路CBC加密, 其余请求逐个执行
+static void executeBatch(ServiceState *st, Connection **batch, size_t n)
+{
+    CBCStream streams[SERVICE_WORKER_BATCH];
+    Connection *members[SERVICE_WORKER_BATCH];
+    int handled[SERVICE_WORKER_BATCH] = {0};
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (handled[i] || !isMultiCBC(st, &batch[i]->req))
+            continue;
+        size_t count = 0;
+        for (size_t j = i; j < n; j++)
+        {
+            Connection *c = batch[j];
+            if (handled[j] || !isMultiCBC(st, &c->req) || c->req.keyId != batch[i]->req.keyId)
+                continue;
+            BYTE *blocks = (BYTE *)poolAlloc(c->req.length);
+            if (!blocks)
+                continue; // 留给下面逐个执行
+            bytesToBlocks(c->payload, c->req.length, blocks);
+            streams[count].in = blocks;
+            streams[count].out = blocks;
+            streams[count].blocks = c->req.length / 8;
+            streams[count].iv = c->req.iv;
+            members[count++] = c;
+            handled[j] = 1;
+        }
+
+        DES des;
+        DES_bind(&des, findKey(st, batch[i]->req.keyId), 0);
+        CBC_encryptMulti(&des, streams, count);
+        for (size_t k = 0; k < count; k++)
+        {
+            // 结果写回请求负载的缓冲区(大小相同), 由 finishJob 复制到响应
+            Connection *c = members[k];
+            blocksToBytes(streams[k].out, streams[k].blocks, c->payload);
+            poolFree(streams[k].out);
+            unsigned char *result = c->payload;
+            c->payload = NULL;
+            finishJob(st, c, result, c->req.length, SERVICE_OK);
+        }
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (handled[i])
+            continue;
+        size_t resultLen = 0;
+        int32_t status;
+        unsigned char *result = executeRequest(st, &batch[i]->req, batch[i]->payload, &resultLen, &status);
+        finishJob(st, batch[i], result, resultLen, status);
+    }
+}
+
+static void *serviceWorker(void *arg)
+{
+    ServiceState *st = (ServiceState *)arg;
+    Connection *batch[SERVICE_WORKER_BATCH];
+    for (;;)
+    {
+        // 一次取走排队请求中属于自己的一份(至多 SERVICE_WORKER_BATCH 个), 其余留给其他工作线程
+        size_t n = 0;
+        pthread_mutex_lock(&st->jobLock);
+        while (!st->jobs.head && !st->stopping)
+            pthread_cond_wait(&st->jobCond, &st->jobLock);
+        size_t share = (st->jobCount + st->numWorkers - 1) / st->numWorkers;
+        if (share > SERVICE_WORKER_BATCH)
+            share = SERVICE_WORKER_BATCH;
+        while (n < share && (batch[n] = queuePop(&st->jobs)) != NULL)
+            n++;
+        st->jobCount -= n;
+        metricsGaugeSet(METRICS_QUEUE_DEPTH, (int64_t)st->jobCount);
+        metricsGaugeAdd(METRICS_IN_FLIGHT, (int64_t)n);
+        pthread_mutex_unlock(&st->jobLock);
+        if (n == 0)
+            break;
+        executeBatch(st, batch, n);
+    }
+    return NULL;
+}
+
+static void closeConnection(Connection *c)
+{
+    close(c->fd);
+    poolFree(c->payload);
+    free(c->response);
+    free(c);
+}
+
+// 非阻塞读取请求. 返回1表示请求已完整, 0表示需要更多数据, -1表示应关闭连接
+static int readRequest(Connection *c)
+{
+    while (c->headerGot < sizeof(ServiceRequest))
+    {
+        ssize_t n = read(c->fd, (unsigned char *)&c->req + c->headerGot, sizeof(ServiceRequest) - c->headerGot);
+        if (n == 0)
+            return -1;
+        if (n < 0)
+            return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+        c->headerGot += (size_t)n;
+        if (c->headerGot == sizeof(ServiceRequest))
+        {
+            if (c->req.magic != SERVICE_REQUEST_MAGIC || c->req.length > SERVICE_MAX_PAYLOAD)
+                return -1;
+            c->payload = (unsigned char *)poolAlloc(c->req.length);
+            c->payloadGot = 0;
+            if (!c->payload)
+                return -1;
+            // 请求开始计时: 以帧头到达为起点
+            clock_gettime(CLOCK_MONOTONIC, &c->received);
+        }
+    }
+    while (c->payloadGot < c->req.length)
+    {
+        ssize_t n = read(c->fd, c->payload + c->payloadGot, c->req.length - c->payloadGot);
+        if (n == 0)
+            return -1;
+        if (n < 0)
+            return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+        c->payloadGot += (size_t)n;
+    }
+    return 1;
+}
+
+// 非阻塞写出响应. 返回1表示已写完, 0表示需等待可写, -1表示应关闭连接
+static int writeResponse(Connection *c)
+{
+    while (c->responseSent < c->responseLen)
+    {
+        ssize_t n = write(c->fd, c->response + c->responseSent, c->responseLen - c->responseSent);
+        if (n < 0)
+            return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+        c->responseSent += (size_t)n;
+    }
+    free(c->response);
+    c->response = NULL;
+    c->headerGot = 0;
+    return 1;
+}
+
+static int watch(ServiceState *st, int op, Connection *c, uint32_t events)
+{
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = c;
+    return epoll_ctl(st->epollFd, op, c->fd, &ev);
+}
+
+// 处理连接可读事件: 请求完整后暂停监听并交给工作线程
+static void onReadable(ServiceState *st, Connection *c)
+{
+    int r = readRequest(c);
+    if (r < 0)
+    {
+        epoll_ctl(st->epollFd, EPOLL_CTL_DEL, c->fd, NULL);
+        closeConnection(c);
+        return;
+    }
+    if (r == 0)
+        return;
+    epoll_ctl(st->epollFd, EPOLL_CTL_DEL, c->fd, NULL);
+    pthread_mutex_lock(&st->jobLock);
+    queuePush(&st->jobs, c);
+    st->jobCount++;
+    metricsGaugeSet(METRICS_QUEUE_DEPTH, (int64_t)st->jobCount);
+    pthread_cond_signal(&st->jobCond);
+    pthread_mutex_unlock(&st->jobLock);
+}
+
+// 响应写完后恢复读取; 写不完则等待可写
+static void flushResponse(ServiceState *st, Connection *c, int registered)
+{
+    int r = writeResponse(c);
+    if (r < 0)
+    {
+        if (registered)
+            epoll_ctl(st->epollFd, EPOLL_CTL_DEL, c->fd, NULL);
+        closeConnection(c);
+        return;
+    }
+    uint32_t events = r ? EPOLLIN : EPOLLOUT;
+    if (watch(st, registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, c, events) < 0)
+        closeConnection(c);
+}
+
+static void acceptConnections(ServiceState *st, int listenFd)
+{
+    for (;;)
+    {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+            return;
+        Connection *c = (Connection *)calloc(1, sizeof(Connection));
+        if (!c)
+        {
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        if (watch(st, EPOLL_CTL_ADD, c, EPOLLIN) < 0)
+        {
+            closeConnection(c);
+            continue;
+        }
+        __atomic_fetch_add(&st->connections, 1, __ATOMIC_RELAXED);
+    }
+}
+
+static int openListener(const char *socketPath)
+{
+    struct sockaddr_un addr;
+    if (strlen(socketPath) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "Error: Socket path too long: %s\n", socketPath);
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("socket");
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socketPath);
+    unlink(socketPath);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, SERVICE_BACKLOG) < 0)
+    {
+        fprintf(stderr, "Error: Unable to listen on %s: %s\n", socketPath, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 回复一个指标连接. 请求行以 "GET " 开头时按 HTTP 回复(可用 curl --unix-socket 抓取),
+// 请求行为 "text" 或 HTTP 路径含 "format=text" 时用文本格式, 其余情况(包括不发送请求)用 Prometheus 格式
+static void serveMetrics(int fd)
+{
+    char request[512];
+    ssize_t got = 0;
+    struct pollfd pfd = {fd, POLLIN, 0};
+    if (poll(&pfd, 1, SERVICE_METRICS_WAIT_MS) > 0)
+        got = read(fd, request, sizeof(request) - 1);
+    request[got > 0 ? got : 0] = '\0';
+    int http = strncmp(request, "GET ", 4) == 0;
+    int text = strncmp(request, "text", 4) == 0 || (http && strstr(request, "format=text") != NULL);
+
+    size_t len = 0;
+    char *body = metricsFormat(text ? METRICS_FORMAT_TEXT : METRICS_FORMAT_PROMETHEUS, &len);
+    if (!body)
+        return;
+    if (http)
+    {
+        char header[160];
+        int n = snprintf(header, sizeof(header),
+                         "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\n\r\n",
+                         len);
+        serviceWriteFull(fd, header, (size_t)n);
+    }
+    serviceWriteFull(fd, body, len);
+    free(body);
+}
+
+// 指标导出线程: 不占用事件循环, 抓取较慢的客户端不影响请求处理
+static void *metricsThread(void *arg)
+{
+    ServiceState *st = (ServiceState *)arg;
+    struct pollfd fds[2] = {{st->metricsWake, POLLIN, 0}, {st->metricsFd, POLLIN, 0}};
+    nfds_t nfds = st->metricsFd >= 0 ? 2 : 1;
+    for (;;)
+    {
+        int r = poll(fds, nfds, st->metricsFile ? SERVICE_METRICS_INTERVAL * 1000 : -1);
+        if (r < 0 && errno != EINTR)
+            break;
+        if (r > 0 && (fds[0].revents & POLLIN))
+            break;
+        if (r > 0 && nfds == 2 && (fds[1].revents & POLLIN))
+        {
+            int fd = accept4(st->metricsFd, NULL, NULL, SOCK_CLOEXEC);
+            if (fd >= 0)
+            {
+                serveMetrics(fd);
+                close(fd);
+            }
+        }
+        // 文件按间隔刷新; 频繁抓取时也顺带刷新, 间隔不会更长
+        if (st->metricsFile)
+            metricsWriteFile(st->metricsFile, METRICS_FORMAT_PROMETHEUS);
+    }
+    if (st->metricsFile)
+        metricsWriteFile(st->metricsFile, METRICS_FORMAT_PROMETHEUS);
+    return NULL;
+}
+
+int runService(const char *socketPath, const char *keyTablePath, const BYTE *defaultKey, int numThreads,
+               const char *metricsSocket, const char *metricsFile)
+{
+    ServiceState st;
+    memset(&st, 0, sizeof(st));
+    st.epollFd = st.eventFd = st.metricsFd = st.metricsWake = -1;
+    st.metricsFile = metricsFile;
+    int listenFd = -1, ret = 1, started = 0, metricsStarted = 0;
+    pthread_t *threads = NULL;
+    pthread_t metricsTid;
+
+    if (defaultKey && !addKey(&st, 0, *defaultKey))
+        goto cleanup;
+    if (keyTablePath && !loadKeyTable(&st, keyTablePath))
+        goto cleanup;
+    if (st.keyCount == 0)
+    {
+        fprintf(stderr, "Error: Service mode requires at least one key\n");
+        goto cleanup;
+    }
+
+    if (numThreads <= 0)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    listenFd = openListener(socketPath);
+    st.epollFd = epoll_create1(EPOLL_CLOEXEC);
+    st.eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (listenFd < 0 || st.epollFd < 0 || st.eventFd < 0)
+        goto cleanup;
+    if (metricsSocket || metricsFile)
+    {
+        if (metricsSocket && (st.metricsFd = openListener(metricsSocket)) < 0)
+            goto cleanup;
+        st.metricsWake = eventfd(0, EFD_CLOEXEC);
+        if (st.metricsWake < 0)
+            goto cleanup;
+        metricsSetEnabled(true);
+    }
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &listenTag;
+    epoll_ctl(st.epollFd, EPOLL_CTL_ADD, listenFd, &ev);
+    ev.data.ptr = &wakeTag;
+    epoll_ctl(st.epollFd, EPOLL_CTL_ADD, st.eventFd, &ev);
+
+    pthread_mutex_init(&st.jobLock, NULL);
+    pthread_cond_init(&st.jobCond, NULL);
+    pthread_mutex_init(&st.doneLock, NULL);
+    st.numWorkers = numThreads;
+    threads = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    for (; threads && started < numThreads; started++)
+    {
+        if (pthread_create(&threads[started], NULL, serviceWorker, &st) != 0)
+            break;
+    }
+    if (started == 0)
+    {
+        fprintf(stderr, "Error: Unable to start worker threads\n");
+        goto shutdown;
+    }
+    if (st.metricsWake >= 0)
+    {
+        metricsStarted = pthread_create(&metricsTid, NULL, metricsThread, &st) == 0;
+        if (!metricsStarted)
+            fprintf(stderr, "Warning: Unable to start the metrics thread, metrics are not exported\n");
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = serviceSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("Service listening on %s (%zu keys, %d workers)\n", socketPath, st.keyCount, started);
+    fflush(stdout);
+
+    struct epoll_event events[SERVICE_MAX_EVENTS];
+    while (!serviceStop)
+    {
+        int n = epoll_wait(st.epollFd, events, SERVICE_MAX_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("epoll_wait");
+            break;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            void *tag = events[i].data.ptr;
+            if (tag == &listenTag)
+            {
+                acceptConnections(&st, listenFd);
+            }
+            else if (tag == &wakeTag)
+            {
+                uint64_t count;
+                if (read(st.eventFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+                    perror("eventfd read");
+                pthread_mutex_lock(&st.doneLock);
+                Connection *done = st.done.head;
+                st.done.head = st.done.tail = NULL;
+                pthread_mutex_unlock(&st.doneLock);
+                while (done)
+                {
+                    Connection *next = done->next;
+                    if (done->response)
+                        flushResponse(&st, done, 0);
+                    else
+                        closeConnection(done);
+                    done = next;
+                }
+            }
+            else
+            {
+                Connection *c = (Connection *)tag;
+                if (c->response)
+                    flushResponse(&st, c, 1);
+                else
+                    onReadable(&st, c);
+            }
+        }
+    }
+    ret = 0;
+    printf("Service stopping\n");
+
+shutdown:
+    if (metricsStarted)
+    {
+        uint64_t one = 1;
+        if (write(st.metricsWake, &one, sizeof(one)) < 0)
+            perror("eventfd write");
+        pthread_join(metricsTid, NULL);
+    }
+    pthread_mutex_lock(&st.jobLock);
+    st.stopping = 1;
+    pthread_cond_broadcast(&st.jobCond);
+    pthread_mutex_unlock(&st.jobLock);
+    for (int t = 0; t < started; t++)
+        pthread_join(threads[t], NULL);
+    // 释放尚未处理或尚未写回的连接; 仍在epoll中的空闲连接随进程退出关闭
+    for (Connection *c; (c = queuePop(&st.jobs)) != NULL;)
+        closeConnection(c);
+    for (Connection *c; (c = queuePop(&st.done)) != NULL;)
+        closeConnection(c);
+    pthread_mutex_destroy(&st.jobLock);
+    pthread_cond_destroy(&st.jobCond);
+    pthread_mutex_destroy(&st.doneLock);
+
+cleanup:
+    free(threads);
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        unlink(socketPath);
+    }
+    if (st.epollFd >= 0)
+        close(st.epollFd);
+    if (st.eventFd >= 0)
+        close(st.eventFd);
+    if (st.metricsFd >= 0)
+    {
+        close(st.metricsFd);
+        unlink(metricsSocket);
+    }
+    if (st.metricsWake >= 0)
+        close(st.metricsWake);
+    for (size_t i = 0; i < st.keyCount; i++)
+        DES_scheduleFree(st.keys[i].schedule);
+    free(st.keys);
+    return ret;
+}
+
+#else
+
+int runService(const char *socketPath, const char *keyTablePath, const BYTE *defaultKey, int numThreads,
+               const char *metricsSocket, const char *metricsFile)
+{
+    (void)socketPath;
+    (void)metricsSocket;
+    (void)metricsFile;
+    (void)keyTablePath;
+    (void)defaultKey;
+    (void)numThreads;
+    fprintf(stderr, "Error: Service mode requires Linux (epoll)\n");
+    return 1;
+}
+
+#endif
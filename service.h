@@ -0,0 +1,67 @@
+#ifndef SERVICE_H
+#define SERVICE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "DES.h"
+
+// 常驻服务模式: 通过Unix域套接字接收加/解密请求
+// 所有字段均为主机字节序 (仅用于本机进程间通信)
+
+#define SERVICE_REQUEST_MAGIC 0x51534544u  // "DESQ"
+#define SERVICE_RESPONSE_MAGIC 0x52534544u // "DESR"
+#define SERVICE_MAX_PAYLOAD (64u * 1024 * 1024)
+
+// 请求类型
+typedef enum
+{
+    SERVICE_OP_CRYPT = 0, // 加/解密负载
+    SERVICE_OP_STATS = 1  // 返回文本格式的统计信息
+} ServiceOp;
+
+// 响应状态码
+typedef enum
+{
+    SERVICE_OK = 0,
+    SERVICE_ERR_KEY = 1,     // 未知的密钥ID
+    SERVICE_ERR_MODE = 2,    // 不支持的模式或请求类型
+    SERVICE_ERR_LENGTH = 3,  // ECB/CBC 负载长度不是8字节的整数倍
+    SERVICE_ERR_INTERNAL = 4 // 内存分配等内部错误
+} ServiceStatus;
+
+// 请求帧头, 其后紧跟 length 字节的负载
+// ECB/CBC 按64位块处理, CFB/OFB 与命令行一致使用8位反馈
+typedef struct
+{
+    uint32_t magic;
+    uint8_t op;      // ServiceOp
+    uint8_t mode;    // EncryptionMode
+    uint8_t decrypt; // 非0表示解密
+    uint8_t reserved;
+    uint32_t keyId;
+    uint32_t length;
+    uint64_t iv;
+} ServiceRequest;
+
+// 响应帧头, 其后紧跟 length 字节的结果
+typedef struct
+{
+    uint32_t magic;
+    int32_t status; // ServiceStatus
+    uint32_t length;
+    uint32_t reserved;
+} ServiceResponse;
+
+// 启动服务并阻塞直到收到 SIGINT/SIGTERM
+// keyTablePath: 每行"<id> <16个hex字符的密钥>"; defaultKey 非空时注册为ID 0
+// numThreads <= 0 时取CPU核数. 正常退出返回0
+// metricsSocket/metricsFile 非空时开启运行指标(见 metrics.h): 在该Unix域套接字上按连接回复指标,
+// 或每隔几秒以 Prometheus 文本格式原子替换该文件; 同时 SERVICE_OP_STATS 的回复附上各模式的耗时分布
+int runService(const char *socketPath, const char *keyTablePath, const BYTE *defaultKey, int numThreads,
+               const char *metricsSocket, const char *metricsFile);
+
+// 在阻塞套接字上完整读/写 len 字节, 成功返回1
+int serviceReadFull(int fd, void *buf, size_t len);
+int serviceWriteFull(int fd, const void *buf, size_t len);
+
+#endif // SERVICE_H
@@ -0,0 +1,391 @@
+#include "shmring.h"
+#include "workMode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define SHMRING_MAGIC 0x474E5252u // "RRNG"
+#define CACHE_LINE 64
+#define SHMRING_POLL_MS 100 // 工作进程等待提交时检查退出标志和被放弃槽位的间隔
+
+// 共享内存头部, 其后依次是槽位描述符数组和数据区
+typedef struct
+{
+    uint32_t magic;
+    uint32_t slots;
+    uint32_t slotBytes;
+    uint32_t reserved;
+    uint8_t pad1[CACHE_LINE - 16];
+    uint64_t head; // 下一张票据, 生产者原子递增
+    uint8_t pad2[CACHE_LINE - 8];
+} ShmRingHeader;
+
+struct ShmRing
+{
+    char *name;
+    int owner; // 创建者负责删除共享内存对象
+    size_t mapSize;
+    uint32_t slotCount; // 映射时确定的几何信息; 共享内存中的头部可被其他进程改写, 映射后不再读取
+    uint32_t slotBytes;
+    ShmRingHeader *header;
+    ShmRingSlot *slots;
+    unsigned char *data;
+};
+
+static size_t ringMapSize(uint32_t slots, uint32_t slotBytes)
+{
+    return sizeof(ShmRingHeader) + (size_t)slots * (sizeof(ShmRingSlot) + slotBytes);
+}
+
+static ShmRing *ringMap(const char *name, int fd, uint32_t slots, uint32_t slotBytes, int owner)
+{
+    size_t mapSize = ringMapSize(slots, slotBytes);
+    void *base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED)
+    {
+        perror("mmap");
+        return NULL;
+    }
+    ShmRing *ring = (ShmRing *)malloc(sizeof(ShmRing));
+    if (!ring)
+    {
+        munmap(base, mapSize);
+        return NULL;
+    }
+    ring->name = strdup(name);
+    ring->owner = owner;
+    ring->mapSize = mapSize;
+    ring->slotCount = slots;
+    ring->slotBytes = slotBytes;
+    ring->header = (ShmRingHeader *)base;
+    ring->slots = (ShmRingSlot *)(ring->header + 1);
+    ring->data = (unsigned char *)(ring->slots + slots);
+    return ring;
+}
+
+ShmRing *shmRingCreate(const char *name, uint32_t slots, uint32_t slotBytes)
+{
+    // 数据区按缓存行对齐
+    slotBytes = (slotBytes + CACHE_LINE - 1) & ~(uint32_t)(CACHE_LINE - 1);
+    if (slots == 0 || slotBytes == 0)
+    {
+        fprintf(stderr, "Error: Invalid ring geometry\n");
+        return NULL;
+    }
+    int fd = shm_open(name, O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        fprintf(stderr, "Error: Unable to create shared memory %s: %s\n", name, strerror(errno));
+        return NULL;
+    }
+    size_t mapSize = ringMapSize(slots, slotBytes);
+    if (ftruncate(fd, (off_t)mapSize) < 0)
+    {
+        perror("ftruncate");
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+    // ftruncate 后内容为0, 先写好几何信息再映射出句柄
+    ShmRingHeader header;
+    memset(&header, 0, sizeof(header));
+    header.slots = slots;
+    header.slotBytes = slotBytes;
+    if (pwrite(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+    {
+        perror("pwrite");
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+    ShmRing *ring = ringMap(name, fd, slots, slotBytes, 1);
+    close(fd);
+    if (!ring)
+    {
+        shm_unlink(name);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < slots; i++)
+    {
+        ring->slots[i].seq = i * 4;
+    }
+    // 魔数最后写入, 生产者看到它时环已初始化完毕
+    __atomic_store_n(&ring->header->magic, SHMRING_MAGIC, __ATOMIC_RELEASE);
+    return ring;
+}
+
+ShmRing *shmRingAttach(const char *name)
+{
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        fprintf(stderr, "Error: Unable to open shared memory %s: %s\n", name, strerror(errno));
+        return NULL;
+    }
+    ShmRingHeader header;
+    if (pread(fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) || header.magic != SHMRING_MAGIC)
+    {
+        fprintf(stderr, "Error: %s is not an initialized ring\n", name);
+        close(fd);
+        return NULL;
+    }
+    // 几何信息须与对象大小一致, 否则映射后会越界访问
+    struct stat st;
+    if (header.slots == 0 || header.slotBytes == 0 || fstat(fd, &st) < 0 ||
+        (size_t)st.st_size < ringMapSize(header.slots, header.slotBytes))
+    {
+        fprintf(stderr, "Error: %s has an invalid ring geometry\n", name);
+        close(fd);
+        return NULL;
+    }
+    ShmRing *ring = ringMap(name, fd, header.slots, header.slotBytes, 0);
+    close(fd);
+    return ring;
+}
+
+void shmRingClose(ShmRing *ring)
+{
+    if (!ring)
+        return;
+    munmap(ring->header, ring->mapSize);
+    if (ring->owner)
+        shm_unlink(ring->name);
+    free(ring->name);
+    free(ring);
+}
+
+uint32_t shmRingSlotBytes(const ShmRing *ring)
+{
+    return ring->slotBytes;
+}
+
+// 跨进程futex (不使用 FUTEX_PRIVATE_FLAG)
+static void futexWait(uint32_t *addr, uint32_t current, const struct timespec *timeout)
+{
+    syscall(SYS_futex, addr, FUTEX_WAIT, current, timeout, NULL, 0);
+}
+
+static void futexWake(uint32_t *addr)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+// 等待 *addr 变为 target; timeout 非空时超时返回0
+static int waitSeq(uint32_t *addr, uint32_t target, const struct timespec *timeout)
+{
+    for (;;)
+    {
+        uint32_t v = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+        if (v == target)
+            return 1;
+        futexWait(addr, v, timeout);
+        if (timeout && __atomic_load_n(addr, __ATOMIC_ACQUIRE) != target)
+            return 0;
+    }
+}
+
+static void publishSeq(uint32_t *addr, uint32_t value)
+{
+    __atomic_store_n(addr, value, __ATOMIC_RELEASE);
+    futexWake(addr);
+}
+
+// 仅当 *addr 仍为 expected 时改为 value 并唤醒等待者; 已被工作进程回收时返回0
+static int advanceSeq(uint32_t *addr, uint32_t expected, uint32_t value)
+{
+    if (!__atomic_compare_exchange_n(addr, &expected, value, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return 0;
+    futexWake(addr);
+    return 1;
+}
+
+static ShmRingSlot *ticketSlot(ShmRing *ring, uint64_t ticket)
+{
+    return &ring->slots[ticket % ring->slotCount];
+}
+
+ShmRingSlot *shmRingAcquire(ShmRing *ring, uint64_t *ticket, void **data)
+{
+    uint64_t t = __atomic_fetch_add(&ring->header->head, 1, __ATOMIC_RELAXED);
+    ShmRingSlot *slot = ticketSlot(ring, t);
+    waitSeq(&slot->seq, (uint32_t)(t * 4), NULL);
+    *ticket = t;
+    *data = ring->data + (t % ring->slotCount) * (size_t)ring->slotBytes;
+    return slot;
+}
+
+int shmRingSubmit(ShmRing *ring, uint64_t ticket)
+{
+    return advanceSeq(&ticketSlot(ring, ticket)->seq, (uint32_t)(ticket * 4), (uint32_t)(ticket * 4 + 1));
+}
+
+int shmRingWait(ShmRing *ring, uint64_t ticket)
+{
+    ShmRingSlot *slot = ticketSlot(ring, ticket);
+    waitSeq(&slot->seq, (uint32_t)(ticket * 4 + 2), NULL);
+    return slot->status;
+}
+
+void shmRingRelease(ShmRing *ring, uint64_t ticket)
+{
+    // 超时后工作进程可能已代为释放, 此时槽位可能已被下一圈的票据提交, 不能再覆盖
+    advanceSeq(&ticketSlot(ring, ticket)->seq, (uint32_t)(ticket * 4 + 2), (uint32_t)((ticket + ring->slotCount) * 4));
+}
+
+// 回收被放弃的槽位: 票据t已领取却未提交时跳过该票据, 返回1;
+// 上一圈的生产者取得结果后未释放时代为释放, 票据t的生产者随后照常提交, 返回0
+static int reclaimSlot(ShmRing *ring, ShmRingSlot *slot, uint64_t t)
+{
+    if (advanceSeq(&slot->seq, (uint32_t)(t * 4), (uint32_t)((t + ring->slotCount) * 4)))
+    {
+        fprintf(stderr, "Warning: Ticket %llu was not submitted within %d ms, skipping it\n",
+                (unsigned long long)t, SHMRING_ABANDON_MS);
+        return 1;
+    }
+    if (t >= ring->slotCount &&
+        advanceSeq(&slot->seq, (uint32_t)((t - ring->slotCount) * 4 + 2), (uint32_t)(t * 4)))
+    {
+        fprintf(stderr, "Warning: Ticket %llu was not released within %d ms, releasing it\n",
+                (unsigned long long)(t - ring->slotCount), SHMRING_ABANDON_MS);
+    }
+    return 0;
+}
+
+// 在槽位数据区原地执行一个任务
+static int32_t executeSlot(DES *des, ShmRingSlot *slot, unsigned char *data, uint32_t capacity)
+{
+    EncryptionMode mode = (EncryptionMode)slot->mode;
+    BYTE state = slot->iv;
+    int ok;
+    if (slot->length > capacity)
+        return -1;
+    if (slot->flags & SHMRING_FLAG_FEEDBACK8)
+    {
+        ok = slot->decrypt ? DES_decrypt8InPlace(des, data, slot->length, mode, &state)
+                           : DES_encrypt8InPlace(des, data, slot->length, mode, &state);
+    }
+    else
+    {
+        if (slot->length % 8 != 0)
+            return -1;
+        ok = slot->decrypt ? DES_decryptInPlace(des, (BYTE *)data, slot->length / 8, mode, &state)
+                           : DES_encryptInPlace(des, (BYTE *)data, slot->length / 8, mode, &state);
+    }
+    slot->iv = state;
+    return ok ? 0 : -1;
+}
+
+int shmRingServe(ShmRing *ring, DES *des, volatile sig_atomic_t *stop)
+{
+    // 周期性醒来检查退出标志
+    struct timespec poll = {0, SHMRING_POLL_MS * 1000 * 1000};
+    int idlePolls = 0; // 票据t已发出后仍未提交的轮询次数
+    for (uint64_t t = 0; !*stop; )
+    {
+        ShmRingSlot *slot = ticketSlot(ring, t);
+        if (!waitSeq(&slot->seq, (uint32_t)(t * 4 + 1), &poll))
+        {
+            // 票据t尚未发出时只是空闲; 已发出却久未提交, 说明生产者可能已退出
+            if (__atomic_load_n(&ring->header->head, __ATOMIC_ACQUIRE) <= t)
+                idlePolls = 0;
+            else if (++idlePolls >= SHMRING_ABANDON_MS / SHMRING_POLL_MS)
+            {
+                idlePolls = 0;
+                t += reclaimSlot(ring, slot, t);
+            }
+            continue;
+        }
+        idlePolls = 0;
+        unsigned char *data = ring->data + (t % ring->slotCount) * (size_t)ring->slotBytes;
+        slot->status = executeSlot(des, slot, data, ring->slotBytes);
+        publishSeq(&slot->seq, (uint32_t)(t * 4 + 2));
+        t++;
+    }
+    return 0;
+}
+
+static volatile sig_atomic_t shmStop = 0;
+
+static void shmSignal(int sig)
+{
+    (void)sig;
+    shmStop = 1;
+}
+
+int runShmWorker(const char *name, BYTE key)
+{
+    DES *des = DES_create();
+    if (!des)
+    {
+        fprintf(stderr, "Error: Unable to create DES instance\n");
+        return 1;
+    }
+    if (!DES_setKey(des, &key, 1))
+    {
+        fprintf(stderr, "Error: Unable to set the DES key\n");
+        DES_destroy(des);
+        return 1;
+    }
+    ShmRing *ring = shmRingCreate(name, SHMRING_DEFAULT_SLOTS, SHMRING_DEFAULT_SLOT_BYTES);
+    if (!ring)
+    {
+        DES_destroy(des);
+        return 1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = shmSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    printf("Ring worker serving %s (%u slots x %u bytes)\n", name, SHMRING_DEFAULT_SLOTS, shmRingSlotBytes(ring));
+    fflush(stdout);
+    int ret = shmRingServe(ring, des, &shmStop);
+    printf("Ring worker stopping\n");
+
+    shmRingClose(ring);
+    DES_destroy(des);
+    return ret;
+}
+
+#else
+
+ShmRing *shmRingCreate(const char *name, uint32_t slots, uint32_t slotBytes)
+{
+    (void)name;
+    (void)slots;
+    (void)slotBytes;
+    fprintf(stderr, "Error: Shared-memory ring requires Linux (futex)\n");
+    return NULL;
+}
+
+ShmRing *shmRingAttach(const char *name)
+{
+    return shmRingCreate(name, 0, 0);
+}
+
+void shmRingClose(ShmRing *ring)
+{
+    (void)ring;
+}
+
+int runShmWorker(const char *name, BYTE key)
+{
+    (void)key;
+    return shmRingCreate(name, 0, 0) == NULL;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef SHMRING_H
+#define SHMRING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <signal.h>
+#include "DES.h"
+#include "enum.h"
+
+// 共享内存环形缓冲区: 生产者进程把数据直接写入共享内存中的槽位并提交任务描述,
+// 常驻工作进程在原处加/解密, 通过futex通知完成, 数据不经过内核拷贝 (仅 Linux)
+//
+// 每个槽位有一个32位序号 seq, 对第t张票据(t % 槽位数 即槽位下标):
+//   seq == 4t     空闲, 可由持有票据t的生产者填写
+//   seq == 4t + 1 已提交, 等待工作进程处理
+//   seq == 4t + 2 已完成, 结果在数据区, 等待生产者取回
+// 生产者取回后把 seq 置为 4(t + 槽位数), 留给下一圈的票据
+//
+// 工作进程按票据顺序处理, 生产者在领取与提交之间退出会使后续票据全部阻塞. 因此票据t已发出
+// (头部计数超过t) 而 SHMRING_ABANDON_MS 内仍未提交时, 工作进程认为该票据已被放弃:
+//   seq == 4t             直接置为 4(t + 槽位数), 跳过票据t; 迟到的 shmRingSubmit 返回0
+//   seq == 4(t-槽位数)+2  上一圈的生产者取得结果后没有释放, 由工作进程代为释放
+// 因此生产者在领取后须在该时间内提交. 被跳过的槽位可能已交给下一圈, 迟到的生产者不能再使用其数据区
+
+#define SHMRING_DEFAULT_SLOTS 256
+#define SHMRING_DEFAULT_SLOT_BYTES (64 * 1024)
+
+#define SHMRING_ABANDON_MS 5000
+
+// 任务标志
+#define SHMRING_FLAG_FEEDBACK8 0x1 // CFB/OFB 使用8位反馈, 按字节处理 (与命令行一致)
+
+// 槽位描述符, 独占一个缓存行
+typedef struct
+{
+    uint32_t seq;
+    uint8_t mode;    // EncryptionMode
+    uint8_t decrypt; // 非0表示解密
+    uint8_t flags;   // SHMRING_FLAG_*
+    uint8_t reserved;
+    uint32_t length; // 数据字节数, 64位块模式下须为8的整数倍
+    int32_t status;  // 0表示成功
+    uint64_t iv;     // 输入为IV, 完成后为链接状态, 可用于继续处理同一数据流的下一段
+    uint8_t pad[40];
+} ShmRingSlot;
+
+typedef struct ShmRing ShmRing;
+
+// 工作进程: 创建并映射名为name的共享内存 (如 "/e1des-ring"), 已存在则覆盖
+ShmRing *shmRingCreate(const char *name, uint32_t slots, uint32_t slotBytes);
+// 生产者: 映射已存在的共享内存
+ShmRing *shmRingAttach(const char *name);
+// 解除映射; 创建者同时删除共享内存对象
+void shmRingClose(ShmRing *ring);
+
+// 每个槽位数据区的容量(字节)
+uint32_t shmRingSlotBytes(const ShmRing *ring);
+
+// 生产者: 领取一个票据并等待对应槽位空闲, 返回该槽位的描述符, *data 指向数据区
+ShmRingSlot *shmRingAcquire(ShmRing *ring, uint64_t *ticket, void **data);
+// 生产者: 填好描述符和数据后提交. 成功返回1; 超时已被工作进程跳过时返回0, 此时不能再等待或释放该票据
+int shmRingSubmit(ShmRing *ring, uint64_t ticket);
+// 生产者: 等待任务完成, 返回描述符中的状态; 结果已在数据区中
+int shmRingWait(ShmRing *ring, uint64_t ticket);
+// 生产者: 取回结果后释放槽位
+void shmRingRelease(ShmRing *ring, uint64_t ticket);
+
+// 工作进程: 按票据顺序处理任务直到 *stop 非0. 正常退出返回0
+int shmRingServe(ShmRing *ring, DES *des, volatile sig_atomic_t *stop);
+
+// 命令行入口: 创建共享内存并以密钥key常驻处理, 直到收到 SIGINT/SIGTERM
+int runShmWorker(const char *name, BYTE key);
+
+#endif // SHMRING_H
@@ -0,0 +1,189 @@
+#include "stream.h"
+#include "util.h"
+#include "workMode.h"
+#include "pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void cryptStreamInit(CryptStream *s, DES *des, EncryptionMode mode, bool decrypt, BYTE iv)
+{
+    s->des = des;
+    s->mode = mode;
+    s->decrypt = decrypt;
+    s->feedback8 = (mode == CFB || mode == OFB);
+    s->state = iv;
+    s->binary = false;
+    s->binaryOut = false;
+    s->kernel = NULL;
+    s->nibble = -1;
+    s->tileLen = 0;
+}
+
+// 加/解密缓冲的字节并输出(十六进制编码或原始字节). final 为真时64位块模式把最后不足一块的部分补0
+static size_t flushTile(CryptStream *s, char *out, bool final)
+{
+    size_t len = s->tileLen;
+    const unsigned char *result = s->tile;
+    unsigned char kernelOut[STREAM_TILE_BYTES];
+    if (s->feedback8)
+    {
+        if (s->decrypt)
+            DES_decrypt8InPlace(s->des, s->tile, len, s->mode, &s->state);
+        else
+            DES_encrypt8InPlace(s->des, s->tile, len, s->mode, &s->state);
+    }
+    else
+    {
+        BYTE blocks[STREAM_TILE_BYTES / 8];
+        if (final && len % 8 != 0)
+        {
+            memset(s->tile + len, 0, 8 - len % 8);
+            len += 8 - len % 8;
+        }
+        // 内核后端直接处理原始字节, 输出到另一缓冲区以便输入页面零拷贝提交
+        // 请求失败时链接状态未变, 改用 DES.c 处理, 结果不受影响
+        if (s->kernel && !kernelCipherProcess(s->kernel, s->decrypt, &s->state, s->tile, kernelOut, len))
+        {
+            fprintf(stderr, "Warning: Kernel crypto request failed, continuing with the DES.c engine\n");
+            s->kernel = NULL;
+        }
+        if (s->kernel)
+        {
+            result = kernelOut;
+        }
+        else
+        {
+            bytesToBlocks(s->tile, len, blocks);
+            if (s->decrypt)
+                DES_decryptInPlace(s->des, blocks, len / 8, s->mode, &s->state);
+            else
+                DES_encryptInPlace(s->des, blocks, len / 8, s->mode, &s->state);
+            blocksToBytes(blocks, len / 8, s->tile);
+        }
+    }
+    s->tileLen = 0;
+    if (s->binaryOut)
+    {
+        memcpy(out, result, len);
+        return len;
+    }
+    hexEncode(result, len, out);
+    return 2 * len;
+}
+
+size_t cryptStreamUpdate(CryptStream *s, const char *in, size_t inLen, char *out)
+{
+    size_t written = 0;
+    if (s->binary)
+    {
+        while (inLen > 0)
+        {
+            size_t n = STREAM_TILE_BYTES - s->tileLen;
+            n = n < inLen ? n : inLen;
+            memcpy(s->tile + s->tileLen, in, n);
+            s->tileLen += n;
+            in += n;
+            inLen -= n;
+            if (s->tileLen == STREAM_TILE_BYTES)
+                written += flushTile(s, out + written, false);
+        }
+        return written;
+    }
+    while (inLen > 0)
+    {
+        size_t consumed;
+        s->tileLen += hexDecode((const unsigned char *)in, inLen, &consumed, s->tile + s->tileLen,
+                                STREAM_TILE_BYTES - s->tileLen, &s->nibble);
+        in += consumed;
+        inLen -= consumed;
+        if (s->tileLen == STREAM_TILE_BYTES)
+            written += flushTile(s, out + written, false);
+    }
+    return written;
+}
+
+long cryptStreamFinal(CryptStream *s, char *out)
+{
+    if (s->nibble >= 0)
+        return -1;
+    if (s->tileLen == 0)
+        return 0;
+    return (long)flushTile(s, out, true);
+}
+
+int streamProcessFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                      const char *inPath, const char *outPath)
+{
+    return streamProcessFileKernel(des, NULL, mode, decrypt, binary, binaryOut, inPath, outPath);
+}
+
+int streamProcessFileKernel(DES *des, KernelCipher *kernel, EncryptionMode mode, bool decrypt, bool binary,
+                            bool binaryOut, const char *inPath, const char *outPath)
+{
+    bool inStd = strcmp(inPath, STREAM_STDIO_PATH) == 0;
+    bool outStd = strcmp(outPath, STREAM_STDIO_PATH) == 0;
+    FILE *in = inStd ? stdin : fopen(inPath, binary ? "rb" : "r");
+    if (!in)
+    {
+        fprintf(stderr, "Error: Unable to open file: %s\n", inPath);
+        return 0;
+    }
+    FILE *out = outStd ? stdout : fopen(outPath, binaryOut ? "wb" : "w");
+    char *inBuf = (char *)poolAlloc(STREAM_READ_BYTES);
+    char *outBuf = (char *)poolAlloc(CRYPT_STREAM_OUT_MAX(STREAM_READ_BYTES));
+    CryptStream *stream = (CryptStream *)poolAlloc(sizeof(CryptStream));
+    int ok = out && inBuf && outBuf && stream;
+    int writeFailed = 0;
+    if (!out)
+        fprintf(stderr, "Error: Unable to create file: %s\n", outPath);
+    else if (!ok)
+        fprintf(stderr, "Error: Memory allocation failed\n");
+
+    if (ok)
+    {
+        cryptStreamInit(stream, des, mode, decrypt, des->iv);
+        stream->binary = binary;
+        stream->binaryOut = binaryOut;
+        stream->kernel = kernel;
+        size_t n;
+        // 管道上的 fread 可能不足一整块, 按实际读到的长度处理即可
+        while (ok && (n = fread(inBuf, 1, STREAM_READ_BYTES, in)) > 0)
+        {
+            size_t produced = cryptStreamUpdate(stream, inBuf, n, outBuf);
+            if (fwrite(outBuf, 1, produced, out) != produced)
+                writeFailed = 1;
+            ok = !writeFailed;
+        }
+        if (ok && ferror(in))
+        {
+            fprintf(stderr, "Error: Failed to read file: %s\n", inPath);
+            ok = 0;
+        }
+        long tail = ok ? cryptStreamFinal(stream, outBuf) : 0;
+        if (tail < 0)
+        {
+            fprintf(stderr, "Error: Invalid hexadecimal string length: %s\n", inPath);
+            ok = 0;
+        }
+        else if (ok)
+        {
+            writeFailed = fwrite(outBuf, 1, (size_t)tail, out) != (size_t)tail;
+            ok = !writeFailed;
+        }
+    }
+    // 标准输入/输出只刷新, 不关闭
+    if (out && (outStd ? fflush(out) : fclose(out)) != 0)
+        writeFailed = 1;
+    if (writeFailed)
+    {
+        ok = 0;
+        fprintf(stderr, "Error: Failed to write file: %s\n", outPath);
+    }
+    if (!inStd)
+        fclose(in);
+    poolFree(inBuf);
+    poolFree(outBuf);
+    poolFree(stream);
+    return ok;
+}
@@ -0,0 +1,60 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "DES.h"
+#include "enum.h"
+#include "kcrypt.h"
+
+// 流式加解密: 十六进制文本(或原始字节)分段输入, 十六进制文本(或原始字节)分段输出
+// 结果与 readHexFile/readHexFile8 + 模式函数 + writeHexFile/writeHexByteFile 完全一致:
+// 非十六进制字符被忽略; ECB/CBC 最后不足8字节的块低位补0; CFB/OFB 使用8位反馈
+
+// 每次内部处理的字节数, 解码、加解密、编码都在这一小块上完成, 数据留在L1缓存中
+#define STREAM_TILE_BYTES 4096
+
+typedef struct
+{
+    DES *des;
+    EncryptionMode mode;
+    bool decrypt;
+    bool feedback8; // CFB/OFB 按字节处理
+    bool binary;    // 输入为原始字节而非十六进制文本, 初始化后按需设置
+    bool binaryOut; // 输出原始字节而非十六进制文本, 初始化后按需设置
+    KernelCipher *kernel; // 非NULL时 ECB/CBC 交给内核加密接口, 初始化后按需设置, 不取得所有权
+    BYTE state;     // 链接状态, 初值为IV
+    int nibble;     // 尚未配对的高4位, -1表示没有
+    unsigned char tile[STREAM_TILE_BYTES]; // 已解码、等待处理的字节
+    size_t tileLen;
+} CryptStream;
+
+void cryptStreamInit(CryptStream *s, DES *des, EncryptionMode mode, bool decrypt, BYTE iv);
+
+// 单次 cryptStreamUpdate 输出的最大字节数. 原始字节输入、十六进制输出时输出是输入的两倍
+#define CRYPT_STREAM_OUT_MAX(inLen) (2 * (inLen) + 2 * STREAM_TILE_BYTES + 16)
+
+// 处理一段输入, 把结果写入out, 返回写入的字节数
+// out 的容量至少为 CRYPT_STREAM_OUT_MAX(inLen)
+size_t cryptStreamUpdate(CryptStream *s, const char *in, size_t inLen, char *out);
+
+// 结束数据流, 输出剩余数据(至多一个补齐的块). 十六进制字符总数为奇数时返回-1
+long cryptStreamFinal(CryptStream *s, char *out);
+
+// 每次从文件读取的字节数: 读入的文本在L2缓存内逐个分块解码、加解密、编码
+#define STREAM_READ_BYTES (16 * STREAM_TILE_BYTES)
+
+// 路径为 "-" 时表示标准输入/标准输出
+#define STREAM_STDIO_PATH "-"
+
+// 以融合分块方式处理整个文件: 内存占用与文件大小无关, 数据只读一遍、写一遍
+// 输出与整体读入后再处理完全一致, processFile 即调用此函数. 成功返回1
+// binary/binaryOut 分别选择输入/输出为原始字节; inPath/outPath 可为 "-", 此时可处理管道等不可定位的流
+int streamProcessFile(DES *des, EncryptionMode mode, bool decrypt, bool binary, bool binaryOut,
+                      const char *inPath, const char *outPath);
+
+// 同 streamProcessFile, kernel 非NULL时 ECB/CBC 的分块由内核加密接口处理 (见 kcrypt.h)
+int streamProcessFileKernel(DES *des, KernelCipher *kernel, EncryptionMode mode, bool decrypt, bool binary,
+                            bool binaryOut, const char *inPath, const char *outPath);
+
+#endif // STREAM_H
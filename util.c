@@ -1,9 +1,11 @@
 #include "util.h"
+#include "pool.h"
 #include "enum.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdbool.h>
 
 // DES相关常量定义
 #define BLOCK_SIZE 1 // 现在1个BYTE代表一个64位块
@@ -11,7 +13,7 @@
 #define IV_SIZE 1    // 初始化向量大小为1个BYTE (64位)
 
 // 将字符串转换为加密模式枚举
-EncryptionMode parseMode(const char *modeStr)
+int parseMode(const char *modeStr)
 {
     if (strcmp(modeStr, "ECB") == 0 || strcmp(modeStr, "ecb") == 0)
         return ECB;
@@ -21,9 +23,7 @@ EncryptionMode parseMode(const char *modeStr)
         return CFB;
     if (strcmp(modeStr, "OFB") == 0 || strcmp(modeStr, "ofb") == 0)
         return OFB;
-
-    fprintf(stderr, "Unsupported encryption mode: %s\n", modeStr);
-    exit(1);
+    return -1;
 }
 
 // 读取文件内容到字节数组 - 修改为支持64位BYTE类型
@@ -45,7 +45,7 @@ BYTE *readFile(const char *filePath, size_t *fileSize)
     *fileSize = (fileSizeBytes + 7) / 8;
 
     // 分配内存空间
-    BYTE *buffer = (BYTE *)malloc(*fileSize * sizeof(BYTE));
+    BYTE *buffer = (BYTE *)poolAlloc(*fileSize * sizeof(BYTE));
     if (!buffer)
     {
         fclose(file);
@@ -54,10 +54,10 @@ BYTE *readFile(const char *filePath, size_t *fileSize)
     }
 
     // 临时缓冲区存储实际字节
-    unsigned char *tempBuffer = (unsigned char *)malloc(fileSizeBytes);
+    unsigned char *tempBuffer = (unsigned char *)poolAlloc(fileSizeBytes);
     if (!tempBuffer)
     {
-        free(buffer);
+        poolFree(buffer);
         fclose(file);
         fprintf(stderr, "Error: Memory allocation failed\n");
         return NULL;
@@ -69,8 +69,8 @@ BYTE *readFile(const char *filePath, size_t *fileSize)
 
     if (bytesRead != fileSizeBytes)
     {
-        free(buffer);
-        free(tempBuffer);
+        poolFree(buffer);
+        poolFree(tempBuffer);
         fprintf(stderr, "Error: Failed to read file: %s\n", filePath);
         return NULL;
     }
@@ -85,7 +85,7 @@ BYTE *readFile(const char *filePath, size_t *fileSize)
         }
     }
 
-    free(tempBuffer);
+    poolFree(tempBuffer);
     return buffer;
 }
 
@@ -103,7 +103,7 @@ int writeFile(const char *filePath, const BYTE *data, size_t dataSize)
     size_t totalBytes = dataSize * 8;
 
     // 临时缓冲区存储实际字节
-    unsigned char *tempBuffer = (unsigned char *)malloc(totalBytes);
+    unsigned char *tempBuffer = (unsigned char *)poolAlloc(totalBytes);
     if (!tempBuffer)
     {
         fclose(file);
@@ -123,7 +123,7 @@ int writeFile(const char *filePath, const BYTE *data, size_t dataSize)
     // 写入文件
     size_t bytesWritten = fwrite(tempBuffer, 1, totalBytes, file);
     fclose(file);
-    free(tempBuffer);
+    poolFree(tempBuffer);
 
     if (bytesWritten != totalBytes)
     {
@@ -134,179 +134,226 @@ int writeFile(const char *filePath, const BYTE *data, size_t dataSize)
     return 1;
 }
 
-// 从十六进制字符串读取一个字节
-static int hex2byte(char c)
+// 字节串按大端序打包为BYTE块, 最后不足8字节的块低位补0 (与readHexFile一致)
+void bytesToBlocks(const unsigned char *bytes, size_t byteCount, BYTE *blocks)
 {
-    c = tolower((unsigned char)c);
-    if (c >= '0' && c <= '9')
-        return c - '0';
-    if (c >= 'a' && c <= 'f')
-        return c - 'a' + 10;
-    return -1; // 非法十六进制字符
+    size_t full = byteCount / 8;
+    for (size_t i = 0; i < full; i++)
+    {
+        const unsigned char *b = bytes + i * 8;
+        blocks[i] = ((BYTE)b[0] << 56) | ((BYTE)b[1] << 48) | ((BYTE)b[2] << 40) | ((BYTE)b[3] << 32) |
+                    ((BYTE)b[4] << 24) | ((BYTE)b[5] << 16) | ((BYTE)b[6] << 8) | (BYTE)b[7];
+    }
+    if (byteCount % 8)
+    {
+        BYTE last = 0;
+        for (size_t j = 0; j < byteCount % 8; j++)
+        {
+            last |= (BYTE)bytes[full * 8 + j] << (56 - j * 8);
+        }
+        blocks[full] = last;
+    }
 }
 
-// 读取十六进制文本文件内容到BYTE数组 (使用大端序)
-BYTE *readHexFile(const char *filePath, size_t *byteSize)
+// BYTE块按大端序展开为字节串, 输出 blockCount*8 个字节
+void blocksToBytes(const BYTE *blocks, size_t blockCount, unsigned char *bytes)
 {
-    FILE *file = fopen(filePath, "r");
-    if (!file)
+    for (size_t i = 0; i < blockCount; i++)
     {
-        fprintf(stderr, "Error: Unable to open file: %s\n", filePath);
-        return NULL;
+        for (size_t j = 0; j < 8; j++)
+        {
+            bytes[i * 8 + j] = (unsigned char)(blocks[i] >> (56 - j * 8));
+        }
     }
+}
 
-    // 获取文件大小
-    fseek(file, 0, SEEK_END);
-    size_t fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
 
-    // 分配缓冲区来存储文件内容
-    char *buffer = (char *)malloc(fileSize + 1);
-    if (!buffer)
-    {
-        fclose(file);
-        fprintf(stderr, "Error: Memory allocation failed\n");
-        return NULL;
-    }
+// 十六进制字符的值加1, 其他字符为0. 常量表, 多个线程同时读取文件时无需初始化;
+// 查表避免按字符类别分支(随机数据上难以预测)
+static const unsigned char hexTable[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8,
+    ['8'] = 9, ['9'] = 10, ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
 
-    // 读取文件内容
-    size_t bytesRead = fread(buffer, 1, fileSize, file);
-    fclose(file);
+// 十六进制字符转4位数值, 非十六进制字符返回-1
+static inline int hexNibble(unsigned char c)
+{
+    return hexTable[c] - 1;
+}
 
-    if (bytesRead != fileSize)
+size_t hexDecode(const unsigned char *in, size_t inLen, size_t *consumed, unsigned char *out, size_t outCap,
+                 int *nibble)
+{
+    // 状态放在局部变量上: out 可能与 in 或调用者的状态重叠, 经指针访问时每写一个字节都会重新读取
+    size_t pos = 0, got = 0;
+    int high = *nibble;
+    while (pos < inLen && got < outCap)
     {
-        free(buffer);
-        fprintf(stderr, "Error: Failed to read file: %s\n", filePath);
-        return NULL;
+        // 连续两个十六进制字符(最常见的情况)一次解码一个字节
+        if (high < 0 && pos + 1 < inLen)
+        {
+            int hi = hexNibble(in[pos]), lo = hexNibble(in[pos + 1]);
+            if ((hi | lo) >= 0)
+            {
+                out[got++] = (unsigned char)((hi << 4) | lo);
+                pos += 2;
+                continue;
+            }
+        }
+        int v = hexNibble(in[pos++]);
+        if (v < 0)
+            continue;
+        if (high < 0)
+        {
+            high = v;
+        }
+        else
+        {
+            out[got++] = (unsigned char)((high << 4) | v);
+            high = -1;
+        }
     }
+    *nibble = high;
+    *consumed = pos;
+    return got;
+}
 
-    buffer[bytesRead] = '\0'; // 确保字符串结束
-
-    // 移除任何空白字符、换行符等
-    char *hexString = (char *)malloc(fileSize + 1);
-    if (!hexString)
+void hexEncode(const unsigned char *bytes, size_t len, char *out)
+{
+    for (size_t i = 0; i < len; i++)
     {
-        free(buffer);
-        fprintf(stderr, "Error: Memory allocation failed\n");
-        return NULL;
+        out[2 * i] = HEX_DIGITS[bytes[i] >> 4];
+        out[2 * i + 1] = HEX_DIGITS[bytes[i] & 0x0F];
     }
+}
 
-    size_t hexLen = 0;
-    for (size_t i = 0; i < bytesRead; i++)
+void hexEncodeBlocks(const BYTE *blocks, size_t count, char *out)
+{
+    for (size_t i = 0; i < count; i++)
     {
-        if (isxdigit((unsigned char)buffer[i]))
+        for (int j = 0; j < 16; j++)
         {
-            hexString[hexLen++] = buffer[i];
+            out[i * 16 + j] = HEX_DIGITS[(blocks[i] >> (60 - 4 * j)) & 0x0F];
         }
     }
-    hexString[hexLen] = '\0';
+}
 
-    free(buffer);
+// 把十六进制文本就地解码为字节, 跳过非十六进制字符. 十六进制字符数为奇数时返回0
+static int decodeHexInPlace(unsigned char *buf, size_t len, size_t *outLen)
+{
+    size_t consumed;
+    int high = -1;
+    *outLen = hexDecode(buf, len, &consumed, buf, len, &high);
+    return high < 0;
+}
 
-    // 检查十六进制字符串长度是否有效
-    if (hexLen % 2 != 0)
+int readInput(const char *filePath, bool binary, InputBuffer *input)
+{
+    memset(input, 0, sizeof(*input));
+    FILE *file = fopen(filePath, binary ? "rb" : "r");
+    if (!file)
     {
-        free(hexString);
-        fprintf(stderr, "Error: Invalid hexadecimal string length: %s\n", filePath);
-        return NULL;
+        fprintf(stderr, "Error: Unable to open file: %s\n", filePath);
+        return 0;
     }
-
-    // 计算需要的BYTE数量 (每16个十六进制字符一个BYTE)
-    size_t numBytes = hexLen / 16;
-    if (hexLen % 16 != 0)
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (fileSize < 0)
     {
-        numBytes++; // 不完整的BYTE
+        fclose(file);
+        fprintf(stderr, "Error: Failed to read file: %s\n", filePath);
+        return 0;
     }
-    *byteSize = numBytes;
 
-    // 分配BYTE数组
-    BYTE *result = (BYTE *)malloc(numBytes * sizeof(BYTE));
-    if (!result)
+    // 容量向上取整到8字节, 末尾补0后整个缓冲区可以直接当作BYTE数组
+    size_t capacity = ((size_t)fileSize + 7) / 8 * 8;
+    unsigned char *buf = (unsigned char *)poolAlloc(capacity ? capacity : 8);
+    if (!buf)
     {
-        free(hexString);
+        fclose(file);
         fprintf(stderr, "Error: Memory allocation failed\n");
-        return NULL;
+        return 0;
     }
-
-    // 将十六进制字符串转换为BYTE值 (使用大端序)
-    memset(result, 0, numBytes * sizeof(BYTE));
-
-    for (size_t i = 0; i < hexLen; i += 2)
+    size_t bytesRead = fread(buf, 1, (size_t)fileSize, file);
+    fclose(file);
+    if (bytesRead != (size_t)fileSize)
     {
-        int highNibble = hex2byte(hexString[i]);
-        int lowNibble = hex2byte(hexString[i + 1]);
+        poolFree(buf);
+        fprintf(stderr, "Error: Failed to read file: %s\n", filePath);
+        return 0;
+    }
 
-        if (highNibble == -1 || lowNibble == -1)
+    size_t length = bytesRead;
+    if (!binary)
+    {
+        if (!decodeHexInPlace(buf, bytesRead, &length))
         {
-            free(hexString);
-            free(result);
-            fprintf(stderr, "Error: Invalid hexadecimal character: %s\n", filePath);
-            return NULL;
+            poolFree(buf);
+            fprintf(stderr, "Error: Invalid hexadecimal string length: %s\n", filePath);
+            return 0;
         }
+    }
+    size_t padded = (length + 7) / 8 * 8;
+    memset(buf + length, 0, padded - length);
 
-        unsigned char byte = (highNibble << 4) | lowNibble;
-        size_t byteIndex = i / 2;
-        size_t byteArrayIndex = byteIndex / 8;
-
-        // 使用大端序 - 修改这里的位置计算，使最高有效字节在前
-        size_t bytePosition = 7 - (byteIndex % 8); // 7, 6, 5, 4, 3, 2, 1, 0
-        size_t bitShift = bytePosition * 8;
+    input->bytes = buf;
+    input->length = length;
+    return 1;
+}
 
-        result[byteArrayIndex] |= ((BYTE)byte << bitShift);
+BYTE *inputBlocks(InputBuffer *input, size_t *blockCount)
+{
+    size_t count = (input->length + 7) / 8;
+    BYTE *blocks = (BYTE *)input->bytes;
+    if (!input->blockView)
+    {
+        // 大端序字节就地转换为BYTE值, 转换只做一次
+        for (size_t i = 0; i < count; i++)
+        {
+            const unsigned char *b = input->bytes + i * 8;
+            blocks[i] = ((BYTE)b[0] << 56) | ((BYTE)b[1] << 48) | ((BYTE)b[2] << 40) | ((BYTE)b[3] << 32) |
+                        ((BYTE)b[4] << 24) | ((BYTE)b[5] << 16) | ((BYTE)b[6] << 8) | (BYTE)b[7];
+        }
+        input->blockView = true;
     }
+    *blockCount = count;
+    return blocks;
+}
 
-    free(hexString);
-    return result;
+void freeInput(InputBuffer *input)
+{
+    poolFree(input->bytes);
+    input->bytes = NULL;
+    input->length = 0;
+}
+
+// 读取十六进制文本文件内容到BYTE数组 (使用大端序), 最后不足8字节的块低位补0
+BYTE *readHexFile(const char *filePath, size_t *byteSize)
+{
+    InputBuffer input;
+    if (!readInput(filePath, false, &input))
+        return NULL;
+    // 视图与缓冲区起始地址相同, 调用者直接 poolFree
+    return inputBlocks(&input, byteSize);
 }
 
 // 读取十六进制文本文件到8位字节数组，每对16进制字符一个字节
 unsigned char *readHexFile8(const char *filePath, size_t *outSize)
 {
-    FILE *f = fopen(filePath, "r");
-    if (!f)
-        return NULL;
-    fseek(f, 0, SEEK_END);
-    size_t len = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    char *buf = malloc(len + 1);
-    fread(buf, 1, len, f);
-    fclose(f);
-    buf[len] = '\0';
-    // 去除非hex
-    char *h = malloc(len + 1);
-    size_t hl = 0;
-    for (size_t i = 0; i < len; i++)
-        if (isxdigit(buf[i]))
-            h[hl++] = buf[i];
-    h[hl] = '\0';
-    free(buf);
-    if (hl % 2)
-    {
-        free(h);
+    InputBuffer input;
+    if (!readInput(filePath, false, &input))
         return NULL;
-    }
-    *outSize = hl / 2;
-    unsigned char *out = malloc(*outSize);
-    for (size_t i = 0; i < *outSize; i++)
-    {
-        int hi = hex2byte(h[2 * i]), lo = hex2byte(h[2 * i + 1]);
-        out[i] = (hi << 4) | lo;
-    }
-    free(h);
-    return out;
+    *outSize = input.length;
+    return input.bytes;
 }
 
 // 将BYTE数组写入为十六进制文本文件 (使用大端序)
-int writeHexFile(const char *filePath, const BYTE *data, size_t dataSize)
+// 把BYTE数组以十六进制文本写入已打开的文件 (使用大端序)
+static void writeHexBlocks(FILE *file, const BYTE *data, size_t dataSize)
 {
-    FILE *file = fopen(filePath, "w");
-    if (!file)
-    {
-        fprintf(stderr, "Error: Unable to create file: %s\n", filePath);
-        return 0;
-    }
-
-    // 每个BYTE值写入16个十六进制字符 (使用大端序)
     for (size_t i = 0; i < dataSize; i++)
     {
         // 使用大端序输出 - 从最高有效字节开始
@@ -318,11 +365,117 @@ int writeHexFile(const char *filePath, const BYTE *data, size_t dataSize)
             fprintf(file, "%02X", byte);
         }
     }
+}
+
+int writeHexFile(const char *filePath, const BYTE *data, size_t dataSize)
+{
+    FILE *file = fopen(filePath, "w");
+    if (!file)
+    {
+        fprintf(stderr, "Error: Unable to create file: %s\n", filePath);
+        return 0;
+    }
+
+    // 每个BYTE值写入16个十六进制字符 (使用大端序)
+    writeHexBlocks(file, data, dataSize);
 
     fclose(file);
     return 1;
 }
 
+// 写入分块CBC容器: 头部和块索引也按BYTE写成十六进制, 与密文连成一个文本
+int writeChunkedFile(const char *filePath, const ChunkedContainer *container)
+{
+    FILE *file = fopen(filePath, "w");
+    if (!file)
+    {
+        fprintf(stderr, "Error: Unable to create file: %s\n", filePath);
+        return 0;
+    }
+
+    BYTE header[4] = {CHUNKED_MAGIC, container->chunkBlocks, container->chunkCount, container->totalBlocks};
+    writeHexBlocks(file, header, 4);
+    for (size_t i = 0; i < container->chunkCount; i++)
+    {
+        BYTE size = container->chunkSizes[i];
+        writeHexBlocks(file, &size, 1);
+    }
+    writeHexBlocks(file, container->data, container->totalBlocks);
+
+    if (fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: Failed to write file: %s\n", filePath);
+        return 0;
+    }
+    return 1;
+}
+
+// 读取分块CBC容器并校验头部与块索引
+int readChunkedFile(const char *filePath, ChunkedContainer *container)
+{
+    size_t size = 0;
+    BYTE *raw = readHexFile(filePath, &size);
+    if (!raw)
+        return 0;
+
+    memset(container, 0, sizeof(*container));
+    if (size < 4 || raw[0] != CHUNKED_MAGIC || raw[1] == 0 || raw[2] > size - 4 ||
+        raw[3] != size - 4 - raw[2])
+    {
+        fprintf(stderr, "Error: Not a chunked CBC container: %s\n", filePath);
+        poolFree(raw);
+        return 0;
+    }
+    container->chunkBlocks = raw[1];
+    container->chunkCount = raw[2];
+    container->totalBlocks = raw[3];
+
+    // 块索引之和须等于密文总长, 且除最后一块外都是整块. 只有一块时块长可以大于总长(短于一块的数据),
+    // 多块时整块不会超过总长; 累加前先与剩余长度比较, 伪造的索引不会使和溢出
+    size_t sum = 0;
+    int valid = container->chunkCount <= 1 || container->chunkBlocks <= container->totalBlocks;
+    for (size_t i = 0; valid && i < container->chunkCount; i++)
+    {
+        BYTE chunk = raw[4 + i];
+        if (chunk == 0 || chunk > container->chunkBlocks || chunk > container->totalBlocks - sum ||
+            (i + 1 < container->chunkCount && chunk != container->chunkBlocks))
+            valid = 0;
+        else
+            sum += chunk;
+    }
+    if (!valid || sum != container->totalBlocks)
+    {
+        fprintf(stderr, "Error: Corrupted chunk index: %s\n", filePath);
+        poolFree(raw);
+        return 0;
+    }
+
+    container->chunkSizes = (size_t *)poolAlloc((container->chunkCount ? container->chunkCount : 1) * sizeof(size_t));
+    container->data = (BYTE *)poolAlloc((container->totalBlocks ? container->totalBlocks : 1) * sizeof(BYTE));
+    if (!container->chunkSizes || !container->data)
+    {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        freeChunkedContainer(container);
+        poolFree(raw);
+        return 0;
+    }
+    for (size_t i = 0; i < container->chunkCount; i++)
+    {
+        container->chunkSizes[i] = raw[4 + i];
+    }
+    memcpy(container->data, raw + 4 + container->chunkCount, container->totalBlocks * sizeof(BYTE));
+    poolFree(raw);
+    return 1;
+}
+
+void freeChunkedContainer(ChunkedContainer *container)
+{
+    poolFree(container->chunkSizes);
+    poolFree(container->data);
+    container->chunkSizes = NULL;
+    container->data = NULL;
+}
+
 // 将8位字节数组写入十六进制文本，每字节2字符
 int writeHexByteFile(const char *filePath, const unsigned char *data, size_t dataSize)
 {
@@ -340,6 +493,10 @@ int writeHexByteFile(const char *filePath, const unsigned char *data, size_t dat
 void printUsage()
 {
     printf("Usage: e1des -p plainfile -k keyfile [-v ivfile] -m mode -c cipherfile [-d]\n");
+    printf("       e1des -b manifest -k keyfile [-v ivfile] -m mode [-t threads] [-d]\n");
+    printf("       e1des -s socket [-k keyfile] [-K keytable] [-t threads] [--metrics-socket=path] [--metrics-file=path]\n");
+    printf("       e1des -r ringname -k keyfile\n");
+    printf("       e1des -p infile -k keyfile [--key2 keyfile] --mac=cbc|retail [--mac-pad=1|2] -c tagfile\n");
     printf("Options:\n");
     printf("  -p plainfile   Specify the path to the plaintext file\n");
     printf("  -k keyfile     Specify the path to the key file\n");
@@ -347,4 +504,31 @@ void printUsage()
     printf("  -m mode        Specify the encryption mode (ECB, CBC, CFB, OFB)\n");
     printf("  -c cipherfile  Specify the path to the ciphertext file\n");
     printf("  -d             Decrypt mode (optional)\n");
+    printf("  -b manifest    Batch mode: one \"input output\" pair per line, '-' reads stdin\n");
+    printf("  -t threads     Worker threads for batch/service/chunked mode (default: number of CPUs)\n");
+    printf("  -s socket      Service mode: serve requests on a Unix domain socket\n");
+    printf("  -K keytable    Service mode key table: one \"<id> <16 hex chars>\" per line\n");
+    printf("  -r ringname    Shared-memory ring worker (e.g. /e1des-ring)\n");
+    printf("  --io=backend   File I/O backend: memory (default), threads, uring\n");
+    printf("  --chunk=bytes  Pipeline read size, multiple of 4096 (default 1048576)\n");
+    printf("  --queue-depth=n  Pipeline reads in flight (default 4)\n");
+    printf("  --direct       Use O_DIRECT for pipeline file I/O\n");
+    printf("  --chunked[=bytes]  CBC only: chunked container with per-chunk IVs, processed in parallel\n");
+    printf("                 (default chunk 65536 bytes; decryption reads the size from the header)\n");
+    printf("  --offset=n --length=n  With -d: decrypt only this plaintext byte range (ECB, CBC, CFB)\n");
+    printf("  --binary       Input is raw bytes instead of hex text\n");
+    printf("  --binary-out   Write raw bytes instead of hex text (single-file processing)\n");
+    printf("  -p - / -c -    Read stdin / write stdout, streamed with constant memory\n");
+    printf("  --mac=cbc|retail  Write the CBC-MAC or ISO 9797-1 retail MAC of -p to -c (no -m needed)\n");
+    printf("  --key2=keyfile Second key of the retail MAC\n");
+    printf("  --mac-pad=1|2  ISO 9797-1 padding method (default 1: zeros)\n");
+    printf("  --hugepages=off|thp|tlb  Page type for buffers of 2 MB and more (default off)\n");
+    printf("  --alloc-stats  Print buffer pool statistics to stderr on exit\n");
+    printf("  --jit          Generate key-specialized block code (x86-64 only)\n");
+    printf("  --backend=des|kernel  ECB/CBC engine: DES.c (default) or the Linux kernel crypto API (AF_ALG)\n");
+    printf("  --autotune     Measure this host and write its tuning profile, then exit\n");
+    printf("  --profile=path Tuning profile (default $E1DES_PROFILE or ~/.config/e1des/<host>.profile)\n");
+    printf("  --incremental[=manifest]  Re-encrypt only chunks changed since the last run (ECB or CBC --chunked)\n");
+    printf("  --metrics-socket=path  Service mode: serve latency histograms on a Unix socket (Prometheus or text)\n");
+    printf("  --metrics-file=path    Service mode: rewrite path with Prometheus metrics every few seconds\n");
 }
\ No newline at end of file
@@ -2,16 +2,32 @@
 #define UTIL_H
 
 #include <stdio.h>
+#include <stdbool.h>
 #include "DES.h"
 
-// 将字符串转换为加密模式枚举
-EncryptionMode parseMode(const char *modeStr);
+// 将字符串转换为加密模式枚举 (EncryptionMode), 不支持的模式返回-1
+int parseMode(const char *modeStr);
 
 // 文件读写函数 - 二进制格式
 BYTE *readFile(const char *filePath, size_t *fileSize);
 int writeFile(const char *filePath, const BYTE *data, size_t dataSize);
 
-// 文件读写函数 - 十六进制文本格式
+// 输入层: 整个文件只读取和解码一次, 得到一个字节缓冲区(容量向上取整到8字节, 末尾补0)
+// 8位反馈模式直接使用 bytes; 64位分组模式用 inputBlocks 就地转换为BYTE视图, 不再复制
+typedef struct
+{
+    unsigned char *bytes;
+    size_t length;  // 有效字节数
+    bool blockView; // 已转换为BYTE视图, 此后 bytes 中为主机字节序的BYTE值
+} InputBuffer;
+
+// binary 为真时按原始字节读取, 否则按十六进制文本解码(忽略非十六进制字符). 成功返回1
+int readInput(const char *filePath, bool binary, InputBuffer *input);
+// 返回BYTE视图, 块数为 ceil(length/8), 最后不足8字节的块低位补0
+BYTE *inputBlocks(InputBuffer *input, size_t *blockCount);
+void freeInput(InputBuffer *input);
+
+// 文件读写函数 - 十六进制文本格式, 返回的数组用 poolFree 释放
 BYTE *readHexFile(const char *filePath, size_t *byteSize);
 unsigned char *readHexFile8(const char *filePath, size_t *outSize);
 int writeHexFile(const char *filePath, const BYTE *data, size_t dataSize);
@@ -19,6 +35,39 @@ int writeHexFile(const char *filePath, const BYTE *data, size_t dataSize);
 // 写入十六进制文本文件，每个字节2个hex字符，用于CFB/OFB 8-bit模式
 int writeHexByteFile(const char *filePath, const unsigned char *data, size_t dataSize);
 
+// 十六进制编解码, readInput、流式处理、增量加密与区间解密共用
+// hexDecode: 解码 in 的前 inLen 个字符, 跳过非十六进制字符, 写出至多 outCap 个字节, 返回写出的字节数.
+// *consumed 为已处理的字符数(输出写满时可能小于 inLen), *nibble 保存跨调用尚未配对的高4位(初始为-1).
+// 输出不会追上输入, out 可以与 in 是同一缓冲区
+size_t hexDecode(const unsigned char *in, size_t inLen, size_t *consumed, unsigned char *out, size_t outCap,
+                 int *nibble);
+// 字节串或BYTE块(大端序)写成大写十六进制文本, 每字节2个字符, 不写'\0'
+void hexEncode(const unsigned char *bytes, size_t len, char *out);
+void hexEncodeBlocks(const BYTE *blocks, size_t count, char *out);
+
+// 字节串与BYTE块之间的大端序转换, 最后不足8字节的块低位补0
+void bytesToBlocks(const unsigned char *bytes, size_t byteCount, BYTE *blocks);
+void blocksToBytes(const BYTE *blocks, size_t blockCount, unsigned char *bytes);
+
+// 分块CBC容器: 明文按固定块数切分, 每块用派生IV独立做CBC, 可并行加解密、单独解密某一块
+// 文件仍为十六进制文本, 依次为: 魔数, 每块的BYTE数, 块数, 明文BYTE总数, 块索引(每块的BYTE数), 各块密文
+#define CHUNKED_MAGIC 0x4445534343424331ULL // "DESCCBC1"
+#define CHUNKED_DEFAULT_BYTES 65536
+
+typedef struct
+{
+    size_t chunkBlocks; // 每块的BYTE数(最后一块可以更少)
+    size_t chunkCount;
+    size_t totalBlocks; // 明文/密文的BYTE总数
+    size_t *chunkSizes; // 块索引: 每块的BYTE数
+    BYTE *data;         // 各块密文依次连续存放
+} ChunkedContainer;
+
+// 读写分块CBC容器文件. 读取时分配 chunkSizes 和 data, 用 freeChunkedContainer 释放
+int readChunkedFile(const char *filePath, ChunkedContainer *container);
+int writeChunkedFile(const char *filePath, const ChunkedContainer *container);
+void freeChunkedContainer(ChunkedContainer *container);
+
 // 帮助信息
 void printUsage();
 
@@ -1,11 +1,21 @@
 #ifndef WORKMODE_H
 #define WORKMODE_H
 #include <stdio.h>
+#include <stdbool.h>
 #include "DES.h"
+#include "util.h"
 
+// 返回新数组的模式函数均从缓冲区池分配, 用 poolFree 释放
 BYTE *DES_encrypt(DES *des, BYTE *data, size_t dataSize, EncryptionMode mode, size_t *ciphertextSize);
 BYTE *DES_decrypt(DES *des, BYTE *data, size_t dataSize, EncryptionMode mode, size_t *plaintextSize);
 
+// 大输出的流式写入: 输出不小于阈值时, ECB 与 OFB 的批量函数用非临时存储写出结果(不进入缓存)并提前预取输入,
+// 几GB的输出不再把输入、查表和同时运行的其他程序的数据挤出缓存. 仅 x86-64 生效, 其他平台照常写入
+#define MODE_STREAMING_DEFAULT_BYTES (32u << 20)
+// 设置阈值(字节), 0 表示关闭. 进程范围, 只影响之后开始的调用
+void modeSetStreamingThreshold(size_t bytes);
+size_t modeGetStreamingThreshold(void);
+
 BYTE *ECB_encrypt(DES *des, BYTE *data, size_t dataSize, size_t *ciphertextSize);
 BYTE *ECB_decrypt(DES *des, BYTE *data, size_t dataSize, size_t *plaintextSize);
 
@@ -26,4 +36,38 @@ unsigned char *OFB8_encrypt(DES *des, unsigned char *data, size_t dataSize, BYTE
 unsigned char *CFB8_decrypt(DES *des, unsigned char *data, size_t dataSize, BYTE iv, size_t *plaintextSize);
 unsigned char *OFB8_decrypt(DES *des, unsigned char *data, size_t dataSize, BYTE iv, size_t *plaintextSize);
 
+// 原地加/解密, 不分配输出缓冲区. *state 初值为IV(ECB忽略), 返回时更新为链接状态,
+// 可对同一数据流分段连续调用. 成功返回1, 模式不支持返回0
+int DES_encryptInPlace(DES *des, BYTE *data, size_t dataSize, EncryptionMode mode, BYTE *state);
+int DES_decryptInPlace(DES *des, BYTE *data, size_t dataSize, EncryptionMode mode, BYTE *state);
+
+// 8位反馈CFB/OFB的原地版本
+int DES_encrypt8InPlace(DES *des, unsigned char *data, size_t dataSize, EncryptionMode mode, BYTE *state);
+int DES_decrypt8InPlace(DES *des, unsigned char *data, size_t dataSize, EncryptionMode mode, BYTE *state);
+
+// 分块CBC (容器格式见 util.h): 第index块的IV为 E_K(IV ^ index)
+BYTE chunkedDeriveIV(DES *des, BYTE iv, size_t index);
+// 把明文按chunkBlocks个BYTE分块, 在numThreads个线程上并行加密(<=0时取CPU核数), 结果写入container
+// 成功返回1, container 用 freeChunkedContainer 释放
+int CBC_encryptChunked(DES *des, const BYTE *data, size_t dataSize, BYTE iv, size_t chunkBlocks,
+                       int numThreads, ChunkedContainer *container);
+// 并行解密整个容器
+BYTE *CBC_decryptChunked(DES *des, const ChunkedContainer *container, BYTE iv, int numThreads,
+                         size_t *plaintextSize);
+// 单独解密第index块到out(容量至少 chunkSizes[index]), 成功返回1
+int CBC_decryptChunk(DES *des, const ChunkedContainer *container, BYTE iv, size_t index, BYTE *out);
+
+// 多路CBC加密的一个数据流. iv 返回时更新为最后一个密文块, 可接着加密同一数据流的后续数据
+typedef struct
+{
+    const BYTE *in;
+    BYTE *out; // 可与in相同
+    size_t blocks;
+    BYTE iv;
+} CBCStream;
+
+// 多路CBC加密: 单个CBC数据流无法并行, 但多个独立数据流可以齐步推进,
+// 每一步从每个未结束的数据流各取一块, 一起交给交错执行的批量内核
+void CBC_encryptMulti(DES *des, CBCStream *streams, size_t count);
+
 #endif
\ No newline at end of file